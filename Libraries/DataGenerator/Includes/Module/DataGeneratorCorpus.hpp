@@ -0,0 +1,51 @@
+#pragma once
+#ifndef __MODULE_DATA_GENERATOR_CORPUS_HPP__ // clang-format off
+#define __MODULE_DATA_GENERATOR_CORPUS_HPP__ // clang-format on
+
+ #include "Module/IDataGenerator.hpp"
+ #include <filesystem>
+
+namespace Program::Module
+{
+    /**
+     * @brief How a corpus generator picks the next record.
+     */
+    enum class CorpusReplayMode : std::uint8_t
+    {
+        Sequential, //!< Records in file order, wrapping around; the generator streams share one cursor.
+        Random      //!< Uniformly random records, drawn from the random source of the generator.
+    };
+
+    /**
+     * @brief Corpus files of recorded byte sequences.
+     * @details Layout (native byte order):
+     * - 8 bytes magic "TSCORPUS";
+     * - 8 bytes record count N;
+     * - (N + 1) 8-byte offsets into the data section, the first one is 0 and they never decrease;
+     * - the data section, record i being the bytes [offsets[i], offsets[i + 1]).
+     * The offsets table lets a reader map the file and reach any record without scanning it.
+     */
+    struct DataGeneratorCorpus
+    {
+        /**
+         * @brief Write a corpus file.
+         * @param path The file to write.
+         * @param sequences The records.
+         * @return True if the whole file was written.
+         */
+        static bool Write(const std::filesystem::path& path, const Helpers::ragged_array<std::byte>& sequences) noexcept;
+
+        /**
+         * @brief Record a generator run into a corpus file.
+         * @param path The file to write.
+         * @param generator The generator to record.
+         * @param count Number of records.
+         * @param min_length Minimum record length.
+         * @param max_length Maximum record length.
+         * @return True if the whole file was written.
+         */
+        static bool Write(const std::filesystem::path& path, const IDataGenerator& generator, const std::size_t count, const std::size_t min_length, const std::size_t max_length) noexcept;
+    };
+} // namespace Program::Module
+
+#endif // __MODULE_DATA_GENERATOR_CORPUS_HPP__
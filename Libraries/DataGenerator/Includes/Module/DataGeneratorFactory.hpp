@@ -3,10 +3,37 @@
 #define __MODULE_DATA_GENERATOR_FACTORY_HPP__ // clang-format on
 
  #include "Module/IDataGenerator.hpp"
+ #include "Module/DataGeneratorCorpus.hpp"
  #include <memory>
+ #include <string_view>
 
 namespace Program::Module
 {
+    /**
+     * @brief Data generator implementations.
+     */
+    enum class DataGeneratorType : std::uint8_t
+    {
+        Reference,   //!< Reseeds a Mersenne Twister from std::random_device on every call.
+        ThreadLocal, //!< One long-lived, properly seeded engine per thread.
+        Simd,        //!< Eight vectorized xoshiro256** lanes per thread, 64 bytes per step.
+        Seeded       //!< Deterministic and replayable, one non-overlapping stream per thread.
+    };
+
+    /**
+     * @brief Workload profiles: the shape of the generated bytes.
+     * @details Uniform bytes let the search engines skip almost everything; the other profiles model repetitive payloads and worst cases.
+     */
+    enum class DataGeneratorProfile : std::uint8_t
+    {
+        Uniform,  //!< Uniform bytes.
+        Zipf,     //!< Zipf distributed bytes: byte k has weight 1 / (k + 1)^1.1, so 0x00 is the most frequent.
+        Dna,      //!< Four-symbol alphabet: 'A', 'C', 'G' and 'T'.
+        Text,     //!< ASCII text with English letter, space and punctuation frequencies.
+        Periodic, //!< A random motif of 1 to 16 bytes, repeated over the whole sequence.
+        Runs      //!< Runs of 1 to 32 copies of one random byte.
+    };
+
     /**
      * @brief Factory for creating data generators.
      */
@@ -17,6 +44,45 @@ namespace Program::Module
          * @return Data generator.
          */
         static std::unique_ptr<IDataGenerator> Create() noexcept;
+
+        /**
+         * @brief Create a data generator of the given type.
+         * @param type Data generator type.
+         * @return Data generator.
+         * @note DataGeneratorType::Seeded draws its master seed from std::random_device; read it back with IDataGenerator::GetSeed.
+         */
+        static std::unique_ptr<IDataGenerator> Create(const DataGeneratorType type) noexcept;
+
+        /**
+         * @brief Create a deterministic data generator.
+         * @param seed Master seed. The same seed replays the same streams.
+         * @return Data generator.
+         */
+        static std::unique_ptr<IDataGenerator> CreateSeeded(const std::uint64_t seed) noexcept;
+
+        /**
+         * @brief Create a data generator that replays a memory-mapped corpus file.
+         * @param path Corpus file, see DataGeneratorCorpus.
+         * @param mode How the next record is picked.
+         * @param random Source of the numbers and random record indices; a thread local generator if nullptr.
+         * @return Data generator, or nullptr if the file cannot be mapped or is not a corpus file.
+         */
+        static std::unique_ptr<IDataGenerator> CreateCorpus(const std::filesystem::path& path, const CorpusReplayMode mode, std::unique_ptr<IDataGenerator>&& random = nullptr) noexcept;
+
+        /**
+         * @brief Create a data generator with a workload profile.
+         * @param profile The shape of the generated bytes.
+         * @param random Source of the randomness; a thread local generator if nullptr. Pass a seeded generator to replay the workload.
+         * @return Data generator.
+         */
+        static std::unique_ptr<IDataGenerator> CreateProfile(const DataGeneratorProfile profile, std::unique_ptr<IDataGenerator>&& random = nullptr) noexcept;
+
+        /**
+         * @brief Create a data generator by name.
+         * @param name Data generator name: "reference", "thread-local", "simd", "seeded", or a profile: "zipf", "dna", "text", "periodic", "runs".
+         * @return Data generator, or nullptr if the name is unknown.
+         */
+        static std::unique_ptr<IDataGenerator> Create(const std::string_view name) noexcept;
     };
 } // namespace Program::Module
 
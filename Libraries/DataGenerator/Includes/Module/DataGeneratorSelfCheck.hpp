@@ -0,0 +1,26 @@
+#pragma once
+#ifndef __MODULE_DATA_GENERATOR_SELF_CHECK_HPP__ // clang-format off
+#define __MODULE_DATA_GENERATOR_SELF_CHECK_HPP__ // clang-format on
+
+ #include "Module/IDataGenerator.hpp"
+
+namespace Program::Module
+{
+    /**
+     * @brief Statistical self-checks of data generators.
+     */
+    struct DataGeneratorSelfCheck
+    {
+        /**
+         * @brief Chi-square uniformity check of the bounded number generation.
+         * @details Draws with both GetRandomNumber and FillRandomNumbers over small ranges (a die, the 1..100 lengths of DataModule),
+         * the full 32-bit range, and a 3 * 2^30 wide range split into thirds: reducing 32-bit values modulo that width would put
+         * twice as many values in the first third, so a biased generator fails it by a wide margin.
+         * @param generator The generator to check.
+         * @return True if every range looks uniform.
+         */
+        static bool CheckBoundedNumbers(const IDataGenerator& generator) noexcept;
+    };
+} // namespace Program::Module
+
+#endif // __MODULE_DATA_GENERATOR_SELF_CHECK_HPP__
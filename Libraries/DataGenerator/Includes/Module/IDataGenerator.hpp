@@ -2,9 +2,13 @@
 #ifndef __INTERFACE_MODULE_DATA_GENERATOR_HPP__ // clang-format off
 #define __INTERFACE_MODULE_DATA_GENERATOR_HPP__ // clang-format on
 
+ #include "Helpers/ragged_array.hpp"
  #include <vector>
  #include <cinttypes>
  #include <cstddef>
+ #include <memory>
+ #include <optional>
+ #include <span>
 
 namespace Program::Module
 {
@@ -49,6 +53,34 @@ namespace Program::Module
          */
         virtual std::vector<std::byte> GetRandomBytes(std::size_t count) const noexcept = 0;
 
+        /**
+         * @brief Fill a caller supplied buffer with random bytes.
+         * @param buffer The buffer to fill.
+         * @note Does not allocate.
+         */
+        virtual void FillRandomBytes(std::span<std::byte> buffer) const noexcept = 0;
+
+        /**
+         * @brief Fill a reusable buffer with a random number of random bytes.
+         * @param buffer The buffer to fill. It is resized to the chosen length.
+         * @param min_count Minimum number of bytes.
+         * @param max_count Maximum number of bytes.
+         * @return The filled bytes.
+         * @note Draws the length first, like GetRandomBytes(GetRandomNumber(min_count, max_count)).
+         * @note Does not allocate once the buffer capacity reached max_count.
+         */
+        virtual std::span<std::byte> FillRandomBytes(std::vector<std::byte>& buffer, const std::size_t min_count, const std::size_t max_count) const noexcept = 0;
+
+        /**
+         * @brief Fill an arena with many random sequences of random length.
+         * @param sequences The arena to fill. Previous sequences are removed, the capacity is kept.
+         * @param count Number of sequences.
+         * @param min_length Minimum sequence length.
+         * @param max_length Maximum sequence length.
+         * @note All the lengths are drawn first, then the whole arena is filled in one pass.
+         */
+        virtual void FillRandomSequences(Helpers::ragged_array<std::byte>& sequences, const std::size_t count, const std::size_t min_length, const std::size_t max_length) const noexcept = 0;
+
         /**
          * @brief Get a random byte array within a range.
          * @param count Number of bytes.
@@ -65,6 +97,29 @@ namespace Program::Module
          * @return Random byte array.
          */
         virtual std::int32_t GetRandomNumber(const int32_t min, const int32_t max) const noexcept = 0;
+
+        /**
+         * @brief Fill a buffer with random numbers within a range.
+         * @param numbers The buffer to fill.
+         * @param min Minimum value.
+         * @param max Maximum value.
+         * @note Unbiased; meant for the hot paths that need many bounded numbers at once.
+         */
+        virtual void FillRandomNumbers(std::span<std::int32_t> numbers, const int32_t min, const int32_t max) const noexcept = 0;
+
+        /**
+         * @brief Create an independent generator stream.
+         * @param stream Stream index.
+         * @return A generator of the same kind. Seeded generators return the non-overlapping stream `stream` of their master seed.
+         * @note Give each thread its own stream to get reproducible runs.
+         */
+        virtual std::unique_ptr<IDataGenerator> CreateStream(const std::uint64_t stream) const noexcept = 0;
+
+        /**
+         * @brief Get the master seed.
+         * @return The master seed, or an empty optional if the generator is not reproducible.
+         */
+        virtual std::optional<std::uint64_t> GetSeed() const noexcept = 0;
     };
 } // namespace Program::Module
 
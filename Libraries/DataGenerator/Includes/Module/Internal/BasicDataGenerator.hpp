@@ -0,0 +1,144 @@
+#pragma once
+#ifndef __MODULE_BASIC_DATA_GENERATOR_HPP__ // clang-format off
+#define __MODULE_BASIC_DATA_GENERATOR_HPP__ // clang-format on
+
+ #include "Module/IDataGenerator.hpp"
+ #include <span>
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Base class for the engine backed data generators.
+     * @details Implements the whole IDataGenerator interface on top of two primitives: a 64-bit random word and a bulk byte fill.
+     * Derived classes only decide where the random words come from (thread local engine, seeded stream, SIMD lanes...).
+     */
+    struct BasicDataGenerator : public IDataGenerator
+    {
+        /**
+         * @brief Destructor.
+         * @note Default implementation.
+         * @note Virtual destructor.
+         */
+        virtual ~BasicDataGenerator() = default;
+
+        /**
+         * @brief Get a random byte.
+         * @return Random byte.
+         * @note Override.
+         * @note Noexcept.
+         */
+        virtual std::byte GetRandomByte() const noexcept override;
+
+        /**
+         * @brief Get a random byte within a range.
+         * @param max Maximum value.
+         * @return Random byte.
+         * @note Override.
+         * @note Noexcept.
+         */
+        virtual std::byte GetRandomByte(const std::byte max) const noexcept override;
+
+        /**
+         * @brief Get a random byte within a range.
+         * @param min Minimum value.
+         * @param max Maximum value.
+         * @return Random byte.
+         * @note Override.
+         * @note Noexcept.
+         */
+        virtual std::byte GetRandomByte(const std::byte min, const std::byte max) const noexcept override;
+
+        /**
+         * @brief Get a random byte array.
+         * @param count Number of bytes.
+         * @return Random byte array.
+         * @note Override.
+         * @note The bytes are filled in bulk through NextRandomBytes.
+         */
+        virtual std::vector<std::byte> GetRandomBytes(const std::size_t count) const noexcept override;
+
+        /**
+         * @brief Fill a caller supplied buffer with random bytes.
+         * @param buffer The buffer to fill.
+         * @note Override.
+         * @note Bulk fill through NextRandomBytes.
+         */
+        virtual void FillRandomBytes(std::span<std::byte> buffer) const noexcept override;
+
+        /**
+         * @brief Fill a reusable buffer with a random number of random bytes.
+         * @param buffer The buffer to fill.
+         * @param min_count Minimum number of bytes.
+         * @param max_count Maximum number of bytes.
+         * @return The filled bytes.
+         * @note Override.
+         * @note Noexcept.
+         */
+        virtual std::span<std::byte> FillRandomBytes(std::vector<std::byte>& buffer, const std::size_t min_count, const std::size_t max_count) const noexcept override;
+
+        /**
+         * @brief Fill an arena with many random sequences of random length.
+         * @param sequences The arena to fill.
+         * @param count Number of sequences.
+         * @param min_length Minimum sequence length.
+         * @param max_length Maximum sequence length.
+         * @note Override.
+         * @note Noexcept.
+         */
+        virtual void FillRandomSequences(Helpers::ragged_array<std::byte>& sequences, const std::size_t count, const std::size_t min_length, const std::size_t max_length) const noexcept override;
+
+        /**
+         * @brief Get a random number within a range.
+         * @param max Maximum value.
+         * @return Random number.
+         * @note Override.
+         * @note Noexcept.
+         */
+        virtual std::int32_t GetRandomNumber(const int32_t max) const noexcept override;
+
+        /**
+         * @brief Get a random number within a range.
+         * @param min Minimum value.
+         * @param max Maximum value.
+         * @return Random number.
+         * @note Override.
+         * @note Noexcept.
+         */
+        virtual std::int32_t GetRandomNumber(const int32_t min, const int32_t max) const noexcept override;
+
+        /**
+         * @brief Fill a buffer with random numbers within a range.
+         * @param numbers The buffer to fill.
+         * @param min Minimum value.
+         * @param max Maximum value.
+         * @note Override.
+         * @note Noexcept.
+         */
+        virtual void FillRandomNumbers(std::span<std::int32_t> numbers, const int32_t min, const int32_t max) const noexcept override;
+
+        /**
+         * @brief Get the master seed.
+         * @return An empty optional; seeded generators override it.
+         * @note Override.
+         * @note Noexcept.
+         */
+        virtual std::optional<std::uint64_t> GetSeed() const noexcept override;
+
+    protected:
+        /**
+         * @brief Get the next 64-bit random word.
+         * @return Random word.
+         * @note The derived class decides whether the word source may be shared between threads.
+         */
+        virtual std::uint64_t NextRandom() const noexcept = 0;
+
+        /**
+         * @brief Fill a buffer with random bytes.
+         * @param buffer The buffer to fill.
+         * @note The default implementation copies whole 64-bit words from NextRandom.
+         */
+        virtual void NextRandomBytes(std::span<std::byte> buffer) const noexcept;
+    };
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_BASIC_DATA_GENERATOR_HPP__
@@ -0,0 +1,43 @@
+#pragma once
+#ifndef __MODULE_BOUNDED_NUMBER_HPP__ // clang-format off
+#define __MODULE_BOUNDED_NUMBER_HPP__ // clang-format on
+
+ #include <cinttypes>
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Lemire's nearly divisionless bounded integer.
+     * @details Multiplies a 32-bit random value by the range width and keeps the high half.
+     * The low half only falls below the width with probability width / 2^32, and only then the
+     * (2^32 - width) % width threshold is computed and the draw may be rejected, which removes the modulo bias.
+     * @param width Range width, 0 for the full 32-bit range.
+     * @param next Source of 32-bit random values.
+     * @return A value uniformly distributed in [0, width).
+     * @see https://arxiv.org/abs/1805.10941
+     */
+    template<typename TNext>
+    inline std::uint32_t GetBoundedNumber(const std::uint32_t width, TNext&& next) noexcept
+    {
+        if ( width == 0 )
+        {
+            return next(); //!< Full range: the value itself.
+        }
+
+        std::uint64_t product = static_cast<std::uint64_t>(next()) * width;
+
+        if ( static_cast<std::uint32_t>(product) < width )
+        {
+            const std::uint32_t threshold = (0u - width) % width;
+
+            while ( static_cast<std::uint32_t>(product) < threshold )
+            {
+                product = static_cast<std::uint64_t>(next()) * width;
+            }
+        }
+
+        return static_cast<std::uint32_t>(product >> 32);
+    }
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_BOUNDED_NUMBER_HPP__
@@ -0,0 +1,148 @@
+#pragma once
+#ifndef __MODULE_CORPUS_DATA_GENERATOR_HPP__ // clang-format off
+#define __MODULE_CORPUS_DATA_GENERATOR_HPP__ // clang-format on
+
+ #include "Module/DataGeneratorCorpus.hpp"
+ #include "Module/Internal/CorpusFile.hpp"
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Corpus replay data generator.
+     * @details Serves the byte methods from the records of a memory-mapped corpus file, and every number
+     * (and ranged byte) from a wrapped random generator. Records are copied straight from the mapping into the caller buffers.
+     * @note The length-picking methods use the record length, clamped to the requested range, so captured sequences replay as recorded.
+     */
+    class CorpusDataGenerator final : public IDataGenerator
+    {
+    public:
+        /**
+         * @brief Construct a new corpus generator.
+         * @param corpus The mapped corpus, shared between the streams.
+         * @param mode How the next record is picked.
+         * @param random The random source of the numbers and of the random record indices.
+         */
+        CorpusDataGenerator(std::shared_ptr<const CorpusFile> corpus, const CorpusReplayMode mode, std::unique_ptr<IDataGenerator>&& random) noexcept;
+
+        /**
+         * @brief Destructor.
+         * @note Default implementation.
+         * @note Virtual destructor.
+         */
+        virtual ~CorpusDataGenerator() = default;
+
+        /**
+         * @brief Get the first byte of the next record.
+         * @return Recorded byte.
+         * @note Override.
+         */
+        virtual std::byte GetRandomByte() const noexcept override;
+
+        /**
+         * @brief Get a random byte within a range, from the random source.
+         * @param max Maximum value.
+         * @return Random byte.
+         * @note Override.
+         */
+        virtual std::byte GetRandomByte(const std::byte max) const noexcept override;
+
+        /**
+         * @brief Get a random byte within a range, from the random source.
+         * @param min Minimum value.
+         * @param max Maximum value.
+         * @return Random byte.
+         * @note Override.
+         */
+        virtual std::byte GetRandomByte(const std::byte min, const std::byte max) const noexcept override;
+
+        /**
+         * @brief Get recorded bytes.
+         * @param count Number of bytes.
+         * @return The next records, concatenated and cut at count bytes.
+         * @note Override.
+         */
+        virtual std::vector<std::byte> GetRandomBytes(const std::size_t count) const noexcept override;
+
+        /**
+         * @brief Fill a caller supplied buffer with recorded bytes.
+         * @param buffer The buffer to fill with the next records, concatenated and cut at the buffer size.
+         * @note Override.
+         */
+        virtual void FillRandomBytes(std::span<std::byte> buffer) const noexcept override;
+
+        /**
+         * @brief Fill a reusable buffer with the next record.
+         * @param buffer The buffer to fill.
+         * @param min_count Minimum number of bytes. Shorter records are completed with the following ones.
+         * @param max_count Maximum number of bytes. Longer records are cut.
+         * @return The filled bytes.
+         * @note Override.
+         */
+        virtual std::span<std::byte> FillRandomBytes(std::vector<std::byte>& buffer, const std::size_t min_count, const std::size_t max_count) const noexcept override;
+
+        /**
+         * @brief Fill an arena with the next records.
+         * @param sequences The arena to fill.
+         * @param count Number of sequences.
+         * @param min_length Minimum sequence length.
+         * @param max_length Maximum sequence length.
+         * @note Override. Every sequence is one record, clamped like FillRandomBytes(buffer, min_count, max_count).
+         */
+        virtual void FillRandomSequences(Helpers::ragged_array<std::byte>& sequences, const std::size_t count, const std::size_t min_length, const std::size_t max_length) const noexcept override;
+
+        /**
+         * @brief Get a random number from the random source.
+         * @param max Maximum value.
+         * @return Random number.
+         * @note Override.
+         */
+        virtual std::int32_t GetRandomNumber(const int32_t max) const noexcept override;
+
+        /**
+         * @brief Get a random number from the random source.
+         * @param min Minimum value.
+         * @param max Maximum value.
+         * @return Random number.
+         * @note Override.
+         */
+        virtual std::int32_t GetRandomNumber(const int32_t min, const int32_t max) const noexcept override;
+
+        /**
+         * @brief Fill a buffer with random numbers from the random source.
+         * @param numbers The buffer to fill.
+         * @param min Minimum value.
+         * @param max Maximum value.
+         * @note Override.
+         */
+        virtual void FillRandomNumbers(std::span<std::int32_t> numbers, const int32_t min, const int32_t max) const noexcept override;
+
+        /**
+         * @brief Create a generator over the same corpus with the stream `stream` of the random source.
+         * @param stream Stream index.
+         * @return A new corpus generator.
+         * @note Override.
+         */
+        virtual std::unique_ptr<IDataGenerator> CreateStream(const std::uint64_t stream) const noexcept override;
+
+        /**
+         * @brief Get the master seed of the random source.
+         * @return The seed, or an empty optional.
+         * @note Override.
+         */
+        virtual std::optional<std::uint64_t> GetSeed() const noexcept override;
+
+    private:
+        /**
+         * @brief Pick the next record.
+         * @return The record, empty if the corpus has no records.
+         */
+        std::span<const std::byte> GetNextRecord() const noexcept;
+
+    private:
+        std::shared_ptr<const CorpusFile> m_Corpus; //!< Mapped corpus
+        CorpusReplayMode                  m_Mode;   //!< Record selection mode
+        std::unique_ptr<IDataGenerator>   m_Random; //!< Random source
+    };
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_CORPUS_DATA_GENERATOR_HPP__
@@ -0,0 +1,75 @@
+#pragma once
+#ifndef __MODULE_CORPUS_FILE_HPP__ // clang-format off
+#define __MODULE_CORPUS_FILE_HPP__ // clang-format on
+
+ #include <atomic>
+ #include <cinttypes>
+ #include <cstddef>
+ #include <filesystem>
+ #include <memory>
+ #include <span>
+ #include <string_view>
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Read-only memory mapping of a corpus file.
+     * @details Opening only maps the file and checks the header and the size of the offsets table, so it is O(1) in the corpus size.
+     * Records are returned as views into the mapping, nothing is copied.
+     * @see DataGeneratorCorpus for the file layout.
+     */
+    class CorpusFile final
+    {
+    public:
+        static constexpr std::string_view Magic = "TSCORPUS"; //!< File magic (8 bytes, no terminator)
+
+        /**
+         * @brief Map a corpus file.
+         * @param path The file to map.
+         * @return The mapping, or nullptr if the file cannot be mapped or is not a corpus file.
+         */
+        static std::shared_ptr<CorpusFile> Open(const std::filesystem::path& path) noexcept;
+
+        /**
+         * @brief Unmap the file.
+         */
+        ~CorpusFile() noexcept;
+
+        CorpusFile(const CorpusFile&)            = delete;
+        CorpusFile& operator=(const CorpusFile&) = delete;
+
+        /**
+         * @brief Get the number of records.
+         */
+        std::uint64_t GetRecordCount() const noexcept;
+
+        /**
+         * @brief Get a record.
+         * @param index Record index, smaller than GetRecordCount().
+         * @return A view of the record inside the mapping; empty if its offsets are out of bounds.
+         */
+        std::span<const std::byte> GetRecord(const std::uint64_t index) const noexcept;
+
+        /**
+         * @brief Get the next record index of the shared sequential cursor.
+         * @return The index, wrapping around at GetRecordCount().
+         */
+        std::uint64_t GetNextSequentialIndex() const noexcept;
+
+    private:
+        /**
+         * @brief Construct an empty mapping.
+         */
+        CorpusFile() noexcept = default;
+
+    private:
+        const std::byte*                   m_Mapping{ nullptr };     //!< Start of the mapping
+        std::size_t                        m_MappingSize{ 0 };       //!< Size of the mapping
+        std::uint64_t                      m_RecordCount{ 0 };       //!< Number of records
+        const std::byte*                   m_Offsets{ nullptr };     //!< Offsets table (may be unaligned)
+        std::span<const std::byte>         m_Data;                   //!< Data section
+        mutable std::atomic<std::uint64_t> m_SequentialCursor{ 0 };  //!< Shared sequential cursor
+    };
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_CORPUS_FILE_HPP__
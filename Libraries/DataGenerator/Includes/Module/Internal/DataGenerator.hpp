@@ -65,6 +65,36 @@ namespace Program::Module::Internal
          */
         virtual std::vector<std::byte> GetRandomBytes(const std::size_t count) const noexcept override;
 
+        /**
+         * @brief Fill a caller supplied buffer with random bytes.
+         * @param buffer The buffer to fill.
+         * @note Override.
+         * @note Noexcept.
+         */
+        virtual void FillRandomBytes(std::span<std::byte> buffer) const noexcept override;
+
+        /**
+         * @brief Fill a reusable buffer with a random number of random bytes.
+         * @param buffer The buffer to fill.
+         * @param min_count Minimum number of bytes.
+         * @param max_count Maximum number of bytes.
+         * @return The filled bytes.
+         * @note Override.
+         * @note Noexcept.
+         */
+        virtual std::span<std::byte> FillRandomBytes(std::vector<std::byte>& buffer, const std::size_t min_count, const std::size_t max_count) const noexcept override;
+
+        /**
+         * @brief Fill an arena with many random sequences of random length.
+         * @param sequences The arena to fill.
+         * @param count Number of sequences.
+         * @param min_length Minimum sequence length.
+         * @param max_length Maximum sequence length.
+         * @note Override.
+         * @note Noexcept.
+         */
+        virtual void FillRandomSequences(Helpers::ragged_array<std::byte>& sequences, const std::size_t count, const std::size_t min_length, const std::size_t max_length) const noexcept override;
+
         /**
          * @brief Get a random byte array within a range.
          * @param count Number of bytes.
@@ -85,6 +115,33 @@ namespace Program::Module::Internal
          * @note Noexcept.
          */
         virtual std::int32_t GetRandomNumber(const int32_t min, const int32_t max) const noexcept override;
+
+        /**
+         * @brief Fill a buffer with random numbers within a range.
+         * @param numbers The buffer to fill.
+         * @param min Minimum value.
+         * @param max Maximum value.
+         * @note Override.
+         * @note Noexcept.
+         */
+        virtual void FillRandomNumbers(std::span<std::int32_t> numbers, const int32_t min, const int32_t max) const noexcept override;
+
+        /**
+         * @brief Create an independent generator stream.
+         * @param stream Stream index.
+         * @return A new reference generator.
+         * @note Override.
+         * @note Noexcept.
+         */
+        virtual std::unique_ptr<IDataGenerator> CreateStream(const std::uint64_t stream) const noexcept override;
+
+        /**
+         * @brief Get the master seed.
+         * @return An empty optional: every call is seeded from std::random_device.
+         * @note Override.
+         * @note Noexcept.
+         */
+        virtual std::optional<std::uint64_t> GetSeed() const noexcept override;
     };
 } // namespace Program::Module::Internal
 #endif // __MODULE_DATA_GENERATOR_HPP__
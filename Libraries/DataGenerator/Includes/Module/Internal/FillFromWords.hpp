@@ -0,0 +1,39 @@
+#pragma once
+#ifndef __MODULE_FILL_FROM_WORDS_HPP__ // clang-format off
+#define __MODULE_FILL_FROM_WORDS_HPP__ // clang-format on
+
+ #include <cinttypes>
+ #include <cstring>
+ #include <span>
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Fill a buffer with the bytes of 64-bit random words.
+     * @details Every word yields eight bytes in native order; the tail takes the leading bytes of one more word.
+     * The engine backed generators share this layout, so a seeded stream yields the same bytes whatever fills it.
+     * @param buffer The buffer to fill.
+     * @param next Source of 64-bit random words: an engine, or a callable that draws from one.
+     */
+    template<typename TNext>
+    inline void FillFromWords(std::span<std::byte> buffer, TNext&& next) noexcept
+    {
+        std::byte*     output = buffer.data();
+        std::size_t    size   = buffer.size();
+        constexpr auto word   = sizeof(std::uint64_t);
+
+        for ( ; size >= word; output += word, size -= word )
+        {
+            const std::uint64_t value = next();
+            std::memcpy(output, &value, word);
+        }
+
+        if ( size > 0 )
+        {
+            const std::uint64_t value = next();
+            std::memcpy(output, &value, size);
+        }
+    }
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_FILL_FROM_WORDS_HPP__
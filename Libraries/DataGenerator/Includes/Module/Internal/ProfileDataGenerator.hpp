@@ -0,0 +1,138 @@
+#pragma once
+#ifndef __MODULE_PROFILE_DATA_GENERATOR_HPP__ // clang-format off
+#define __MODULE_PROFILE_DATA_GENERATOR_HPP__ // clang-format on
+
+ #include "Module/DataGeneratorFactory.hpp"
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Workload profile data generator.
+     * @details Shapes the bytes of a wrapped random generator into a skewed or structured workload (see DataGeneratorProfile),
+     * while the numbers and ranged bytes stay uniform. Every call that produces a sequence starts a new one, so periodic
+     * and run-length profiles draw a fresh motif or run structure for each sequence.
+     */
+    class ProfileDataGenerator final : public IDataGenerator
+    {
+    public:
+        /**
+         * @brief Construct a new profile generator.
+         * @param profile The workload profile.
+         * @param random The random source.
+         */
+        ProfileDataGenerator(const DataGeneratorProfile profile, std::unique_ptr<IDataGenerator>&& random) noexcept;
+
+        /**
+         * @brief Destructor.
+         * @note Default implementation.
+         * @note Virtual destructor.
+         */
+        virtual ~ProfileDataGenerator() = default;
+
+        /**
+         * @brief Get a byte of the profile.
+         * @return Profile byte.
+         * @note Override.
+         */
+        virtual std::byte GetRandomByte() const noexcept override;
+
+        /**
+         * @brief Get a random byte within a range, from the random source.
+         * @param max Maximum value.
+         * @return Random byte.
+         * @note Override.
+         */
+        virtual std::byte GetRandomByte(const std::byte max) const noexcept override;
+
+        /**
+         * @brief Get a random byte within a range, from the random source.
+         * @param min Minimum value.
+         * @param max Maximum value.
+         * @return Random byte.
+         * @note Override.
+         */
+        virtual std::byte GetRandomByte(const std::byte min, const std::byte max) const noexcept override;
+
+        /**
+         * @brief Get a sequence of the profile.
+         * @param count Number of bytes.
+         * @return Profile bytes.
+         * @note Override.
+         */
+        virtual std::vector<std::byte> GetRandomBytes(const std::size_t count) const noexcept override;
+
+        /**
+         * @brief Fill a caller supplied buffer with a sequence of the profile.
+         * @param buffer The buffer to fill.
+         * @note Override.
+         */
+        virtual void FillRandomBytes(std::span<std::byte> buffer) const noexcept override;
+
+        /**
+         * @brief Fill a reusable buffer with a sequence of the profile of random length.
+         * @param buffer The buffer to fill.
+         * @param min_count Minimum number of bytes.
+         * @param max_count Maximum number of bytes.
+         * @return The filled bytes.
+         * @note Override.
+         */
+        virtual std::span<std::byte> FillRandomBytes(std::vector<std::byte>& buffer, const std::size_t min_count, const std::size_t max_count) const noexcept override;
+
+        /**
+         * @brief Fill an arena with sequences of the profile of random length.
+         * @param sequences The arena to fill.
+         * @param count Number of sequences.
+         * @param min_length Minimum sequence length.
+         * @param max_length Maximum sequence length.
+         * @note Override.
+         */
+        virtual void FillRandomSequences(Helpers::ragged_array<std::byte>& sequences, const std::size_t count, const std::size_t min_length, const std::size_t max_length) const noexcept override;
+
+        /**
+         * @brief Get a random number from the random source.
+         * @param max Maximum value.
+         * @return Random number.
+         * @note Override.
+         */
+        virtual std::int32_t GetRandomNumber(const int32_t max) const noexcept override;
+
+        /**
+         * @brief Get a random number from the random source.
+         * @param min Minimum value.
+         * @param max Maximum value.
+         * @return Random number.
+         * @note Override.
+         */
+        virtual std::int32_t GetRandomNumber(const int32_t min, const int32_t max) const noexcept override;
+
+        /**
+         * @brief Fill a buffer with random numbers from the random source.
+         * @param numbers The buffer to fill.
+         * @param min Minimum value.
+         * @param max Maximum value.
+         * @note Override.
+         */
+        virtual void FillRandomNumbers(std::span<std::int32_t> numbers, const int32_t min, const int32_t max) const noexcept override;
+
+        /**
+         * @brief Create a generator of the same profile over the stream `stream` of the random source.
+         * @param stream Stream index.
+         * @return A new profile generator.
+         * @note Override.
+         */
+        virtual std::unique_ptr<IDataGenerator> CreateStream(const std::uint64_t stream) const noexcept override;
+
+        /**
+         * @brief Get the master seed of the random source.
+         * @return The seed, or an empty optional.
+         * @note Override.
+         */
+        virtual std::optional<std::uint64_t> GetSeed() const noexcept override;
+
+    private:
+        DataGeneratorProfile            m_Profile; //!< Workload profile
+        std::unique_ptr<IDataGenerator> m_Random;  //!< Random source
+    };
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_PROFILE_DATA_GENERATOR_HPP__
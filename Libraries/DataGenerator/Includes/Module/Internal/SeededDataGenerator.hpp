@@ -0,0 +1,73 @@
+#pragma once
+#ifndef __MODULE_SEEDED_DATA_GENERATOR_HPP__ // clang-format off
+#define __MODULE_SEEDED_DATA_GENERATOR_HPP__ // clang-format on
+
+ #include "Module/Internal/BasicDataGenerator.hpp"
+ #include "Module/Internal/Xoshiro256StarStar.hpp"
+ #include <mutex>
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Seeded data generator.
+     * @details Deterministic, replayable generator. The master seed is expanded into a xoshiro256** state with SplitMix64,
+     * and stream N starts N jumps (N * 2^128 steps) further, so the streams of one seed never overlap.
+     * @note A stream may be shared between threads: the engine is locked for every draw, and every bulk fill takes the
+     * lock once. The order of the draws of different threads is not reproducible, so use CreateStream to give every
+     * thread its own stream.
+     */
+    class SeededDataGenerator final : public BasicDataGenerator
+    {
+    public:
+        /**
+         * @brief Construct a new seeded generator.
+         * @param seed Master seed.
+         * @param stream Stream index.
+         */
+        SeededDataGenerator(const std::uint64_t seed, const std::uint64_t stream) noexcept;
+
+        /**
+         * @brief Destructor.
+         * @note Default implementation.
+         * @note Virtual destructor.
+         */
+        virtual ~SeededDataGenerator() = default;
+
+        /**
+         * @brief Create the stream `stream` of the same master seed.
+         * @param stream Stream index.
+         * @return A new seeded generator.
+         * @note Override.
+         */
+        virtual std::unique_ptr<IDataGenerator> CreateStream(const std::uint64_t stream) const noexcept override;
+
+        /**
+         * @brief Get the master seed.
+         * @return The master seed.
+         * @note Override.
+         */
+        virtual std::optional<std::uint64_t> GetSeed() const noexcept override;
+
+    protected:
+        /**
+         * @brief Get the next 64-bit random word of the stream.
+         * @return Random word.
+         * @note Override.
+         */
+        virtual std::uint64_t NextRandom() const noexcept override;
+
+        /**
+         * @brief Fill a buffer with random bytes of the stream, under one lock.
+         * @param buffer The buffer to fill.
+         * @note Override.
+         */
+        virtual void NextRandomBytes(std::span<std::byte> buffer) const noexcept override;
+
+    private:
+        std::uint64_t              m_Seed;        //!< Master seed
+        mutable std::mutex         m_EngineMutex; //!< Serializes the draws of threads sharing the stream
+        mutable Xoshiro256StarStar m_Engine;      //!< Engine of this stream, guarded by m_EngineMutex
+    };
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_SEEDED_DATA_GENERATOR_HPP__
@@ -0,0 +1,81 @@
+#pragma once
+#ifndef __MODULE_SIMD_DATA_GENERATOR_HPP__ // clang-format off
+#define __MODULE_SIMD_DATA_GENERATOR_HPP__ // clang-format on
+
+ #include "Module/Internal/BasicDataGenerator.hpp"
+ #include "Helpers/cpu_features.hpp"
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief SIMD data generator.
+     * @details Runs eight interleaved xoshiro256** lanes in vector registers (AVX2 or SSE2, as the processor supports at run
+     * time, plain lanes as fallback) and produces 64 bytes per step. Each lane is a jump-ahead of the previous one, so the lanes never overlap.
+     * @note Every thread owns its own lanes; safe to call concurrently from the const interface methods.
+     */
+    struct SimdDataGenerator final : public BasicDataGenerator
+    {
+        static constexpr std::size_t LaneCount = 8;                                 //!< Number of interleaved xoshiro256** lanes
+        static constexpr std::size_t BlockSize = LaneCount * sizeof(std::uint64_t); //!< Bytes produced per vector step
+
+        /**
+         * @brief Per-thread lane state.
+         * @details Structure of arrays: m_State[word][lane], so one state word of every lane is a contiguous vector.
+         */
+        struct LaneState
+        {
+            alignas(64) std::uint64_t m_State[4][LaneCount]; //!< Lane states
+            alignas(64) std::byte m_Block[BlockSize];         //!< Last generated block, served to small requests
+            std::size_t m_Available;                          //!< Unconsumed bytes at the end of m_Block
+        };
+
+        /**
+         * @brief Block kernel: advance every lane and write blocks of BlockSize bytes.
+         * @note Every tier produces the same bytes.
+         */
+        using BlockKernel = void (*)(LaneState& lanes, std::byte* output, std::size_t blocks) noexcept;
+
+        /**
+         * @brief Bind the block kernel of a tier.
+         * @param tier The instruction set tier.
+         * @note The tier must be supported by the processor, see Helpers::resolve_cpu_tier.
+         */
+        explicit SimdDataGenerator(const Helpers::cpu_tier tier) noexcept;
+
+        /**
+         * @brief Destructor.
+         * @note Default implementation.
+         * @note Virtual destructor.
+         */
+        virtual ~SimdDataGenerator() = default;
+
+        /**
+         * @brief Create an independent generator stream.
+         * @param stream Stream index.
+         * @return A new SIMD generator; threads never share engine state anyway.
+         * @note Override.
+         */
+        virtual std::unique_ptr<IDataGenerator> CreateStream(const std::uint64_t stream) const noexcept override;
+
+    protected:
+        /**
+         * @brief Get the next 64-bit random word from the calling thread's lanes.
+         * @return Random word.
+         * @note Override.
+         */
+        virtual std::uint64_t NextRandom() const noexcept override;
+
+        /**
+         * @brief Fill a buffer with random bytes, 64 bytes per vector step.
+         * @param buffer The buffer to fill.
+         * @note Override.
+         */
+        virtual void NextRandomBytes(std::span<std::byte> buffer) const noexcept override;
+
+    private:
+        Helpers::cpu_tier m_Tier;           //!< Instruction set tier, passed on to the streams
+        BlockKernel       m_GenerateBlocks; //!< Block kernel of the tier
+    };
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_SIMD_DATA_GENERATOR_HPP__
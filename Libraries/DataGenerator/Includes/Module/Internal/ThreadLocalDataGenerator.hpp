@@ -0,0 +1,55 @@
+#pragma once
+#ifndef __MODULE_THREAD_LOCAL_DATA_GENERATOR_HPP__ // clang-format off
+#define __MODULE_THREAD_LOCAL_DATA_GENERATOR_HPP__ // clang-format on
+
+ #include "Module/Internal/BasicDataGenerator.hpp"
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Thread local data generator.
+     * @details Every thread that calls the generator owns a long-lived xoshiro256** engine.
+     * The engine is seeded once per thread from std::random_device, so the hot path never touches the entropy source again.
+     * @note Safe to call concurrently from the const interface methods: threads never share engine state.
+     */
+    struct ThreadLocalDataGenerator final : public BasicDataGenerator
+    {
+        /**
+         * @brief Default constructor.
+         * @note Noexcept.
+         */
+        ThreadLocalDataGenerator() noexcept = default;
+
+        /**
+         * @brief Destructor.
+         * @note Default implementation.
+         * @note Virtual destructor.
+         */
+        virtual ~ThreadLocalDataGenerator() = default;
+
+        /**
+         * @brief Create an independent generator stream.
+         * @param stream Stream index.
+         * @return A new thread local generator; threads never share engine state anyway.
+         * @note Override.
+         */
+        virtual std::unique_ptr<IDataGenerator> CreateStream(const std::uint64_t stream) const noexcept override;
+
+    protected:
+        /**
+         * @brief Get the next 64-bit random word from the calling thread's engine.
+         * @return Random word.
+         * @note Override.
+         */
+        virtual std::uint64_t NextRandom() const noexcept override;
+
+        /**
+         * @brief Fill a buffer with random bytes from the calling thread's engine.
+         * @param buffer The buffer to fill.
+         * @note Override. The engine is looked up once per buffer instead of once per word.
+         */
+        virtual void NextRandomBytes(std::span<std::byte> buffer) const noexcept override;
+    };
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_THREAD_LOCAL_DATA_GENERATOR_HPP__
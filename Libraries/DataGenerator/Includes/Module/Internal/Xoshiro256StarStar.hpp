@@ -0,0 +1,176 @@
+#pragma once
+#ifndef __MODULE_XOSHIRO256_STAR_STAR_HPP__ // clang-format off
+#define __MODULE_XOSHIRO256_STAR_STAR_HPP__ // clang-format on
+
+ #include <array>
+ #include <cinttypes>
+ #include <limits>
+ #include <random>
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief xoshiro256** pseudo random number engine.
+     * @details Small (32 bytes of state) and fast 64-bit engine by David Blackman and Sebastiano Vigna.
+     * The engine satisfies the UniformRandomBitGenerator requirements so it can be used with the standard distributions.
+     * @see https://prng.di.unimi.it/xoshiro256starstar.c
+     */
+    class Xoshiro256StarStar
+    {
+    public:
+        using result_type = std::uint64_t;               //!< Result type
+        using state_type  = std::array<std::uint64_t, 4>; //!< State type
+
+        /**
+         * @brief Construct a new engine from an explicit state.
+         * @param state The initial state. Must not be all zeros.
+         */
+        constexpr explicit Xoshiro256StarStar(const state_type& state) noexcept
+            : m_State{ state }
+        {
+        }
+
+        /**
+         * @brief Construct a new engine from a 64-bit seed.
+         * @details The seed is expanded into the full state with SplitMix64, as recommended by the authors.
+         * @param seed The seed.
+         */
+        constexpr explicit Xoshiro256StarStar(std::uint64_t seed) noexcept
+            : m_State{}
+        {
+            for ( std::uint64_t& word : m_State )
+            {
+                word = SplitMix64(seed);
+            }
+        }
+
+        /**
+         * @brief Construct a new engine seeded from a random device.
+         * @details The whole state is filled through a std::seed_seq so every bit of state depends on the device entropy.
+         * @param random_device The entropy source.
+         */
+        explicit Xoshiro256StarStar(std::random_device& random_device) noexcept
+            : m_State{}
+        {
+            std::array<std::uint32_t, 8> entropy{};
+            std::array<std::uint32_t, 8> words{};
+
+            for ( std::uint32_t& value : entropy )
+            {
+                value = random_device();
+            }
+
+            std::seed_seq sequence(entropy.cbegin(), entropy.cend());
+            sequence.generate(words.begin(), words.end());
+
+            for ( std::size_t index = 0; index < m_State.size(); ++index )
+            {
+                m_State[index] = (static_cast<std::uint64_t>(words[index * 2]) << 32) | words[index * 2 + 1];
+            }
+
+            if ( (m_State[0] | m_State[1] | m_State[2] | m_State[3]) == 0 )
+            {
+                m_State[0] = 1; //!< The all-zero state is the only invalid one.
+            }
+        }
+
+        /**
+         * @brief Smallest value the engine can produce.
+         */
+        static constexpr result_type min() noexcept
+        {
+            return std::numeric_limits<result_type>::min();
+        }
+
+        /**
+         * @brief Largest value the engine can produce.
+         */
+        static constexpr result_type max() noexcept
+        {
+            return std::numeric_limits<result_type>::max();
+        }
+
+        /**
+         * @brief Advance the engine and return the next 64-bit value.
+         * @return The next value.
+         */
+        constexpr result_type operator()() noexcept
+        {
+            const std::uint64_t result = RotateLeft(m_State[1] * 5, 7) * 9;
+            const std::uint64_t t      = m_State[1] << 17;
+
+            m_State[2] ^= m_State[0];
+            m_State[3] ^= m_State[1];
+            m_State[1] ^= m_State[2];
+            m_State[0] ^= m_State[3];
+            m_State[2] ^= t;
+            m_State[3] = RotateLeft(m_State[3], 45);
+
+            return result;
+        }
+
+        /**
+         * @brief Advance the engine by 2^128 steps.
+         * @details Equivalent to 2^128 calls to operator(); used to split one seed into non-overlapping streams.
+         */
+        constexpr void Jump() noexcept
+        {
+            constexpr std::uint64_t polynomial[] = { 0x180EC6D33CFD0ABA, 0xD5A61266F0C9392C, 0xA9582618E03FC9AA, 0x39ABDC4529B1661C };
+            state_type              state{};
+
+            for ( const std::uint64_t word : polynomial )
+            {
+                for ( int32_t bit = 0; bit < 64; ++bit )
+                {
+                    if ( word & (std::uint64_t{ 1 } << bit) )
+                    {
+                        state[0] ^= m_State[0];
+                        state[1] ^= m_State[1];
+                        state[2] ^= m_State[2];
+                        state[3] ^= m_State[3];
+                    }
+
+                    operator()();
+                }
+            }
+
+            m_State = state;
+        }
+
+        /**
+         * @brief Get the current state.
+         * @return The state.
+         */
+        constexpr const state_type& GetState() const noexcept
+        {
+            return m_State;
+        }
+
+        /**
+         * @brief SplitMix64 step, used to expand seeds.
+         * @param state The SplitMix64 state. It is advanced by the call.
+         * @return The next SplitMix64 value.
+         */
+        static constexpr std::uint64_t SplitMix64(std::uint64_t& state) noexcept
+        {
+            std::uint64_t z = (state += 0x9E3779B97F4A7C15);
+            z               = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+            z               = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+            return z ^ (z >> 31);
+        }
+
+    private:
+        /**
+         * @brief Rotate a 64-bit value to the left.
+         */
+        static constexpr std::uint64_t RotateLeft(const std::uint64_t value, const int32_t shift) noexcept
+        {
+            return (value << shift) | (value >> (64 - shift));
+        }
+
+    private:
+        state_type m_State; //!< Engine state
+    };
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_XOSHIRO256_STAR_STAR_HPP__
@@ -0,0 +1,49 @@
+#include "Module/DataGeneratorCorpus.hpp"
+#include "Module/Internal/CorpusFile.hpp"
+#include <fstream>
+
+/**
+ * @brief Write a corpus file.
+ * @param path The file to write.
+ * @param sequences The records.
+ * @return True if the whole file was written.
+ */
+bool Program::Module::DataGeneratorCorpus::Write(const std::filesystem::path& path, const Helpers::ragged_array<std::byte>& sequences) noexcept
+{
+    std::ofstream stream{ path, std::ios::binary | std::ios::trunc };
+
+    if ( not stream )
+    {
+        return false;
+    }
+
+    const std::uint64_t record_count = sequences.size();
+
+    stream.write(Internal::CorpusFile::Magic.data(), Internal::CorpusFile::Magic.size());
+    stream.write(reinterpret_cast<const char*>(&record_count), sizeof(record_count));
+
+    for ( const std::size_t offset : sequences.offsets() )
+    {
+        const std::uint64_t value = offset;
+        stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    stream.write(reinterpret_cast<const char*>(sequences.values().data()), static_cast<std::streamsize>(sequences.values().size()));
+    return static_cast<bool>(stream.flush());
+}
+
+/**
+ * @brief Record a generator run into a corpus file.
+ * @param path The file to write.
+ * @param generator The generator to record.
+ * @param count Number of records.
+ * @param min_length Minimum record length.
+ * @param max_length Maximum record length.
+ * @return True if the whole file was written.
+ */
+bool Program::Module::DataGeneratorCorpus::Write(const std::filesystem::path& path, const IDataGenerator& generator, const std::size_t count, const std::size_t min_length, const std::size_t max_length) noexcept
+{
+    Helpers::ragged_array<std::byte> sequences;
+    generator.FillRandomSequences(sequences, count, min_length, max_length);
+    return Write(path, sequences);
+}
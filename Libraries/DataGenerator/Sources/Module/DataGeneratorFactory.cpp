@@ -1,5 +1,11 @@
 #include "Module/DataGeneratorFactory.hpp"
 #include "Module/Internal/DataGenerator.hpp"
+#include "Module/Internal/ThreadLocalDataGenerator.hpp"
+#include "Module/Internal/SimdDataGenerator.hpp"
+#include "Module/Internal/SeededDataGenerator.hpp"
+#include "Module/Internal/CorpusDataGenerator.hpp"
+#include "Module/Internal/ProfileDataGenerator.hpp"
+#include <random>
 
 /**
  * @brief Create a new instance of the data generator.
@@ -9,3 +15,125 @@ std::unique_ptr<Program::Module::IDataGenerator> Program::Module::DataGeneratorF
 {
     return std::make_unique<Internal::DataGenerator>();
 }
+
+/**
+ * @brief Create a new instance of the data generator of the given type.
+ * @param type The data generator type.
+ * @return A new instance of the data generator.
+ */
+std::unique_ptr<Program::Module::IDataGenerator> Program::Module::DataGeneratorFactory::Create(const DataGeneratorType type) noexcept
+{
+    switch ( type )
+    {
+        case DataGeneratorType::ThreadLocal:
+            return std::make_unique<Internal::ThreadLocalDataGenerator>();
+
+        case DataGeneratorType::Simd:
+            return std::make_unique<Internal::SimdDataGenerator>(Helpers::get_cpu_tier());
+
+        case DataGeneratorType::Seeded:
+        {
+            std::random_device random_device;
+            return CreateSeeded((static_cast<std::uint64_t>(random_device()) << 32) | random_device());
+        }
+
+        case DataGeneratorType::Reference:
+        default:
+            return std::make_unique<Internal::DataGenerator>();
+    }
+}
+
+/**
+ * @brief Create a new instance of the deterministic data generator.
+ * @param seed The master seed.
+ * @return A new instance of the data generator, positioned at stream 0 of the seed.
+ */
+std::unique_ptr<Program::Module::IDataGenerator> Program::Module::DataGeneratorFactory::CreateSeeded(const std::uint64_t seed) noexcept
+{
+    return std::make_unique<Internal::SeededDataGenerator>(seed, 0);
+}
+
+/**
+ * @brief Create a new instance of the corpus replay data generator.
+ * @param path The corpus file.
+ * @param mode How the next record is picked.
+ * @param random The random source, or nullptr for a thread local generator.
+ * @return A new instance of the data generator, or nullptr if the file cannot be mapped.
+ */
+std::unique_ptr<Program::Module::IDataGenerator> Program::Module::DataGeneratorFactory::CreateCorpus(const std::filesystem::path& path, const CorpusReplayMode mode, std::unique_ptr<IDataGenerator>&& random) noexcept
+{
+    auto corpus = Internal::CorpusFile::Open(path);
+
+    if ( corpus == nullptr )
+    {
+        return nullptr;
+    }
+
+    return std::make_unique<Internal::CorpusDataGenerator>(std::move(corpus), mode, random == nullptr ? Create(DataGeneratorType::ThreadLocal) : std::move(random));
+}
+
+/**
+ * @brief Create a new instance of the data generator with a workload profile.
+ * @param profile The workload profile.
+ * @param random The random source, or nullptr for a thread local generator.
+ * @return A new instance of the data generator.
+ */
+std::unique_ptr<Program::Module::IDataGenerator> Program::Module::DataGeneratorFactory::CreateProfile(const DataGeneratorProfile profile, std::unique_ptr<IDataGenerator>&& random) noexcept
+{
+    return std::make_unique<Internal::ProfileDataGenerator>(profile, random == nullptr ? Create(DataGeneratorType::ThreadLocal) : std::move(random));
+}
+
+/**
+ * @brief Create a new instance of the data generator by name.
+ * @param name The data generator name.
+ * @return A new instance of the data generator, or nullptr if the name is unknown.
+ */
+std::unique_ptr<Program::Module::IDataGenerator> Program::Module::DataGeneratorFactory::Create(const std::string_view name) noexcept
+{
+    if ( name == "reference" )
+    {
+        return Create(DataGeneratorType::Reference);
+    }
+
+    if ( name == "thread-local" )
+    {
+        return Create(DataGeneratorType::ThreadLocal);
+    }
+
+    if ( name == "simd" )
+    {
+        return Create(DataGeneratorType::Simd);
+    }
+
+    if ( name == "seeded" )
+    {
+        return Create(DataGeneratorType::Seeded);
+    }
+
+    if ( name == "zipf" )
+    {
+        return CreateProfile(DataGeneratorProfile::Zipf);
+    }
+
+    if ( name == "dna" )
+    {
+        return CreateProfile(DataGeneratorProfile::Dna);
+    }
+
+    if ( name == "text" )
+    {
+        return CreateProfile(DataGeneratorProfile::Text);
+    }
+
+    if ( name == "periodic" )
+    {
+        return CreateProfile(DataGeneratorProfile::Periodic);
+    }
+
+    if ( name == "runs" )
+    {
+        return CreateProfile(DataGeneratorProfile::Runs);
+    }
+
+    return nullptr;
+}
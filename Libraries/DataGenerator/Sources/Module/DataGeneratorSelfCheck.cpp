@@ -0,0 +1,112 @@
+#include "Module/DataGeneratorSelfCheck.hpp"
+#include <array>
+#include <cmath>
+#include <limits>
+
+namespace
+{
+    /**
+     * @brief One range of the bounded number check.
+     */
+    struct BoundedCase
+    {
+        std::int32_t m_Min;         //!< Minimum value
+        std::int32_t m_Max;         //!< Maximum value
+        std::size_t  m_BucketCount; //!< Number of equally wide buckets the range is split into
+    };
+
+    constexpr std::size_t SampleCount = 1 << 16; //!< Draws per range and method
+    constexpr double      Threshold   = 5.0;     //!< Largest accepted z-score (about one false alarm in 3.5 million runs)
+
+    /**
+     * @brief Z-score of a chi-square statistic.
+     * @details Wilson-Hilferty approximation: (chi2 / df)^(1/3) is close to normal with mean 1 - 2 / (9 df) and variance 2 / (9 df).
+     */
+    double GetZScore(const double chi_square, const double degrees_of_freedom) noexcept
+    {
+        const double variance = 2.0 / (9.0 * degrees_of_freedom);
+        return (std::cbrt(chi_square / degrees_of_freedom) - (1.0 - variance)) / std::sqrt(variance);
+    }
+
+    /**
+     * @brief Check one range.
+     * @param test_case The range.
+     * @param draw Fills a span of numbers in the range.
+     * @return True if the bucket counts look uniform.
+     */
+    template<typename TDraw>
+    bool CheckCase(const BoundedCase& test_case, TDraw&& draw) noexcept
+    {
+        const std::uint64_t width = static_cast<std::uint64_t>(static_cast<std::int64_t>(test_case.m_Max) - test_case.m_Min + 1);
+        std::array<std::int32_t, 1024> numbers;
+        std::vector<std::uint64_t>     buckets(test_case.m_BucketCount);
+
+        for ( std::size_t drawn = 0; drawn < SampleCount; drawn += numbers.size() )
+        {
+            draw(std::span{ numbers });
+
+            for ( const std::int32_t number : numbers )
+            {
+                const std::uint64_t offset = static_cast<std::uint64_t>(static_cast<std::int64_t>(number) - test_case.m_Min);
+
+                if ( offset >= width )
+                {
+                    return false; //!< Out of range
+                }
+
+                ++buckets[offset * test_case.m_BucketCount / width];
+            }
+        }
+
+        const double expected   = static_cast<double>(SampleCount) / static_cast<double>(test_case.m_BucketCount);
+        double       chi_square = 0.0;
+
+        for ( const std::uint64_t count : buckets )
+        {
+            const double difference  = static_cast<double>(count) - expected;
+            chi_square              += difference * difference / expected;
+        }
+
+        return GetZScore(chi_square, static_cast<double>(test_case.m_BucketCount - 1)) < Threshold;
+    }
+} // namespace
+
+/**
+ * @brief Chi-square uniformity check of the bounded number generation.
+ * @param generator The generator to check.
+ * @return True if every range looks uniform.
+ */
+bool Program::Module::DataGeneratorSelfCheck::CheckBoundedNumbers(const IDataGenerator& generator) noexcept
+{
+    constexpr std::int32_t lowest  = std::numeric_limits<std::int32_t>::min();
+    constexpr std::int32_t highest = std::numeric_limits<std::int32_t>::max();
+
+    // clang-format off
+    constexpr BoundedCase cases[] =
+    {
+        {      1,                                      6,   6 },
+        {      1,                                    100, 100 },
+        { lowest,                                highest,  16 },
+        { lowest, static_cast<std::int32_t>(lowest + 3 * (std::int64_t{ 1 } << 30) - 1), 3 },
+    };
+    // clang-format on
+
+    for ( const BoundedCase& test_case : cases )
+    {
+        const auto fill   = [&](std::span<std::int32_t> numbers) { generator.FillRandomNumbers(numbers, test_case.m_Min, test_case.m_Max); };
+        const auto single = [&](std::span<std::int32_t> numbers)
+        {
+            for ( std::int32_t& number : numbers )
+            {
+                number = generator.GetRandomNumber(test_case.m_Min, test_case.m_Max);
+            }
+        };
+
+        if ( not CheckCase(test_case, fill) || not CheckCase(test_case, single) )
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
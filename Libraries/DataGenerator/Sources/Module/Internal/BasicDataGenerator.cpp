@@ -0,0 +1,198 @@
+#include "Module/Internal/BasicDataGenerator.hpp"
+#include "Module/Internal/BoundedNumber.hpp"
+#include "Module/Internal/FillFromWords.hpp"
+#include <array>
+
+namespace Program::Module::Internal
+{
+    namespace
+    {
+        /**
+         * @brief Number of values in [min, max].
+         * @return The range width modulo 2^32: 0 stands for the full 32-bit range.
+         */
+        constexpr std::uint32_t GetRangeWidth(const int32_t min, const int32_t max) noexcept
+        {
+            return static_cast<std::uint32_t>(static_cast<std::int64_t>(max) - static_cast<std::int64_t>(min) + 1);
+        }
+    } // namespace
+
+    /**
+     * @brief Generates a random byte.
+     * @return A random byte.
+     * @note The byte will be in the range of 0 to 255.
+     */
+    std::byte BasicDataGenerator::GetRandomByte() const noexcept
+    {
+        return static_cast<std::byte>(NextRandom() >> 56);
+    }
+
+    /**
+     * @brief Generates a random byte.
+     * @param max The maximum value of the byte.
+     * @return A random byte.
+     * @note The byte will be in the range of 0 to max.
+     */
+    std::byte BasicDataGenerator::GetRandomByte(const std::byte max) const noexcept
+    {
+        return GetRandomByte(std::byte{ 0 }, max);
+    }
+
+    /**
+     * @brief Generates a random byte.
+     * @param min The minimum value of the byte.
+     * @param max The maximum value of the byte.
+     * @return A random byte.
+     * @note The byte will be in the range of min to max.
+     */
+    std::byte BasicDataGenerator::GetRandomByte(const std::byte min, const std::byte max) const noexcept
+    {
+        return static_cast<std::byte>(GetRandomNumber(std::to_integer<int32_t>(min), std::to_integer<int32_t>(max)));
+    }
+
+    /**
+     * @brief Generates a random byte array.
+     * @param count The number of bytes to generate.
+     * @return A vector of random bytes.
+     * @note The bytes will be in the range of 0 to 255.
+     * @note The vector is filled with a single bulk call instead of one draw per byte.
+     */
+    std::vector<std::byte> BasicDataGenerator::GetRandomBytes(const std::size_t count) const noexcept
+    {
+        std::vector<std::byte> bytes(count);
+        NextRandomBytes(bytes);
+        return bytes;
+    }
+
+    /**
+     * @brief Fills a buffer with random bytes.
+     * @param buffer The buffer to fill.
+     * @note The bytes will be in the range of 0 to 255.
+     */
+    void BasicDataGenerator::FillRandomBytes(std::span<std::byte> buffer) const noexcept
+    {
+        NextRandomBytes(buffer);
+    }
+
+    /**
+     * @brief Fills a reusable buffer with a random number of random bytes.
+     * @param buffer The buffer to fill. It is resized to the chosen length.
+     * @param min_count The minimum number of bytes.
+     * @param max_count The maximum number of bytes.
+     * @return The filled bytes.
+     * @note The capacity is reserved up to max_count, so the buffer allocates at most once.
+     */
+    std::span<std::byte> BasicDataGenerator::FillRandomBytes(std::vector<std::byte>& buffer, const std::size_t min_count, const std::size_t max_count) const noexcept
+    {
+        buffer.reserve(max_count);
+        buffer.resize(static_cast<std::size_t>(GetRandomNumber(static_cast<int32_t>(min_count), static_cast<int32_t>(max_count))));
+        NextRandomBytes(buffer);
+        return buffer;
+    }
+
+    /**
+     * @brief Fills an arena with many random sequences of random length.
+     * @param sequences The arena to fill.
+     * @param count The number of sequences.
+     * @param min_length The minimum sequence length.
+     * @param max_length The maximum sequence length.
+     * @note The arena is reserved for the worst case, so it allocates at most once; the bytes are filled with a single bulk call.
+     */
+    void BasicDataGenerator::FillRandomSequences(Helpers::ragged_array<std::byte>& sequences, const std::size_t count, const std::size_t min_length, const std::size_t max_length) const noexcept
+    {
+        sequences.clear();
+        sequences.reserve(count, count * max_length);
+
+        for ( std::size_t index = 0; index < count; ++index )
+        {
+            sequences.emplace_back(static_cast<std::size_t>(GetRandomNumber(static_cast<int32_t>(min_length), static_cast<int32_t>(max_length))));
+        }
+
+        NextRandomBytes(sequences.values());
+    }
+
+    /**
+     * @brief Generates a random number.
+     * @param max The maximum value of the number.
+     * @return A random number.
+     * @note The number will be in the range of 0 to max.
+     */
+    std::int32_t BasicDataGenerator::GetRandomNumber(const int32_t max) const noexcept
+    {
+        return GetRandomNumber(0, max);
+    }
+
+    /**
+     * @brief Generates a random number.
+     * @param min The minimum value of the number.
+     * @param max The maximum value of the number.
+     * @return A random number.
+     * @note The number will be in the range of min to max.
+     * @note Unbiased, without building a distribution object: see GetBoundedNumber.
+     */
+    std::int32_t BasicDataGenerator::GetRandomNumber(const int32_t min, const int32_t max) const noexcept
+    {
+        std::uint64_t word = NextRandom();
+        std::int32_t  half = 0;
+        const auto    next = [this, &word, &half]() noexcept -> std::uint32_t
+        {
+            if ( half++ % 2 == 0 )
+            {
+                return static_cast<std::uint32_t>(word >> 32);
+            }
+
+            word = NextRandom(); //!< Rejected draws take the next word.
+            return static_cast<std::uint32_t>(word);
+        };
+
+        return static_cast<int32_t>(static_cast<std::int64_t>(min) + GetBoundedNumber(GetRangeWidth(min, max), next));
+    }
+
+    /**
+     * @brief Fills a buffer with random numbers.
+     * @param numbers The buffer to fill.
+     * @param min The minimum value of the numbers.
+     * @param max The maximum value of the numbers.
+     * @note The 32-bit draws are taken in blocks through NextRandomBytes, then mapped with GetBoundedNumber.
+     */
+    void BasicDataGenerator::FillRandomNumbers(std::span<std::int32_t> numbers, const int32_t min, const int32_t max) const noexcept
+    {
+        std::array<std::uint32_t, 64> block;
+        std::size_t                   position = block.size();
+        const std::uint32_t           width    = GetRangeWidth(min, max);
+        const auto                    next     = [this, &block, &position]() noexcept
+        {
+            if ( position == block.size() )
+            {
+                NextRandomBytes(std::as_writable_bytes(std::span{ block }));
+                position = 0;
+            }
+
+            return block[position++];
+        };
+
+        for ( std::int32_t& number : numbers )
+        {
+            number = static_cast<int32_t>(static_cast<std::int64_t>(min) + GetBoundedNumber(width, next));
+        }
+    }
+
+    /**
+     * @brief Gets the master seed.
+     * @return An empty optional, engines seeded from std::random_device are not reproducible.
+     */
+    std::optional<std::uint64_t> BasicDataGenerator::GetSeed() const noexcept
+    {
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Fills a buffer with random bytes.
+     * @param buffer The buffer to fill.
+     * @note Every 64-bit word yields eight bytes; the tail takes the leading bytes of one more word.
+     */
+    void BasicDataGenerator::NextRandomBytes(std::span<std::byte> buffer) const noexcept
+    {
+        FillFromWords(buffer, [this]() noexcept { return NextRandom(); });
+    }
+} // namespace Program::Module::Internal
@@ -0,0 +1,240 @@
+#include "Module/Internal/CorpusDataGenerator.hpp"
+#include "Module/Internal/BoundedNumber.hpp"
+#include <algorithm>
+#include <bit>
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Construct a new corpus generator.
+     * @param corpus The mapped corpus.
+     * @param mode How the next record is picked.
+     * @param random The random source.
+     */
+    CorpusDataGenerator::CorpusDataGenerator(std::shared_ptr<const CorpusFile> corpus, const CorpusReplayMode mode, std::unique_ptr<IDataGenerator>&& random) noexcept
+        : m_Corpus{ std::move(corpus) }
+        , m_Mode{ mode }
+        , m_Random{ std::move(random) }
+    {
+    }
+
+    /**
+     * @brief Get the first byte of the next record.
+     * @return Recorded byte.
+     * @note Consumes a whole record, like a one byte FillRandomBytes.
+     */
+    std::byte CorpusDataGenerator::GetRandomByte() const noexcept
+    {
+        std::byte value{ 0 };
+        FillRandomBytes(std::span{ &value, 1 });
+        return value;
+    }
+
+    /**
+     * @brief Get a random byte within a range.
+     * @param max Maximum value.
+     * @return Random byte.
+     * @note Forwarded to the random source: a record cannot honour the range.
+     */
+    std::byte CorpusDataGenerator::GetRandomByte(const std::byte max) const noexcept
+    {
+        return m_Random->GetRandomByte(max);
+    }
+
+    /**
+     * @brief Get a random byte within a range.
+     * @param min Minimum value.
+     * @param max Maximum value.
+     * @return Random byte.
+     * @note Forwarded to the random source: a record cannot honour the range.
+     */
+    std::byte CorpusDataGenerator::GetRandomByte(const std::byte min, const std::byte max) const noexcept
+    {
+        return m_Random->GetRandomByte(min, max);
+    }
+
+    /**
+     * @brief Get recorded bytes.
+     * @param count Number of bytes.
+     * @return The next records, concatenated and cut at count bytes.
+     */
+    std::vector<std::byte> CorpusDataGenerator::GetRandomBytes(const std::size_t count) const noexcept
+    {
+        std::vector<std::byte> bytes(count);
+        FillRandomBytes(bytes);
+        return bytes;
+    }
+
+    /**
+     * @brief Fill a caller supplied buffer with recorded bytes.
+     * @param buffer The buffer to fill.
+     * @note Falls back to the random source if the corpus only holds empty records.
+     */
+    void CorpusDataGenerator::FillRandomBytes(std::span<std::byte> buffer) const noexcept
+    {
+        std::uint64_t empty_records = 0;
+
+        while ( not buffer.empty() )
+        {
+            const std::span<const std::byte> record = GetNextRecord();
+
+            if ( record.empty() )
+            {
+                if ( ++empty_records > m_Corpus->GetRecordCount() )
+                {
+                    m_Random->FillRandomBytes(buffer);
+                    return;
+                }
+
+                continue;
+            }
+
+            const std::size_t size = std::min(buffer.size(), record.size());
+            std::copy_n(record.begin(), size, buffer.begin());
+            buffer        = buffer.subspan(size);
+            empty_records = 0;
+        }
+    }
+
+    /**
+     * @brief Fill a reusable buffer with the next record.
+     * @param buffer The buffer to fill.
+     * @param min_count Minimum number of bytes.
+     * @param max_count Maximum number of bytes.
+     * @return The filled bytes.
+     */
+    std::span<std::byte> CorpusDataGenerator::FillRandomBytes(std::vector<std::byte>& buffer, const std::size_t min_count, const std::size_t max_count) const noexcept
+    {
+        const std::span<const std::byte> record = GetNextRecord();
+        const std::size_t                size   = std::clamp(record.size(), min_count, max_count);
+        const std::size_t                copied = std::min(size, record.size());
+
+        buffer.reserve(max_count);
+        buffer.resize(size);
+        std::copy_n(record.begin(), copied, buffer.begin());
+        FillRandomBytes(std::span{ buffer }.subspan(copied));
+        return buffer;
+    }
+
+    /**
+     * @brief Fill an arena with the next records.
+     * @param sequences The arena to fill.
+     * @param count Number of sequences.
+     * @param min_length Minimum sequence length.
+     * @param max_length Maximum sequence length.
+     */
+    void CorpusDataGenerator::FillRandomSequences(Helpers::ragged_array<std::byte>& sequences, const std::size_t count, const std::size_t min_length, const std::size_t max_length) const noexcept
+    {
+        sequences.clear();
+        sequences.reserve(count, count * max_length);
+
+        for ( std::size_t index = 0; index < count; ++index )
+        {
+            const std::span<const std::byte> record   = GetNextRecord();
+            const std::span<std::byte>       sequence = sequences.emplace_back(std::clamp(record.size(), min_length, max_length));
+            const std::size_t                copied   = std::min(sequence.size(), record.size());
+
+            std::copy_n(record.begin(), copied, sequence.begin());
+            FillRandomBytes(sequence.subspan(copied));
+        }
+    }
+
+    /**
+     * @brief Get a random number within a range.
+     * @param max Maximum value.
+     * @return Random number.
+     * @note Forwarded to the random source.
+     */
+    std::int32_t CorpusDataGenerator::GetRandomNumber(const int32_t max) const noexcept
+    {
+        return m_Random->GetRandomNumber(max);
+    }
+
+    /**
+     * @brief Get a random number within a range.
+     * @param min Minimum value.
+     * @param max Maximum value.
+     * @return Random number.
+     * @note Forwarded to the random source.
+     */
+    std::int32_t CorpusDataGenerator::GetRandomNumber(const int32_t min, const int32_t max) const noexcept
+    {
+        return m_Random->GetRandomNumber(min, max);
+    }
+
+    /**
+     * @brief Fill a buffer with random numbers within a range.
+     * @param numbers The buffer to fill.
+     * @param min Minimum value.
+     * @param max Maximum value.
+     * @note Forwarded to the random source.
+     */
+    void CorpusDataGenerator::FillRandomNumbers(std::span<std::int32_t> numbers, const int32_t min, const int32_t max) const noexcept
+    {
+        m_Random->FillRandomNumbers(numbers, min, max);
+    }
+
+    /**
+     * @brief Create a generator over the same corpus with the stream `stream` of the random source.
+     * @param stream Stream index.
+     * @return A new corpus generator.
+     * @note The streams share the mapping and, in sequential mode, the cursor.
+     */
+    std::unique_ptr<IDataGenerator> CorpusDataGenerator::CreateStream(const std::uint64_t stream) const noexcept
+    {
+        return std::make_unique<CorpusDataGenerator>(m_Corpus, m_Mode, m_Random->CreateStream(stream));
+    }
+
+    /**
+     * @brief Get the master seed.
+     * @return The master seed of the random source, if it has one.
+     */
+    std::optional<std::uint64_t> CorpusDataGenerator::GetSeed() const noexcept
+    {
+        return m_Random->GetSeed();
+    }
+
+    /**
+     * @brief Pick the next record.
+     * @return The record, empty if the corpus has no records.
+     * @note Random records are drawn without modulo bias: GetBoundedNumber up to 2^32 records, and beyond that 64-bit
+     * draws masked to the next power of two and rejected past the last record.
+     */
+    std::span<const std::byte> CorpusDataGenerator::GetNextRecord() const noexcept
+    {
+        const std::uint64_t record_count = m_Corpus->GetRecordCount();
+
+        if ( record_count == 0 )
+        {
+            return {};
+        }
+
+        if ( m_Mode == CorpusReplayMode::Sequential )
+        {
+            return m_Corpus->GetRecord(m_Corpus->GetNextSequentialIndex());
+        }
+
+        if ( record_count <= (std::uint64_t{ 1 } << 32) )
+        {
+            const auto next = [this]() noexcept
+            {
+                std::uint32_t value = 0;
+                m_Random->FillRandomBytes(std::as_writable_bytes(std::span{ &value, 1 }));
+                return value;
+            };
+
+            return m_Corpus->GetRecord(GetBoundedNumber(static_cast<std::uint32_t>(record_count), next)); //!< 2^32 records wrap to width 0, the full range.
+        }
+
+        const std::uint64_t mask = std::bit_ceil(record_count) - 1;
+        std::uint64_t       word = 0;
+
+        do
+        {
+            m_Random->FillRandomBytes(std::as_writable_bytes(std::span{ &word, 1 }));
+            word &= mask;
+        } while ( word >= record_count );
+
+        return m_Corpus->GetRecord(word);
+    }
+} // namespace Program::Module::Internal
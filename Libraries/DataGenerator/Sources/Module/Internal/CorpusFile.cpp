@@ -0,0 +1,172 @@
+#include "Module/Internal/CorpusFile.hpp"
+#include <cstring>
+
+#if defined(_WIN32)
+ #define WIN32_LEAN_AND_MEAN
+ #define NOMINMAX
+ #include <Windows.h>
+#else
+ #include <fcntl.h>
+ #include <sys/mman.h>
+ #include <sys/stat.h>
+ #include <unistd.h>
+#endif
+
+namespace Program::Module::Internal
+{
+    namespace
+    {
+        constexpr std::size_t HeaderSize = 16; //!< Magic and record count
+
+        /**
+         * @brief Read an unaligned 64-bit value.
+         */
+        std::uint64_t ReadWord(const std::byte* address) noexcept
+        {
+            std::uint64_t value = 0;
+            std::memcpy(&value, address, sizeof(value));
+            return value;
+        }
+
+        /**
+         * @brief Map a whole file read-only.
+         * @param path The file to map.
+         * @param size Receives the file size.
+         * @return The mapping, or nullptr on failure or if the file is empty.
+         */
+        const std::byte* MapFile(const std::filesystem::path& path, std::size_t& size) noexcept
+        {
+#if defined(_WIN32)
+            const HANDLE file = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+            if ( file == INVALID_HANDLE_VALUE )
+            {
+                return nullptr;
+            }
+
+            LARGE_INTEGER file_size{};
+            const HANDLE  mapping = ::GetFileSizeEx(file, &file_size) && file_size.QuadPart > 0 ? ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr) : nullptr;
+            ::CloseHandle(file);
+
+            if ( mapping == nullptr )
+            {
+                return nullptr;
+            }
+
+            const void* view = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            ::CloseHandle(mapping);
+
+            size = static_cast<std::size_t>(file_size.QuadPart);
+            return static_cast<const std::byte*>(view);
+#else
+            const int32_t file = ::open(path.c_str(), O_RDONLY);
+
+            if ( file < 0 )
+            {
+                return nullptr;
+            }
+
+            struct stat status{};
+            void*       view = MAP_FAILED;
+
+            if ( ::fstat(file, &status) == 0 && status.st_size > 0 )
+            {
+                size = static_cast<std::size_t>(status.st_size);
+                view = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+            }
+
+            ::close(file);
+            return view == MAP_FAILED ? nullptr : static_cast<const std::byte*>(view);
+#endif
+        }
+
+        /**
+         * @brief Unmap a file mapped by MapFile.
+         */
+        void UnmapFile(const std::byte* mapping, [[maybe_unused]] const std::size_t size) noexcept
+        {
+#if defined(_WIN32)
+            ::UnmapViewOfFile(mapping);
+#else
+            ::munmap(const_cast<std::byte*>(mapping), size);
+#endif
+        }
+    } // namespace
+
+    /**
+     * @brief Map a corpus file.
+     * @param path The file to map.
+     * @return The mapping, or nullptr if the file cannot be mapped or is not a corpus file.
+     */
+    std::shared_ptr<CorpusFile> CorpusFile::Open(const std::filesystem::path& path) noexcept
+    {
+        std::shared_ptr<CorpusFile> corpus{ new CorpusFile{} };
+        corpus->m_Mapping = MapFile(path, corpus->m_MappingSize);
+
+        if ( corpus->m_Mapping == nullptr || corpus->m_MappingSize < HeaderSize || std::memcmp(corpus->m_Mapping, Magic.data(), Magic.size()) != 0 )
+        {
+            return nullptr;
+        }
+
+        const std::uint64_t record_count = ReadWord(corpus->m_Mapping + Magic.size());
+        const std::uint64_t table_size   = (corpus->m_MappingSize - HeaderSize) / sizeof(std::uint64_t);
+
+        if ( record_count >= table_size )
+        {
+            return nullptr; //!< The offsets table does not fit in the file.
+        }
+
+        const std::size_t data_start = HeaderSize + static_cast<std::size_t>(record_count + 1) * sizeof(std::uint64_t);
+
+        corpus->m_RecordCount = record_count;
+        corpus->m_Offsets     = corpus->m_Mapping + HeaderSize;
+        corpus->m_Data        = std::span{ corpus->m_Mapping + data_start, corpus->m_MappingSize - data_start };
+        return corpus;
+    }
+
+    /**
+     * @brief Unmap the file.
+     */
+    CorpusFile::~CorpusFile() noexcept
+    {
+        if ( m_Mapping != nullptr )
+        {
+            UnmapFile(m_Mapping, m_MappingSize);
+        }
+    }
+
+    /**
+     * @brief Get the number of records.
+     */
+    std::uint64_t CorpusFile::GetRecordCount() const noexcept
+    {
+        return m_RecordCount;
+    }
+
+    /**
+     * @brief Get a record.
+     * @param index Record index.
+     * @return A view of the record inside the mapping; empty if its offsets are out of bounds.
+     */
+    std::span<const std::byte> CorpusFile::GetRecord(const std::uint64_t index) const noexcept
+    {
+        const std::uint64_t begin = ReadWord(m_Offsets + index * sizeof(std::uint64_t));
+        const std::uint64_t end   = ReadWord(m_Offsets + (index + 1) * sizeof(std::uint64_t));
+
+        if ( begin > end || end > m_Data.size() )
+        {
+            return {};
+        }
+
+        return m_Data.subspan(static_cast<std::size_t>(begin), static_cast<std::size_t>(end - begin));
+    }
+
+    /**
+     * @brief Get the next record index of the shared sequential cursor.
+     * @return The index, wrapping around at GetRecordCount().
+     */
+    std::uint64_t CorpusFile::GetNextSequentialIndex() const noexcept
+    {
+        return m_SequentialCursor.fetch_add(1, std::memory_order_relaxed) % m_RecordCount;
+    }
+} // namespace Program::Module::Internal
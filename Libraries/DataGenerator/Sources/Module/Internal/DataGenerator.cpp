@@ -52,6 +52,50 @@ std::vector<std::byte> Program::Module::Internal::DataGenerator::GetRandomBytes(
     return bytes;
 }
 
+/**
+ * @brief Fills a buffer with random bytes.
+ * @param buffer The buffer to fill.
+ * @note The bytes will be in the range of 0 to 255.
+ */
+void Program::Module::Internal::DataGenerator::FillRandomBytes(std::span<std::byte> buffer) const noexcept
+{
+    for ( std::byte& value : buffer )
+        value = GetRandomByte();
+}
+
+/**
+ * @brief Fills a reusable buffer with a random number of random bytes.
+ * @param buffer The buffer to fill. It is resized to the chosen length.
+ * @param min_count The minimum number of bytes.
+ * @param max_count The maximum number of bytes.
+ * @return The filled bytes.
+ */
+std::span<std::byte> Program::Module::Internal::DataGenerator::FillRandomBytes(std::vector<std::byte>& buffer, const std::size_t min_count, const std::size_t max_count) const noexcept
+{
+    buffer.reserve(max_count);
+    buffer.resize(static_cast<std::size_t>(GetRandomNumber(static_cast<int32_t>(min_count), static_cast<int32_t>(max_count))));
+    FillRandomBytes(std::span{ buffer });
+    return buffer;
+}
+
+/**
+ * @brief Fills an arena with many random sequences of random length.
+ * @param sequences The arena to fill.
+ * @param count The number of sequences.
+ * @param min_length The minimum sequence length.
+ * @param max_length The maximum sequence length.
+ */
+void Program::Module::Internal::DataGenerator::FillRandomSequences(Helpers::ragged_array<std::byte>& sequences, const std::size_t count, const std::size_t min_length, const std::size_t max_length) const noexcept
+{
+    sequences.clear();
+    sequences.reserve(count, count * max_length);
+
+    for ( std::size_t index = 0; index < count; ++index )
+        sequences.emplace_back(static_cast<std::size_t>(GetRandomNumber(static_cast<int32_t>(min_length), static_cast<int32_t>(max_length))));
+
+    FillRandomBytes(sequences.values());
+}
+
 /**
  * @brief Generates a random byte array.
  * @param count The number of bytes to generate.
@@ -79,3 +123,35 @@ std::int32_t Program::Module::Internal::DataGenerator::GetRandomNumber(const int
     std::uniform_int_distribution<std::int32_t> distribution{ min, max };                   //!< Will be used to generate random numbers
     return static_cast<int32_t>(distribution(mersenne_twister_engine));                     //!< Generate a random number
 }
+
+/**
+ * @brief Fills a buffer with random numbers.
+ * @param numbers The buffer to fill.
+ * @param min The minimum value of the numbers.
+ * @param max The maximum value of the numbers.
+ * @note The numbers will be in the range of min to max.
+ */
+void Program::Module::Internal::DataGenerator::FillRandomNumbers(std::span<std::int32_t> numbers, const int32_t min, const int32_t max) const noexcept
+{
+    for ( std::int32_t& number : numbers )
+        number = GetRandomNumber(min, max);
+}
+
+/**
+ * @brief Creates an independent generator stream.
+ * @param stream The stream index. Unused: every reference generator is already independent.
+ * @return A new reference generator.
+ */
+std::unique_ptr<Program::Module::IDataGenerator> Program::Module::Internal::DataGenerator::CreateStream([[maybe_unused]] const std::uint64_t stream) const noexcept
+{
+    return std::make_unique<DataGenerator>();
+}
+
+/**
+ * @brief Gets the master seed.
+ * @return An empty optional, the reference generator is not reproducible.
+ */
+std::optional<std::uint64_t> Program::Module::Internal::DataGenerator::GetSeed() const noexcept
+{
+    return std::nullopt;
+}
@@ -0,0 +1,346 @@
+#include "Module/Internal/ProfileDataGenerator.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace Program::Module::Internal
+{
+    namespace
+    {
+        using SymbolTable = std::array<std::byte, 1 << 16>; //!< Maps a uniform 16-bit value to a symbol
+
+        constexpr double      ZipfExponent  = 1.1; //!< Zipf exponent of the byte ranks
+        constexpr int32_t     MaximumPeriod = 16;  //!< Longest motif of the periodic profile
+        constexpr int32_t     MaximumRun    = 32;  //!< Longest run of the run-length profile
+        constexpr std::size_t BlockSize     = 256; //!< Random values drawn per block
+
+        /**
+         * @brief Build a symbol table from symbol weights.
+         * @details Entry i holds the symbol whose cumulative weight interval contains (i + 0.5) / 2^16.
+         * @param symbols The symbols.
+         * @param weights The weight of each symbol.
+         */
+        template<std::size_t Count>
+        SymbolTable BuildSymbolTable(const std::array<std::byte, Count>& symbols, const std::array<double, Count>& weights) noexcept
+        {
+            SymbolTable table{};
+            double      total = 0.0;
+
+            for ( const double weight : weights )
+            {
+                total += weight;
+            }
+
+            double      cumulative = 0.0;
+            std::size_t symbol     = 0;
+
+            for ( std::size_t index = 0; index < table.size(); ++index )
+            {
+                const double position = (static_cast<double>(index) + 0.5) / static_cast<double>(table.size()) * total;
+
+                while ( symbol + 1 < Count && cumulative + weights[symbol] <= position )
+                {
+                    cumulative += weights[symbol++];
+                }
+
+                table[index] = symbols[symbol];
+            }
+
+            return table;
+        }
+
+        /**
+         * @brief Zipf distributed bytes: byte value k has rank k, weight 1 / (k + 1)^s.
+         */
+        const SymbolTable& GetZipfTable() noexcept
+        {
+            // clang-format off
+            static const SymbolTable table = []() noexcept
+            {
+                std::array<std::byte, 256> symbols{};
+                std::array<double, 256>    weights{};
+
+                for ( std::size_t rank = 0; rank < symbols.size(); ++rank )
+                {
+                    symbols[rank] = static_cast<std::byte>(rank);
+                    weights[rank] = 1.0 / std::pow(static_cast<double>(rank + 1), ZipfExponent);
+                }
+
+                return BuildSymbolTable(symbols, weights);
+            }();
+            // clang-format on
+            return table;
+        }
+
+        /**
+         * @brief ASCII text bytes, with the frequencies of English letters, spaces and punctuation.
+         */
+        const SymbolTable& GetTextTable() noexcept
+        {
+            // clang-format off
+            static const SymbolTable table = []() noexcept
+            {
+                constexpr std::string_view letters = " etaoinshrdlcumwfgypbvkjxqz.,\n";
+                constexpr std::array<double, 30> weights =
+                {
+                    180.0, 102.0, 75.0, 65.0, 62.0, 57.0, 57.0, 53.0, 50.0, 49.0, 35.0, 33.0, 22.0, 23.0, 20.0,
+                     19.0,  18.0, 16.0, 16.0, 15.0, 12.0,  8.0,  6.0,  1.0,  1.0,  1.0,  1.0, 10.0, 10.0,  5.0,
+                };
+                std::array<std::byte, 30> symbols{};
+                std::transform(letters.cbegin(), letters.cend(), symbols.begin(), [](const char letter) { return static_cast<std::byte>(letter); });
+                return BuildSymbolTable(symbols, weights);
+            }();
+            // clang-format on
+            return table;
+        }
+
+        /**
+         * @brief Map 16-bit random values through a symbol table.
+         */
+        void FillFromTable(std::span<std::byte> buffer, const SymbolTable& table, const IDataGenerator& random) noexcept
+        {
+            std::array<std::uint16_t, BlockSize> block;
+
+            while ( not buffer.empty() )
+            {
+                const std::size_t count = std::min(buffer.size(), block.size());
+                random.FillRandomBytes(std::as_writable_bytes(std::span{ block }.first(count)));
+                std::transform(block.cbegin(), block.cbegin() + count, buffer.begin(), [&table](const std::uint16_t value) { return table[value]; });
+                buffer = buffer.subspan(count);
+            }
+        }
+
+        /**
+         * @brief Four-symbol DNA-like bytes: two random bits per symbol.
+         */
+        void FillDna(std::span<std::byte> buffer, const IDataGenerator& random) noexcept
+        {
+            constexpr std::array<std::byte, 4> bases = { std::byte{ 'A' }, std::byte{ 'C' }, std::byte{ 'G' }, std::byte{ 'T' } };
+
+            random.FillRandomBytes(buffer);
+
+            for ( std::byte& value : buffer )
+            {
+                value = bases[std::to_integer<std::size_t>(value) & 3];
+            }
+        }
+
+        /**
+         * @brief Periodic bytes: a random motif of 1 to MaximumPeriod bytes, repeated.
+         */
+        void FillPeriodic(std::span<std::byte> buffer, const IDataGenerator& random) noexcept
+        {
+            const std::size_t period = std::min(buffer.size(), static_cast<std::size_t>(random.GetRandomNumber(1, MaximumPeriod)));
+            random.FillRandomBytes(buffer.first(period));
+
+            for ( std::size_t index = period; index < buffer.size(); ++index )
+            {
+                buffer[index] = buffer[index - period];
+            }
+        }
+
+        /**
+         * @brief Run-length heavy bytes: runs of one random byte, 1 to MaximumRun bytes long.
+         */
+        void FillRuns(std::span<std::byte> buffer, const IDataGenerator& random) noexcept
+        {
+            while ( not buffer.empty() )
+            {
+                const std::size_t length = std::min(buffer.size(), static_cast<std::size_t>(random.GetRandomNumber(1, MaximumRun)));
+                std::fill_n(buffer.begin(), length, random.GetRandomByte(std::byte{ 255 }));
+                buffer = buffer.subspan(length);
+            }
+        }
+    } // namespace
+
+    /**
+     * @brief Construct a new profile generator.
+     * @param profile The workload profile.
+     * @param random The random source.
+     */
+    ProfileDataGenerator::ProfileDataGenerator(const DataGeneratorProfile profile, std::unique_ptr<IDataGenerator>&& random) noexcept
+        : m_Profile{ profile }
+        , m_Random{ std::move(random) }
+    {
+    }
+
+    /**
+     * @brief Get a byte of the profile.
+     * @return Profile byte.
+     * @note A one byte FillRandomBytes: the periodic and run-length profiles start a new sequence for it.
+     */
+    std::byte ProfileDataGenerator::GetRandomByte() const noexcept
+    {
+        std::byte value{ 0 };
+        FillRandomBytes(std::span{ &value, 1 });
+        return value;
+    }
+
+    /**
+     * @brief Get a random byte within a range.
+     * @param max Maximum value.
+     * @return Random byte.
+     * @note Forwarded to the random source: a profile cannot honour the range.
+     */
+    std::byte ProfileDataGenerator::GetRandomByte(const std::byte max) const noexcept
+    {
+        return m_Random->GetRandomByte(max);
+    }
+
+    /**
+     * @brief Get a random byte within a range.
+     * @param min Minimum value.
+     * @param max Maximum value.
+     * @return Random byte.
+     * @note Forwarded to the random source: a profile cannot honour the range.
+     */
+    std::byte ProfileDataGenerator::GetRandomByte(const std::byte min, const std::byte max) const noexcept
+    {
+        return m_Random->GetRandomByte(min, max);
+    }
+
+    /**
+     * @brief Get a sequence of the profile.
+     * @param count Number of bytes.
+     * @return Profile bytes.
+     */
+    std::vector<std::byte> ProfileDataGenerator::GetRandomBytes(const std::size_t count) const noexcept
+    {
+        std::vector<std::byte> bytes(count);
+        FillRandomBytes(bytes);
+        return bytes;
+    }
+
+    /**
+     * @brief Fill a caller supplied buffer with a sequence of the profile.
+     * @param buffer The buffer to fill.
+     */
+    void ProfileDataGenerator::FillRandomBytes(std::span<std::byte> buffer) const noexcept
+    {
+        if ( buffer.empty() )
+        {
+            return;
+        }
+
+        switch ( m_Profile )
+        {
+            case DataGeneratorProfile::Zipf:
+                FillFromTable(buffer, GetZipfTable(), *m_Random);
+                break;
+
+            case DataGeneratorProfile::Dna:
+                FillDna(buffer, *m_Random);
+                break;
+
+            case DataGeneratorProfile::Text:
+                FillFromTable(buffer, GetTextTable(), *m_Random);
+                break;
+
+            case DataGeneratorProfile::Periodic:
+                FillPeriodic(buffer, *m_Random);
+                break;
+
+            case DataGeneratorProfile::Runs:
+                FillRuns(buffer, *m_Random);
+                break;
+
+            case DataGeneratorProfile::Uniform:
+            default:
+                m_Random->FillRandomBytes(buffer);
+                break;
+        }
+    }
+
+    /**
+     * @brief Fill a reusable buffer with a sequence of the profile of random length.
+     * @param buffer The buffer to fill.
+     * @param min_count Minimum number of bytes.
+     * @param max_count Maximum number of bytes.
+     * @return The filled bytes.
+     * @note The length is drawn from the random source first, like the engine generators do.
+     */
+    std::span<std::byte> ProfileDataGenerator::FillRandomBytes(std::vector<std::byte>& buffer, const std::size_t min_count, const std::size_t max_count) const noexcept
+    {
+        buffer.reserve(max_count);
+        buffer.resize(static_cast<std::size_t>(m_Random->GetRandomNumber(static_cast<int32_t>(min_count), static_cast<int32_t>(max_count))));
+        FillRandomBytes(std::span{ buffer });
+        return buffer;
+    }
+
+    /**
+     * @brief Fill an arena with sequences of the profile of random length.
+     * @param sequences The arena to fill.
+     * @param count Number of sequences.
+     * @param min_length Minimum sequence length.
+     * @param max_length Maximum sequence length.
+     * @note The random source lays out the arena, then every sequence is reshaped on its own.
+     */
+    void ProfileDataGenerator::FillRandomSequences(Helpers::ragged_array<std::byte>& sequences, const std::size_t count, const std::size_t min_length, const std::size_t max_length) const noexcept
+    {
+        m_Random->FillRandomSequences(sequences, count, min_length, max_length);
+
+        if ( m_Profile == DataGeneratorProfile::Uniform )
+        {
+            return;
+        }
+
+        for ( const std::span<std::byte> sequence : sequences )
+        {
+            FillRandomBytes(sequence);
+        }
+    }
+
+    /**
+     * @brief Get a random number within a range.
+     * @param max Maximum value.
+     * @return Random number.
+     * @note Forwarded to the random source.
+     */
+    std::int32_t ProfileDataGenerator::GetRandomNumber(const int32_t max) const noexcept
+    {
+        return m_Random->GetRandomNumber(max);
+    }
+
+    /**
+     * @brief Get a random number within a range.
+     * @param min Minimum value.
+     * @param max Maximum value.
+     * @return Random number.
+     * @note Forwarded to the random source.
+     */
+    std::int32_t ProfileDataGenerator::GetRandomNumber(const int32_t min, const int32_t max) const noexcept
+    {
+        return m_Random->GetRandomNumber(min, max);
+    }
+
+    /**
+     * @brief Fill a buffer with random numbers within a range.
+     * @param numbers The buffer to fill.
+     * @param min Minimum value.
+     * @param max Maximum value.
+     * @note Forwarded to the random source.
+     */
+    void ProfileDataGenerator::FillRandomNumbers(std::span<std::int32_t> numbers, const int32_t min, const int32_t max) const noexcept
+    {
+        m_Random->FillRandomNumbers(numbers, min, max);
+    }
+
+    /**
+     * @brief Create a generator of the same profile over the stream `stream` of the random source.
+     * @param stream Stream index.
+     * @return A new profile generator.
+     */
+    std::unique_ptr<IDataGenerator> ProfileDataGenerator::CreateStream(const std::uint64_t stream) const noexcept
+    {
+        return std::make_unique<ProfileDataGenerator>(m_Profile, m_Random->CreateStream(stream));
+    }
+
+    /**
+     * @brief Get the master seed of the random source.
+     * @return The seed, or an empty optional.
+     */
+    std::optional<std::uint64_t> ProfileDataGenerator::GetSeed() const noexcept
+    {
+        return m_Random->GetSeed();
+    }
+} // namespace Program::Module::Internal
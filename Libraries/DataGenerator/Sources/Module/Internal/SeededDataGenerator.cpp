@@ -0,0 +1,61 @@
+#include "Module/Internal/SeededDataGenerator.hpp"
+#include "Module/Internal/FillFromWords.hpp"
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Construct a new seeded generator.
+     * @param seed Master seed.
+     * @param stream Stream index. The engine is jumped ahead `stream` times.
+     */
+    SeededDataGenerator::SeededDataGenerator(const std::uint64_t seed, const std::uint64_t stream) noexcept
+        : m_Seed{ seed }
+        , m_EngineMutex{}
+        , m_Engine{ seed }
+    {
+        for ( std::uint64_t index = 0; index < stream; ++index )
+        {
+            m_Engine.Jump();
+        }
+    }
+
+    /**
+     * @brief Create the stream `stream` of the same master seed.
+     * @param stream Stream index.
+     * @return A new seeded generator.
+     */
+    std::unique_ptr<IDataGenerator> SeededDataGenerator::CreateStream(const std::uint64_t stream) const noexcept
+    {
+        return std::make_unique<SeededDataGenerator>(m_Seed, stream);
+    }
+
+    /**
+     * @brief Get the master seed.
+     * @return The master seed.
+     */
+    std::optional<std::uint64_t> SeededDataGenerator::GetSeed() const noexcept
+    {
+        return m_Seed;
+    }
+
+    /**
+     * @brief Get the next 64-bit random word.
+     * @return Random word.
+     */
+    std::uint64_t SeededDataGenerator::NextRandom() const noexcept
+    {
+        std::lock_guard lock{ m_EngineMutex };
+        return m_Engine();
+    }
+
+    /**
+     * @brief Fill a buffer with random bytes of the stream.
+     * @param buffer The buffer to fill.
+     * @note Same bytes as the word by word default, see FillFromWords.
+     */
+    void SeededDataGenerator::NextRandomBytes(std::span<std::byte> buffer) const noexcept
+    {
+        std::lock_guard lock{ m_EngineMutex };
+        FillFromWords(buffer, m_Engine);
+    }
+} // namespace Program::Module::Internal
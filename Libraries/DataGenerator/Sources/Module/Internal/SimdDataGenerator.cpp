@@ -0,0 +1,274 @@
+#include "Module/Internal/SimdDataGenerator.hpp"
+#include "Module/Internal/Xoshiro256StarStar.hpp"
+#include <algorithm>
+#include <cstring>
+
+#if defined(__HELPER_CPU_FEATURES_X86__)
+ #include <immintrin.h>
+#endif
+
+namespace Program::Module::Internal
+{
+    namespace
+    {
+        constexpr std::size_t LaneCount = SimdDataGenerator::LaneCount; //!< Number of interleaved xoshiro256** lanes
+        constexpr std::size_t BlockSize = SimdDataGenerator::BlockSize; //!< Bytes produced per vector step
+
+        /**
+         * @brief Rotate a 64-bit value to the left.
+         */
+        constexpr std::uint64_t RotateLeft(const std::uint64_t value, const int32_t shift) noexcept
+        {
+            return (value << shift) | (value >> (64 - shift));
+        }
+
+        /**
+         * @brief Generate blocks of 64 bytes, one lane at a time (portable fallback).
+         */
+        void GenerateBlocksScalar(SimdDataGenerator::LaneState& lanes, std::byte* output, std::size_t blocks) noexcept
+        {
+            auto& state = lanes.m_State;
+
+            for ( ; blocks > 0; --blocks, output += BlockSize )
+            {
+                for ( std::size_t lane = 0; lane < LaneCount; ++lane )
+                {
+                    const std::uint64_t result = RotateLeft(state[1][lane] * 5, 7) * 9;
+                    const std::uint64_t t      = state[1][lane] << 17;
+
+                    state[2][lane] ^= state[0][lane];
+                    state[3][lane] ^= state[1][lane];
+                    state[1][lane] ^= state[2][lane];
+                    state[0][lane] ^= state[3][lane];
+                    state[2][lane] ^= t;
+                    state[3][lane] = RotateLeft(state[3][lane], 45);
+
+                    std::memcpy(output + lane * sizeof(std::uint64_t), &result, sizeof(result));
+                }
+            }
+        }
+
+#if defined(__HELPER_CPU_FEATURES_X86__)
+        /**
+         * @brief Rotate every 64-bit lane to the left.
+         */
+        template<int32_t Shift>
+        HELPERS_TARGET_AVX2 inline __m256i RotateLeft(const __m256i value) noexcept
+        {
+            return _mm256_or_si256(_mm256_slli_epi64(value, Shift), _mm256_srli_epi64(value, 64 - Shift));
+        }
+
+        /**
+         * @brief Generate blocks of 64 bytes with two AVX2 registers per state word.
+         */
+        HELPERS_TARGET_AVX2 void GenerateBlocksAvx2(SimdDataGenerator::LaneState& lanes, std::byte* output, std::size_t blocks) noexcept
+        {
+            __m256i state[4][2];
+
+            for ( std::size_t word = 0; word < 4; ++word )
+            {
+                state[word][0] = _mm256_load_si256(reinterpret_cast<const __m256i*>(&lanes.m_State[word][0]));
+                state[word][1] = _mm256_load_si256(reinterpret_cast<const __m256i*>(&lanes.m_State[word][4]));
+            }
+
+            for ( ; blocks > 0; --blocks, output += BlockSize )
+            {
+                for ( std::size_t half = 0; half < 2; ++half )
+                {
+                    const __m256i times5 = _mm256_add_epi64(_mm256_slli_epi64(state[1][half], 2), state[1][half]);
+                    const __m256i rotate = RotateLeft<7>(times5);
+                    const __m256i result = _mm256_add_epi64(_mm256_slli_epi64(rotate, 3), rotate);
+                    const __m256i t      = _mm256_slli_epi64(state[1][half], 17);
+
+                    state[2][half] = _mm256_xor_si256(state[2][half], state[0][half]);
+                    state[3][half] = _mm256_xor_si256(state[3][half], state[1][half]);
+                    state[1][half] = _mm256_xor_si256(state[1][half], state[2][half]);
+                    state[0][half] = _mm256_xor_si256(state[0][half], state[3][half]);
+                    state[2][half] = _mm256_xor_si256(state[2][half], t);
+                    state[3][half] = RotateLeft<45>(state[3][half]);
+
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + half * sizeof(__m256i)), result);
+                }
+            }
+
+            for ( std::size_t word = 0; word < 4; ++word )
+            {
+                _mm256_store_si256(reinterpret_cast<__m256i*>(&lanes.m_State[word][0]), state[word][0]);
+                _mm256_store_si256(reinterpret_cast<__m256i*>(&lanes.m_State[word][4]), state[word][1]);
+            }
+        }
+
+        /**
+         * @brief Rotate every 64-bit lane to the left.
+         */
+        template<int32_t Shift>
+        HELPERS_TARGET_SSE2 inline __m128i RotateLeft(const __m128i value) noexcept
+        {
+            return _mm_or_si128(_mm_slli_epi64(value, Shift), _mm_srli_epi64(value, 64 - Shift));
+        }
+
+        /**
+         * @brief Generate blocks of 64 bytes with four SSE2 registers per state word.
+         */
+        HELPERS_TARGET_SSE2 void GenerateBlocksSse2(SimdDataGenerator::LaneState& lanes, std::byte* output, std::size_t blocks) noexcept
+        {
+            __m128i state[4][4];
+
+            for ( std::size_t word = 0; word < 4; ++word )
+            {
+                for ( std::size_t quarter = 0; quarter < 4; ++quarter )
+                {
+                    state[word][quarter] = _mm_load_si128(reinterpret_cast<const __m128i*>(&lanes.m_State[word][quarter * 2]));
+                }
+            }
+
+            for ( ; blocks > 0; --blocks, output += BlockSize )
+            {
+                for ( std::size_t quarter = 0; quarter < 4; ++quarter )
+                {
+                    const __m128i times5 = _mm_add_epi64(_mm_slli_epi64(state[1][quarter], 2), state[1][quarter]);
+                    const __m128i rotate = RotateLeft<7>(times5);
+                    const __m128i result = _mm_add_epi64(_mm_slli_epi64(rotate, 3), rotate);
+                    const __m128i t      = _mm_slli_epi64(state[1][quarter], 17);
+
+                    state[2][quarter] = _mm_xor_si128(state[2][quarter], state[0][quarter]);
+                    state[3][quarter] = _mm_xor_si128(state[3][quarter], state[1][quarter]);
+                    state[1][quarter] = _mm_xor_si128(state[1][quarter], state[2][quarter]);
+                    state[0][quarter] = _mm_xor_si128(state[0][quarter], state[3][quarter]);
+                    state[2][quarter] = _mm_xor_si128(state[2][quarter], t);
+                    state[3][quarter] = RotateLeft<45>(state[3][quarter]);
+
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(output + quarter * sizeof(__m128i)), result);
+                }
+            }
+
+            for ( std::size_t word = 0; word < 4; ++word )
+            {
+                for ( std::size_t quarter = 0; quarter < 4; ++quarter )
+                {
+                    _mm_store_si128(reinterpret_cast<__m128i*>(&lanes.m_State[word][quarter * 2]), state[word][quarter]);
+                }
+            }
+        }
+#endif
+
+        /**
+         * @brief Get the block kernel of a tier.
+         * @param tier The instruction set tier. AVX-512 gets the AVX2 kernel: eight lanes fill two 256-bit registers.
+         * @return The kernel. Every tier produces the same bytes.
+         */
+        SimdDataGenerator::BlockKernel GetBlockKernel(const Helpers::cpu_tier tier) noexcept
+        {
+            switch ( tier )
+            {
+#if defined(__HELPER_CPU_FEATURES_X86__)
+                case Helpers::cpu_tier::avx512:
+                case Helpers::cpu_tier::avx2:
+                    return &GenerateBlocksAvx2;
+
+                case Helpers::cpu_tier::sse2:
+                    return &GenerateBlocksSse2;
+#endif
+
+                case Helpers::cpu_tier::scalar:
+                default:
+                    return &GenerateBlocksScalar;
+            }
+        }
+
+        /**
+         * @brief Get the lanes of the calling thread.
+         * @return The thread local lanes, seeded on first use.
+         * @note Lane N starts N jumps (N * 2^128 steps) after lane 0.
+         */
+        SimdDataGenerator::LaneState& GetThreadLanes() noexcept
+        {
+            // clang-format off
+            thread_local SimdDataGenerator::LaneState lanes = []() noexcept
+            {
+                std::random_device random_device; //!< Only used once per thread, to seed the lanes
+                Xoshiro256StarStar engine{ random_device };
+                SimdDataGenerator::LaneState state{};
+
+                for ( std::size_t lane = 0; lane < LaneCount; ++lane, engine.Jump() )
+                {
+                    for ( std::size_t word = 0; word < 4; ++word )
+                    {
+                        state.m_State[word][lane] = engine.GetState()[word];
+                    }
+                }
+
+                return state;
+            }();
+            // clang-format on
+            return lanes;
+        }
+    } // namespace
+
+    /**
+     * @brief Bind the block kernel of a tier.
+     * @param tier The instruction set tier.
+     */
+    SimdDataGenerator::SimdDataGenerator(const Helpers::cpu_tier tier) noexcept
+        : m_Tier{ tier }
+        , m_GenerateBlocks{ GetBlockKernel(tier) }
+    {
+    }
+
+    /**
+     * @brief Create an independent generator stream.
+     * @param stream Stream index. Unused: the engines are already per thread.
+     * @return A new SIMD generator of the same tier.
+     */
+    std::unique_ptr<IDataGenerator> SimdDataGenerator::CreateStream([[maybe_unused]] const std::uint64_t stream) const noexcept
+    {
+        return std::make_unique<SimdDataGenerator>(m_Tier);
+    }
+
+    /**
+     * @brief Get the next 64-bit random word.
+     * @return Random word.
+     */
+    std::uint64_t SimdDataGenerator::NextRandom() const noexcept
+    {
+        std::uint64_t value = 0;
+        NextRandomBytes(std::span{ reinterpret_cast<std::byte*>(&value), sizeof(value) });
+        return value;
+    }
+
+    /**
+     * @brief Fill a buffer with random bytes.
+     * @param buffer The buffer to fill.
+     * @note Leftovers of the last block are served first, whole blocks are written straight into the buffer,
+     * and the tail is cut from a fresh block whose remainder is kept for the next call.
+     */
+    void SimdDataGenerator::NextRandomBytes(std::span<std::byte> buffer) const noexcept
+    {
+        LaneState&  lanes  = GetThreadLanes();
+        std::byte*  output = buffer.data();
+        std::size_t size   = buffer.size();
+
+        if ( const std::size_t cached = std::min(size, lanes.m_Available); cached > 0 )
+        {
+            std::memcpy(output, lanes.m_Block + (BlockSize - lanes.m_Available), cached);
+            lanes.m_Available -= cached;
+            output            += cached;
+            size              -= cached;
+        }
+
+        if ( size >= BlockSize )
+        {
+            const std::size_t blocks = size / BlockSize;
+            m_GenerateBlocks(lanes, output, blocks);
+            output += blocks * BlockSize;
+            size   -= blocks * BlockSize;
+        }
+
+        if ( size > 0 )
+        {
+            m_GenerateBlocks(lanes, lanes.m_Block, 1);
+            std::memcpy(output, lanes.m_Block, size);
+            lanes.m_Available = BlockSize - size;
+        }
+    }
+} // namespace Program::Module::Internal
@@ -0,0 +1,53 @@
+#include "Module/Internal/ThreadLocalDataGenerator.hpp"
+#include "Module/Internal/FillFromWords.hpp"
+#include "Module/Internal/Xoshiro256StarStar.hpp"
+
+namespace Program::Module::Internal
+{
+    namespace
+    {
+        /**
+         * @brief Get the engine of the calling thread.
+         * @return The thread local engine, seeded on first use.
+         */
+        Xoshiro256StarStar& GetThreadEngine() noexcept
+        {
+            // clang-format off
+            thread_local Xoshiro256StarStar engine = []() noexcept
+            {
+                std::random_device random_device; //!< Only used once per thread, to seed the engine
+                return Xoshiro256StarStar{ random_device };
+            }();
+            // clang-format on
+            return engine; //!< Long-lived engine stream of the calling thread
+        }
+    } // namespace
+
+    /**
+     * @brief Create an independent generator stream.
+     * @param stream Stream index. Unused: the engines are already per thread.
+     * @return A new thread local generator.
+     */
+    std::unique_ptr<IDataGenerator> ThreadLocalDataGenerator::CreateStream([[maybe_unused]] const std::uint64_t stream) const noexcept
+    {
+        return std::make_unique<ThreadLocalDataGenerator>();
+    }
+
+    /**
+     * @brief Get the next 64-bit random word.
+     * @return Random word.
+     */
+    std::uint64_t ThreadLocalDataGenerator::NextRandom() const noexcept
+    {
+        return GetThreadEngine()();
+    }
+
+    /**
+     * @brief Fill a buffer with random bytes.
+     * @param buffer The buffer to fill.
+     */
+    void ThreadLocalDataGenerator::NextRandomBytes(std::span<std::byte> buffer) const noexcept
+    {
+        FillFromWords(buffer, GetThreadEngine());
+    }
+} // namespace Program::Module::Internal
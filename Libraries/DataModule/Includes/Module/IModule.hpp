@@ -4,6 +4,7 @@
 
  #include "Module/IDataGenerator.hpp"
  #include "Module/IDataSearchEngine.hpp"
+ #include "Module/DataSearchIndex.hpp"
  #include "Module/IDataPrintingEngine.hpp"
  #include <memory>
  #include <chrono>
@@ -77,6 +78,18 @@ namespace Program::Module
          * @brief PrintResults method prints the results.
          */
         virtual void PrintResults() const noexcept = 0;
+
+        /**
+         * @brief GetSeed method gets the master seed of the DataGenerator object.
+         * @return std::optional<std::uint64_t> - The seed to replay the run with, or empty if the generator is not reproducible.
+         */
+        virtual std::optional<std::uint64_t> GetSeed() const noexcept = 0;
+
+        /**
+         * @brief GetResultsIndex method gets a suffix array index of the results.
+         * @return std::shared_ptr<const DataSearchIndex> - A snapshot of the index of every result found so far; source i is the i-th result found.
+         */
+        virtual std::shared_ptr<const DataSearchIndex> GetResultsIndex() const noexcept = 0;
     };
 } // namespace Program::Module
 
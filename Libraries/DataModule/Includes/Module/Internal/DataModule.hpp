@@ -99,6 +99,21 @@ namespace Program::Module::Internal
          */
         void PrintResults() const noexcept override;
 
+        /**
+         * @brief Get the master seed of the data generator.
+         * @return The seed to replay the run with, or an empty optional if the generator is not reproducible.
+         * @note With the same seed and thread count, RunAsync generates the same input data and sources.
+         */
+        std::optional<std::uint64_t> GetSeed() const noexcept override;
+
+        /**
+         * @brief Get a suffix array index of the results.
+         * @return A snapshot of the index of every result found so far.
+         * @note Built on demand from the results: the ones found since the previous call are added as one batch. The index
+         * is only copied first if a snapshot returned earlier is still held, so such a snapshot stays valid and unchanged.
+         */
+        std::shared_ptr<const DataSearchIndex> GetResultsIndex() const noexcept override;
+
     private:
         /**
          * @brief Clear the threads.
@@ -122,10 +137,11 @@ namespace Program::Module::Internal
 
         /**
          * @brief Generate the bytes.
+         * @param generator The generator stream to draw from.
          * @return The bytes.
          * @note The GenerateBytes method generates the bytes that will be searched for.
          */
-        std::vector<std::byte> GenerateBytes() const noexcept;
+        static std::vector<std::byte> GenerateBytes(const IDataGenerator& generator) noexcept;
 
     private:
         std::unique_ptr<IDataGenerator>                                      m_DataGenerator;      //!< The data generator. Used to generate data that will be searched for.
@@ -135,6 +151,9 @@ namespace Program::Module::Internal
         std::vector<std::thread>                                             m_Threads;            //!< The threads that are used to generate and search for data.
         mutable std::vector<std::tuple<std::time_t, std::vector<std::byte>>> m_Results;            //!< The results of the search engine. Used to store the results of the search engine.
         mutable std::mutex                                                   m_ResultsMutex;       //!< The results mutex. Used to protect the results of the search engine.
+        mutable std::size_t                                                  m_IndexedResults;     //!< The number of results in the results index, the first ones of the results. Protected by the results mutex.
+        mutable std::shared_ptr<DataSearchIndex>                             m_ResultsIndex;       //!< The index of the results found before the last GetResultsIndex call, built on demand.
+        mutable std::mutex                                                   m_ResultsIndexMutex;  //!< The results index mutex. Serializes the merges, without blocking the threads that add results.
     };
 } // namespace Program::Module::Internal
 
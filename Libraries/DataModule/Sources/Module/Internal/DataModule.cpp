@@ -1,6 +1,7 @@
 #include "Module/Internal/DataModule.hpp"
 #include "Module/DataGeneratorFactory.hpp"
 #include "Module/DataSearchEngineFactory.hpp"
+#include "Module/DataSearchPlanner.hpp"
 #include "Module/DataPrintingEngineFactory.hpp"
 
 #include <tuple>
@@ -19,6 +20,7 @@ namespace Program::Module::Internal
         : m_DataGenerator{ DataGeneratorFactory::Create() }
         , m_DataSearchEngine{ DataSearchEngineFactory::Create() }
         , m_DataPrintingEngine{ DataPrintingEngineFactory::Create() }
+        , m_IndexedResults{ 0 }
     {
     }
 
@@ -152,11 +154,12 @@ namespace Program::Module::Internal
     /**
      * @brief Generate random bytes.
      * The function generates a random number of random bytes.
+     * @param generator The generator stream to draw from.
      * @return A vector of random bytes.
      */
-    std::vector<std::byte> DataModule::GenerateBytes() const noexcept
+    std::vector<std::byte> DataModule::GenerateBytes(const IDataGenerator& generator) noexcept
     {
-        return GetGenerator().GetRandomBytes(GetGenerator().GetRandomNumber(1, 100));
+        return generator.GetRandomBytes(generator.GetRandomNumber(1, 100));
     }
 
     /**
@@ -170,37 +173,35 @@ namespace Program::Module::Internal
     {
         ClearThreads();                                                                                         //!< Clear the threads. The threads are cleared before starting the asynchronous operation.
         {
-            std::lock_guard lock{ m_ResultsMutex };                                                             //!< Lock the results mutex. The results mutex is locked before clearing the results.
+            std::scoped_lock lock{ m_ResultsIndexMutex, m_ResultsMutex };                                       //!< Lock both results mutexes. The results and their index are reset together.
             m_Results.clear();                                                                                  //!< Clear the results. The results are cleared before starting the asynchronous operation.
+            m_IndexedResults = 0;                                                                               //!< No result is indexed.
+            m_ResultsIndex.reset();                                                                             //!< Reset the results index.
         }
 
+        const auto                          input_generator = GetGenerator().CreateStream(0);                   //!< The generator stream of the input data. Stream 0 is reserved for the input data, the threads use the streams 1..N.
         std::vector<std::vector<std::byte>> input_data(/* Count: */ 100);                                       //!< The input data to search for. The count is set to 100. The size of the input data is set to 100.
-        std::generate(input_data.begin(), input_data.end(), std::bind_front(&DataModule::GenerateBytes, this)); //!< Generate the input data. The input data is generated using the GenerateBytes function.
+        std::generate(input_data.begin(), input_data.end(), std::bind_front(&DataModule::GenerateBytes, std::cref(*input_generator))); //!< Generate the input data. The input data is generated using the GenerateBytes function.
 
         uint64_t       index                = 0;                                                                //!< The index of the thread. The index is set to 0.
         const uint64_t hardware_concurrency = std::thread::hardware_concurrency();                              //!< The number of hardware threads. The number of hardware threads is obtained using the hardware_concurrency function.
         const uint64_t thread_count         = hardware_concurrency == 0 ? 2 : hardware_concurrency;             //!< The number of threads. The number of threads is set to the hardware concurrency if it is not zero, otherwise it is set to 2.
 
+        const auto pattern_set = DataSearchPlanner::Compile(GetSearchEngine(), input_data);                    //!< The input data compiled once by the planner. Shared by every thread, it is immutable.
+
         m_Threads.resize(thread_count);                                                                         //!< Resize the threads. The threads are resized to the number of threads.
-        auto thread_function = [this](const std::vector<std::vector<std::byte>>& input_data)
+        auto thread_function = [this](const std::shared_ptr<const IPatternSet> pattern_set, const std::unique_ptr<IDataGenerator> generator)
         {
+            std::vector<std::byte> source;                                                                      //!< The source data. The buffer is reused by every iteration, so the steady state does not allocate.
+
             while ( not IsThreadCancellationRequested() )                                                       //!< While the thread cancellation is not requested. The loop continues until the thread cancellation is requested.
             {
-                auto source = GenerateBytes();                                                                  //!< Generate the source data. The source data is generated using the GenerateBytes function.
+                generator->FillRandomBytes(source, 1, 100);                                                     //!< Generate the source data. The source data is generated in place using the own generator stream of the thread.
 
-                for ( const auto& values_to_search : input_data )                                               //!< For each value to search in the input data. The loop iterates over the input data.
+                if ( pattern_set->Contains(source) )                                                            //!< If any of the values to search is in the source. The planner answers short values from its bitmaps and long values in one pass.
                 {
-                    if ( IsThreadCancellationRequested() )                                                      //!< If the thread cancellation is requested. The loop breaks if the thread cancellation is requested.
-                    {
-                        break;
-                    }
-
-                    if ( GetSearchEngine().Search(source, values_to_search) )                        //!< If the search engine finds the source in the values to search. The loop breaks if the search engine finds the source in the values to search.
-                    {
-                        std::lock_guard lock{ m_ResultsMutex };                                      //!< Lock the results mutex. The results mutex is locked before adding the result.
-                        m_Results.push_back(std::make_tuple(std::time(nullptr), std::move(source))); //!< Add the result. The result is added to the results. The result is a tuple of the current time and the source data.
-                        break;
-                    }
+                    std::lock_guard lock{ m_ResultsMutex };                                                     //!< Lock the results mutex. The results mutex is locked before adding the result.
+                    m_Results.push_back(std::make_tuple(std::time(nullptr), source));                           //!< Add the result. The result is a tuple of the current time and a copy of the source data.
                 }
 
                 std::this_thread::sleep_for(std::chrono::milliseconds{ 50 }); //!< Sleep for 50 milliseconds. The thread sleeps for 50 milliseconds after searching for the values.
@@ -209,7 +210,7 @@ namespace Program::Module::Internal
 
         for ( index = 0; index < thread_count; ++index )
         {
-            m_Threads[index] = std::thread(thread_function, input_data); //!< Start the thread. The thread is started with the thread function and the input data.
+            m_Threads[index] = std::thread(thread_function, pattern_set, GetGenerator().CreateStream(index + 1)); //!< Start the thread. The thread is started with the thread function, the compiled input data and its own generator stream.
         }
     }
 
@@ -226,11 +227,16 @@ namespace Program::Module::Internal
 
     void DataModule::PrintResults() const noexcept
     {
-        std::lock_guard lock{ m_ResultsMutex };
+        std::vector<std::tuple<std::time_t, std::vector<std::byte>>> results;
+
+        {
+            std::lock_guard lock{ m_ResultsMutex }; //!< Lock the results mutex, only to copy the results.
+            results = m_Results;                    //!< Copy the results. GetResultsIndex relies on the insertion order of m_Results, so it is never sorted in place.
+        }
 
         // Sort the results by time. The results are sorted by time before printing. The results are sorted in ascending order.
         // clang-format off
-        std::sort(m_Results.begin(), m_Results.end(),
+        std::stable_sort(results.begin(), results.end(),
             [](const auto& lhs, const auto& rhs)
             {
                 return std::get<0>(lhs) < std::get<0>(rhs);
@@ -238,6 +244,43 @@ namespace Program::Module::Internal
         );
         // clang-format on
 
-        GetPrintingEngine().PrintLine(m_Results);
+        GetPrintingEngine().PrintLine(results);
+    }
+
+    std::optional<std::uint64_t> DataModule::GetSeed() const noexcept
+    {
+        return GetGenerator().GetSeed(); //!< Get the seed. The seed of the generator is the seed of the whole run.
+    }
+
+    std::shared_ptr<const DataSearchIndex> DataModule::GetResultsIndex() const noexcept
+    {
+        std::lock_guard                  index_lock{ m_ResultsIndexMutex }; //!< Lock the results index mutex. One merge at a time.
+        Helpers::ragged_array<std::byte> batch;                             //!< The results to merge.
+
+        {
+            std::lock_guard lock{ m_ResultsMutex };                         //!< Lock the results mutex, only to take the new results: the merge does not block the threads.
+
+            for ( ; m_IndexedResults < m_Results.size(); ++m_IndexedResults )
+            {
+                batch.push_back(std::get<1>(m_Results[m_IndexedResults]));
+            }
+        }
+
+        if ( not m_ResultsIndex )
+        {
+            m_ResultsIndex = std::make_shared<DataSearchIndex>();
+        }
+
+        if ( not batch.empty() )
+        {
+            if ( m_ResultsIndex.use_count() > 1 )
+            {
+                m_ResultsIndex = std::make_shared<DataSearchIndex>(*m_ResultsIndex); //!< Copy on write: a snapshot returned earlier is still held, it stays unchanged.
+            }
+
+            m_ResultsIndex->Add(batch);
+        }
+
+        return m_ResultsIndex;
     }
 } // namespace Program::Module::Internal
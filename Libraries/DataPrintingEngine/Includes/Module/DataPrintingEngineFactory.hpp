@@ -3,6 +3,7 @@
 #define __MODULE_DATA_PRINTING_ENGINE_FACTORY_HPP__ // clang-format on
 
  #include "Module/IDataPrintingEngine.hpp"
+ #include "Helpers/cpu_features.hpp"
  #include <memory>
 
 namespace Program::Module
@@ -17,6 +18,14 @@ namespace Program::Module
          * @return A new instance of the Data Printing Engine.
          */
         static std::unique_ptr<IDataPrintingEngine> Create() noexcept;
+
+        /**
+         * @brief Creates a new instance of the Data Printing Engine, with its kernels bound to an instruction set tier.
+         * @param tier The instruction set tier, e.g. to benchmark the tiers against each other. Capped by what the processor supports.
+         * @return A new instance of the Data Printing Engine.
+         * @note Without a tier, the kernels bind to Helpers::get_cpu_tier(): the detected tier, capped by the TESTSENIOR_CPU_TIER environment variable.
+         */
+        static std::unique_ptr<IDataPrintingEngine> Create(const Helpers::cpu_tier tier) noexcept;
     };
 } // namespace Program::Module
 
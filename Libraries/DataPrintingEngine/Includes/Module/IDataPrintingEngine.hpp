@@ -2,6 +2,7 @@
 #ifndef __INTERFACE_MODULE_DATA_PRINTING_ENGINE_HPP__ // clang-format off
 #define __INTERFACE_MODULE_DATA_PRINTING_ENGINE_HPP__ // clang-format on
 
+ #include "Helpers/masked_byte.hpp"
  #include <vector>
  #include <cstddef>
  #include <ctime>
@@ -40,6 +41,12 @@ namespace Program::Module
          */
         virtual void Print(const std::vector<std::byte>& data) const noexcept = 0;
 
+        /**
+         * @brief Prints the data to the output stream.
+         * @param data The masked pattern to be printed.
+         */
+        virtual void Print(const std::vector<Helpers::masked_byte>& data) const noexcept = 0;
+
         /**
          * @brief Prints the data to the output stream.
          * @param data The data to be printed.
@@ -70,6 +77,12 @@ namespace Program::Module
          */
         virtual void PrintLine(const std::vector<std::byte>& data) const noexcept = 0;
 
+        /**
+         * @brief Prints the data to the output stream and adds a new line.
+         * @param data The masked pattern to be printed.
+         */
+        virtual void PrintLine(const std::vector<Helpers::masked_byte>& data) const noexcept = 0;
+
         /**
          * @brief Prints the data to the output stream and adds a new line.
          * @param data The data to be printed.
@@ -3,6 +3,7 @@
 #define __MODULE_DATA_PRINTING_ENGINE_HPP__ // clang-format on
 
  #include "Module/IDataPrintingEngine.hpp"
+ #include "Module/Internal/HexFormatKernel.hpp"
 
 namespace Program::Module::Internal
 {
@@ -15,10 +16,11 @@ namespace Program::Module::Internal
     struct DataPrintingEngine : public IDataPrintingEngine
     {
         /**
-         * @brief Default constructor.
-         * @details The default constructor is necessary to create instances of the Data Printing Engine.
+         * @brief Constructor.
+         * @details Binds the hexadecimal formatting kernel of the instruction set tier, once.
+         * @param tier The instruction set tier. It must be supported by the processor, see Helpers::resolve_cpu_tier.
          */
-        DataPrintingEngine() = default;
+        explicit DataPrintingEngine(const Helpers::cpu_tier tier) noexcept;
 
         /**
          * @brief Default destructor.
@@ -44,6 +46,12 @@ namespace Program::Module::Internal
          */
         void Print(const std::vector<std::byte>& data) const noexcept override;
 
+        /**
+         * @brief Prints the data to the output stream.
+         * @param data The masked pattern to be printed.
+         */
+        void Print(const std::vector<Helpers::masked_byte>& data) const noexcept override;
+
         /**
          * @brief Prints the data to the output stream.
          * @param data The data to be printed.
@@ -74,6 +82,12 @@ namespace Program::Module::Internal
          */
         void PrintLine(const std::vector<std::byte>& data) const noexcept override;
 
+        /**
+         * @brief Prints the data to the output stream and adds a new line.
+         * @param data The masked pattern to be printed.
+         */
+        void PrintLine(const std::vector<Helpers::masked_byte>& data) const noexcept override;
+
         /**
          * @brief Prints the data to the output stream and adds a new line.
          * @param data The data to be printed.
@@ -85,6 +99,9 @@ namespace Program::Module::Internal
          * @param data The data to be printed.
          */
         void PrintLine(const std::vector<std::tuple<std::time_t, std::vector<std::byte>>>& data) const noexcept override;
+
+    private:
+        HexFormatKernel m_HexFormatKernel; //!< The hexadecimal formatting kernel of the tier.
     };
 } // namespace Program::Module::Internal
 
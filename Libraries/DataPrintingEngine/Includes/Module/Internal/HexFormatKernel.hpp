@@ -0,0 +1,38 @@
+#pragma once
+#ifndef __MODULE_HEX_FORMAT_KERNEL_HPP__ // clang-format off
+#define __MODULE_HEX_FORMAT_KERNEL_HPP__ // clang-format on
+
+ #include "Helpers/cpu_features.hpp"
+ #include <cstddef>
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Hexadecimal formatting kernel.
+     * @details Writes the bytes as "0xXX, 0xYY, ..., 0xZZ", upper case. The hexadecimal digits are computed 8, 16 or 32 bytes
+     * at a time (SSE2, AVX2 or AVX-512BW), then copied into the "0x" / ", " frame.
+     * @param data The bytes to format.
+     * @param size The number of bytes.
+     * @param output The output buffer, at least GetHexFormatSize(size) characters.
+     * @return The end of the written characters.
+     */
+    using HexFormatKernel = char* (*)(const std::byte* data, const std::size_t size, char* output) noexcept;
+
+    /**
+     * @brief Number of characters written by a HexFormatKernel.
+     * @param size The number of bytes.
+     */
+    constexpr std::size_t GetHexFormatSize(const std::size_t size) noexcept
+    {
+        return size == 0 ? 0 : size * 6 - 2;
+    }
+
+    /**
+     * @brief Get the formatting kernel of a tier.
+     * @param tier The instruction set tier: scalar, SSE2, AVX2 or AVX-512BW. Every tier writes the same characters.
+     * @return The kernel. Only call it on a processor that supports the tier, see Helpers::resolve_cpu_tier.
+     */
+    HexFormatKernel GetHexFormatKernel(const Helpers::cpu_tier tier) noexcept;
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_HEX_FORMAT_KERNEL_HPP__
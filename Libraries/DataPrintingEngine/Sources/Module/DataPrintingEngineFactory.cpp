@@ -9,5 +9,15 @@
  */
 std::unique_ptr<Program::Module::IDataPrintingEngine> Program::Module::DataPrintingEngineFactory::Create() noexcept
 {
-    return std::make_unique<Internal::DataPrintingEngine>();
+    return Create(Helpers::get_cpu_tier());
+}
+
+/**
+ * @brief Creates a new instance of the Data Printing Engine, with its kernels bound to an instruction set tier.
+ * @param tier The instruction set tier.
+ * @return A new instance of the Data Printing Engine.
+ */
+std::unique_ptr<Program::Module::IDataPrintingEngine> Program::Module::DataPrintingEngineFactory::Create(const Helpers::cpu_tier tier) noexcept
+{
+    return std::make_unique<Internal::DataPrintingEngine>(Helpers::resolve_cpu_tier(tier));
 }
@@ -3,9 +3,19 @@
 #include <algorithm>
 #include <iostream>
 #include <iomanip>
+#include <string>
 
 namespace Program::Module::Internal
 {
+    /**
+     * @brief Constructs the Data Printing Engine.
+     * @param tier The instruction set tier of the hexadecimal formatting kernel.
+     */
+    DataPrintingEngine::DataPrintingEngine(const Helpers::cpu_tier tier) noexcept
+        : m_HexFormatKernel{ GetHexFormatKernel(tier) }
+    {
+    }
+
     /**
      * @brief Prints the data to the output stream.
      * @details The function prints the data to the output stream in the format 0xXX where XX is the hexadecimal representation of the data.
@@ -34,22 +44,49 @@ namespace Program::Module::Internal
     /**
      * @brief Prints the data to the output stream.
      * @details The function prints the data to the output stream in the format [0xXX, 0xYY, ..., 0xZZ] where XX, YY, ..., ZZ are the hexadecimal representation of the data.
+     * The hexadecimal text is written by the formatting kernel of the instruction set tier.
      * @param data The data to be printed.
      * @note The function is noexcept.
      * @note The function is marked as noexcept to ensure that the function does not throw exceptions.
      */
     void DataPrintingEngine::Print(const std::vector<std::byte>& data) const noexcept
     {
-        // clang-format off
-        std::cout << "[";
-        std::copy(data.cbegin(), data.cend(), Helpers::make_ostream_joiner(std::cout, ", ",
-            [](auto& os, const auto& value)
+        std::string text(GetHexFormatSize(data.size()), '\0');       //!< The text is formatted in one call to the kernel, then written at once.
+        m_HexFormatKernel(data.data(), data.size(), text.data());
+        std::cout << "[" << text << "]";
+    }
+
+    /**
+     * @brief Prints the data to the output stream.
+     * @details The function prints the masked pattern to the output stream in the format [0x4?, 0x??, 0xFF]: the values are formatted by the
+     * formatting kernel of the instruction set tier, then every nibble with a wildcard bit is replaced by '?'.
+     * @param data The masked pattern to be printed.
+     * @note A nibble that is only partially masked is also shown as '?'.
+     */
+    void DataPrintingEngine::Print(const std::vector<Helpers::masked_byte>& data) const noexcept
+    {
+        std::vector<std::byte> values(data.size());
+        std::transform(data.cbegin(), data.cend(), values.begin(), [](const Helpers::masked_byte& value) { return value.value; });
+
+        std::string text(GetHexFormatSize(values.size()), '\0');
+        m_HexFormatKernel(values.data(), values.size(), text.data());
+
+        for ( std::size_t index = 0; index < data.size(); ++index )
+        {
+            const auto mask = std::to_integer<std::uint32_t>(data[index].mask);
+
+            if ( (mask & 0xF0) != 0xF0 )
             {
-                os << "0x" << std::uppercase << std::hex << std::setw(2) << std::setfill('0') << std::to_integer<int32_t>(value);
-            })
-        );
-        std::cout << "]";
-        // clang-format on
+                text[index * 6 + 2] = '?'; //!< "0xXX, " is 6 characters: the high nibble is the third one.
+            }
+
+            if ( (mask & 0x0F) != 0x0F )
+            {
+                text[index * 6 + 3] = '?';
+            }
+        }
+
+        std::cout << "[" << text << "]";
     }
 
     /**
@@ -121,6 +158,18 @@ namespace Program::Module::Internal
         std::cout << std::endl;
     }
 
+    /**
+     * @brief Prints the data to the output stream and adds a new line.
+     * @param data The masked pattern to be printed.
+     * @note The function is noexcept.
+     * @note The function is marked as noexcept to ensure that the function does not throw exceptions.
+     */
+    void DataPrintingEngine::PrintLine(const std::vector<Helpers::masked_byte>& data) const noexcept
+    {
+        Print(data);
+        std::cout << std::endl;
+    }
+
     /**
      * @brief Prints the data to the output stream and adds a new line.
      * @param data The data to be printed.
@@ -0,0 +1,151 @@
+#include "Module/Internal/HexFormatKernel.hpp"
+#include <cstring>
+
+#if defined(__HELPER_CPU_FEATURES_X86__)
+ #include <immintrin.h>
+#endif
+
+namespace Program::Module::Internal
+{
+    namespace
+    {
+        constexpr char Digits[] = "0123456789ABCDEF"; //!< Upper case hexadecimal digits
+
+        alignas(64) constexpr char DigitLanes[] = "0123456789ABCDEF0123456789ABCDEF0123456789ABCDEF0123456789ABCDEF"; //!< The digits once per 16-byte lane, for the byte shuffles
+
+        /**
+         * @brief Copy the digit pairs of count bytes into the "0xXX, " frame.
+         * @param digits Two characters per byte, high digit first.
+         * @param output Where the first byte goes.
+         * @param separate Whether the last byte is followed by the ", " separator.
+         * @return The end of the written characters.
+         */
+        inline char* WriteFrame(const char* digits, const std::size_t count, char* output, const bool separate) noexcept
+        {
+            for ( std::size_t index = 0; index < count; ++index )
+            {
+                std::memcpy(output, "0x", 2);
+                std::memcpy(output + 2, digits + index * 2, 2);
+                output += 4;
+
+                if ( separate || index + 1 < count )
+                {
+                    std::memcpy(output, ", ", 2);
+                    output += 2;
+                }
+            }
+
+            return output;
+        }
+
+        /**
+         * @brief Format the bytes from index on, one at a time.
+         * @details The scalar kernel, and the tail of the vector kernels.
+         */
+        inline char* FormatTail(const std::byte* data, const std::size_t size, std::size_t index, char* output) noexcept
+        {
+            for ( ; index < size; ++index )
+            {
+                const auto value    = std::to_integer<std::size_t>(data[index]);
+                const char digits[] = { Digits[value >> 4], Digits[value & 0x0F] };
+                output              = WriteFrame(digits, 1, output, index + 1 < size);
+            }
+
+            return output;
+        }
+
+        char* FormatScalar(const std::byte* data, const std::size_t size, char* output) noexcept
+        {
+            return FormatTail(data, size, 0, output);
+        }
+
+#if defined(__HELPER_CPU_FEATURES_X86__)
+        /**
+         * @brief 8 bytes per step: the digits are computed with compares, SSE2 has no byte shuffle.
+         */
+        HELPERS_TARGET_SSE2 char* FormatSse2(const std::byte* data, const std::size_t size, char* output) noexcept
+        {
+            const __m128i low_nibble = _mm_set1_epi16(0x000F);
+            const __m128i nine       = _mm_set1_epi8(9);
+            const __m128i zero       = _mm_set1_epi8('0');
+            const __m128i letters    = _mm_set1_epi8('A' - '0' - 10);
+            alignas(16) char digits[16];
+            std::size_t      index = 0;
+
+            for ( ; index + 8 <= size; index += 8 )
+            {
+                const __m128i bytes   = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(data + index)), _mm_setzero_si128());
+                const __m128i nibbles = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(bytes, 4), low_nibble), _mm_slli_epi16(_mm_and_si128(bytes, low_nibble), 8));
+                const __m128i ascii   = _mm_add_epi8(_mm_add_epi8(nibbles, zero), _mm_and_si128(_mm_cmpgt_epi8(nibbles, nine), letters));
+                _mm_store_si128(reinterpret_cast<__m128i*>(digits), ascii);
+                output = WriteFrame(digits, 8, output, index + 8 < size);
+            }
+
+            return FormatTail(data, size, index, output);
+        }
+
+        /**
+         * @brief 16 bytes per step: every byte is widened to 16 bits, split into its nibbles and looked up with a byte shuffle.
+         */
+        HELPERS_TARGET_AVX2 char* FormatAvx2(const std::byte* data, const std::size_t size, char* output) noexcept
+        {
+            const __m256i low_nibble = _mm256_set1_epi16(0x000F);
+            const __m256i table      = _mm256_load_si256(reinterpret_cast<const __m256i*>(DigitLanes));
+            alignas(32) char digits[32];
+            std::size_t      index = 0;
+
+            for ( ; index + 16 <= size; index += 16 )
+            {
+                const __m256i bytes   = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(data + index)));
+                const __m256i nibbles = _mm256_or_si256(_mm256_and_si256(_mm256_srli_epi16(bytes, 4), low_nibble), _mm256_slli_epi16(_mm256_and_si256(bytes, low_nibble), 8));
+                _mm256_store_si256(reinterpret_cast<__m256i*>(digits), _mm256_shuffle_epi8(table, nibbles));
+                output = WriteFrame(digits, 16, output, index + 16 < size);
+            }
+
+            return FormatTail(data, size, index, output);
+        }
+
+        /**
+         * @brief 32 bytes per step, as FormatAvx2.
+         */
+        HELPERS_TARGET_AVX512 char* FormatAvx512(const std::byte* data, const std::size_t size, char* output) noexcept
+        {
+            const __m512i low_nibble = _mm512_set1_epi16(0x000F);
+            const __m512i table      = _mm512_load_si512(DigitLanes);
+            alignas(64) char digits[64];
+            std::size_t      index = 0;
+
+            for ( ; index + 32 <= size; index += 32 )
+            {
+                const __m512i bytes   = _mm512_cvtepu8_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + index)));
+                const __m512i nibbles = _mm512_or_si512(_mm512_and_si512(_mm512_srli_epi16(bytes, 4), low_nibble), _mm512_slli_epi16(_mm512_and_si512(bytes, low_nibble), 8));
+                _mm512_store_si512(digits, _mm512_shuffle_epi8(table, nibbles));
+                output = WriteFrame(digits, 32, output, index + 32 < size);
+            }
+
+            return FormatTail(data, size, index, output);
+        }
+#endif
+    } // namespace
+
+    HexFormatKernel GetHexFormatKernel(const Helpers::cpu_tier tier) noexcept
+    {
+        switch ( tier )
+        {
+#if defined(__HELPER_CPU_FEATURES_X86__)
+            case Helpers::cpu_tier::avx512:
+                return &FormatAvx512;
+
+            case Helpers::cpu_tier::avx2:
+                return &FormatAvx2;
+
+            case Helpers::cpu_tier::sse2:
+                return &FormatSse2;
+#endif
+
+            case Helpers::cpu_tier::scalar:
+            default:
+                return &FormatScalar;
+        }
+    }
+} // namespace Program::Module::Internal
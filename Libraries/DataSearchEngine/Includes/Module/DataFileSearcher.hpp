@@ -0,0 +1,91 @@
+#pragma once
+#ifndef __MODULE_DATA_FILE_SEARCHER_HPP__ // clang-format off
+#define __MODULE_DATA_FILE_SEARCHER_HPP__ // clang-format on
+
+ #include "Module/ICompiledPattern.hpp"
+ #include <filesystem>
+ #include <memory>
+
+namespace Program::Module
+{
+    /**
+     * @brief Parallel file searcher
+     * @details Memory-maps a file read-only and searches it on every core. The source is cut into chunks that each extend
+     * pattern length - 1 bytes into the next one, so a match spanning a cut is seen whole by the chunk it starts in; a pool of
+     * worker threads takes the chunks in increasing order. Offsets are 64-bit, so files larger than 4 GB are fully addressable.
+     * @note Works with the compiled patterns of every engine, masked ones included. The searcher is immutable, so one file can be
+     * searched by several threads at once.
+     */
+    class DataFileSearcher final
+    {
+    public:
+        /**
+         * @brief Map a file
+         * @param path The file to map
+         * @return The searcher, or nullptr if the file cannot be mapped. An empty file is mapped and has no match.
+         */
+        static std::shared_ptr<DataFileSearcher> Open(const std::filesystem::path& path) noexcept;
+
+        /**
+         * @brief Unmap the file
+         */
+        ~DataFileSearcher() noexcept;
+
+        DataFileSearcher(const DataFileSearcher&)            = delete;
+        DataFileSearcher& operator=(const DataFileSearcher&) = delete;
+
+        /**
+         * @brief Get the content of the file
+         * @return A view of the mapping
+         */
+        std::span<const std::byte> GetData() const noexcept;
+
+        /**
+         * @brief Search for the first occurrence of a pattern in the file
+         * @param pattern The compiled pattern to search for
+         * @param thread_count The number of worker threads, 0 for one per hardware thread
+         * @return The 64-bit offset of the first occurrence
+         * @note If the pattern is not found, the function will return an empty optional
+         */
+        std::optional<std::uint64_t> Search(const ICompiledPattern& pattern, const std::size_t thread_count = 0) const noexcept;
+
+        /**
+         * @brief Search for every occurrence of a pattern in the file
+         * @param pattern The compiled pattern to search for
+         * @param thread_count The number of worker threads, 0 for one per hardware thread
+         * @return The 64-bit offsets of the occurrences in increasing order, overlapping ones included
+         */
+        std::vector<std::uint64_t> FindAll(const ICompiledPattern& pattern, const std::size_t thread_count = 0) const noexcept;
+
+        /**
+         * @brief Search for the first occurrence of a pattern in a buffer, on several threads
+         * @param source The source data to search in, e.g. a large buffer already in memory
+         * @param pattern The compiled pattern to search for
+         * @param thread_count The number of worker threads, 0 for one per hardware thread
+         * @return The 64-bit offset of the first occurrence
+         * @note Once a chunk found a match, the chunks that start past it are skipped: they cannot hold an earlier one.
+         */
+        static std::optional<std::uint64_t> Search(const std::span<const std::byte> source, const ICompiledPattern& pattern, const std::size_t thread_count = 0) noexcept;
+
+        /**
+         * @brief Search for every occurrence of a pattern in a buffer, on several threads
+         * @param source The source data to search in, e.g. a large buffer already in memory
+         * @param pattern The compiled pattern to search for
+         * @param thread_count The number of worker threads, 0 for one per hardware thread
+         * @return The 64-bit offsets of the occurrences in increasing order, overlapping ones included
+         */
+        static std::vector<std::uint64_t> FindAll(const std::span<const std::byte> source, const ICompiledPattern& pattern, const std::size_t thread_count = 0) noexcept;
+
+    private:
+        /**
+         * @brief Construct an empty mapping
+         */
+        DataFileSearcher() noexcept = default;
+
+    private:
+        const std::byte* m_Mapping{ nullptr }; //!< Start of the mapping, nullptr for an empty file
+        std::size_t      m_MappingSize{ 0 };   //!< Size of the mapping
+    };
+} // namespace Program::Module
+
+#endif // __MODULE_DATA_FILE_SEARCHER_HPP__
@@ -0,0 +1,48 @@
+#pragma once
+#ifndef __MODULE_DATA_SEARCH_BATCH_HPP__ // clang-format off
+#define __MODULE_DATA_SEARCH_BATCH_HPP__ // clang-format on
+
+ #include "Module/IPatternSet.hpp"
+ #include "Helpers/ragged_array.hpp"
+
+namespace Program::Module
+{
+    /**
+     * @brief Batched search
+     * @details Searches a compiled pattern set in a whole batch of sources in one call. The sources are split into blocks of
+     * consecutive sources that the workers take in turn, so every worker streams through its part of the arena with the
+     * immutable tables of the set hot in its cache, and pays one call per source instead of one per source and pattern.
+     * @note The answers are the ones of IPatternSet::Search and IPatternSet::Match on every source.
+     */
+    struct DataSearchBatch
+    {
+        /**
+         * @brief Find the leftmost match of a pattern set in every source of a batch
+         * @param patterns The compiled pattern set
+         * @param sources The sources
+         * @param thread_count The number of worker threads, 0 for one per hardware thread
+         * @return One result per source: the leftmost match; among matches at the same offset, the one with the lowest pattern
+         * index; an empty optional if no pattern occurs
+         */
+        static std::vector<std::optional<PatternMatch>> Search(const IPatternSet& patterns, const Helpers::ragged_array<std::byte>& sources, const std::size_t thread_count = 0) noexcept;
+
+        /**
+         * @brief Find every pattern of a set that occurs in every source of a batch
+         * @param patterns The compiled pattern set
+         * @param sources The sources
+         * @param thread_count The number of worker threads, 0 for one per hardware thread
+         * @return One bitset per source, back to back: source i owns the GetWordCount(patterns) words from i * GetWordCount(patterns),
+         * pattern j in bit j % 64 of word j / 64
+         */
+        static std::vector<std::uint64_t> Match(const IPatternSet& patterns, const Helpers::ragged_array<std::byte>& sources, const std::size_t thread_count = 0) noexcept;
+
+        /**
+         * @brief Get the number of 64-bit words of the bitset of one source
+         * @param patterns The compiled pattern set
+         * @return The number of words, enough for one bit per pattern
+         */
+        static std::size_t GetWordCount(const IPatternSet& patterns) noexcept;
+    };
+} // namespace Program::Module
+
+#endif // __MODULE_DATA_SEARCH_BATCH_HPP__
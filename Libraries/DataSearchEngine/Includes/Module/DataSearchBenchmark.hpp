@@ -0,0 +1,43 @@
+#pragma once
+#ifndef __MODULE_DATA_SEARCH_BENCHMARK_HPP__ // clang-format off
+#define __MODULE_DATA_SEARCH_BENCHMARK_HPP__ // clang-format on
+
+ #include <chrono>
+ #include <cinttypes>
+ #include <string_view>
+ #include <vector>
+
+namespace Program::Module
+{
+    /**
+     * @brief Timing of one contender of the search benchmark.
+     */
+    struct DataSearchBenchmarkResult
+    {
+        std::string_view                          m_Name;    //!< Name of the contender
+        std::chrono::duration<double, std::milli> m_Time;    //!< Time to search every source
+        std::uint64_t                             m_Matches; //!< Number of sources that contain any pattern, the same for every contender
+    };
+
+    /**
+     * @brief Benchmark of the multi-pattern search engines.
+     */
+    struct DataSearchBenchmark
+    {
+        /**
+         * @brief Time the pattern set engines against the per-pattern Boyer-Moore loop.
+         * @details Replays the DataModule workload: random patterns and sources of 1 to 100 bytes, and one "does the source
+         * contain any pattern" query per source. The contenders are the compiled Boyer-Moore patterns searched one by one,
+         * the Rabin-Karp pattern set, the Aho-Corasick pattern set, the sets DataSearchPlanner builds on the Aho-Corasick and
+         * Teddy engines as the module does, and the Aho-Corasick pattern set searched in the whole batch of sources at once
+         * by DataSearchBatch. Every contender runs on one thread.
+         * @param pattern_count The number of patterns.
+         * @param source_count The number of sources.
+         * @param seed The seed of the data, so runs are comparable.
+         * @return One result per contender, the per-pattern loop first.
+         */
+        static std::vector<DataSearchBenchmarkResult> Run(const std::size_t pattern_count, const std::size_t source_count, const std::uint64_t seed) noexcept;
+    };
+} // namespace Program::Module
+
+#endif // __MODULE_DATA_SEARCH_BENCHMARK_HPP__
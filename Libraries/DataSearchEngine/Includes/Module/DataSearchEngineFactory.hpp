@@ -3,10 +3,27 @@
 #define __MODULE_DATA_SEARCH_ENGINE_FACTORY_HPP__ // clang-format on
 
  #include "Module/IDataSearchEngine.hpp"
+ #include "Module/IMultiPatternSearchEngine.hpp"
+ #include "Module/IApproximateSearchEngine.hpp"
+ #include "Helpers/cpu_features.hpp"
  #include <memory>
 
 namespace Program::Module
 {
+    /**
+     * @brief Data search engine implementations
+     */
+    enum class DataSearchEngineType : std::uint8_t
+    {
+        BoyerMoore,  //!< One Boyer-Moore search per pattern.
+        AhoCorasick, //!< Adaptive for single patterns, and IMultiPatternSearchEngine: one Aho-Corasick pass for a whole pattern set.
+        Simd,        //!< SIMD first/last byte candidate filter, no tables: for short sources and patterns.
+        Adaptive,    //!< SIMD, Horspool, Boyer-Moore or two-way per pattern, from thresholds calibrated on the current machine.
+        RabinKarp,   //!< Adaptive for single patterns, and IMultiPatternSearchEngine: one keyed pass over the source for a whole pattern set.
+        Approximate, //!< Adaptive for exact searches, and IApproximateSearchEngine: bit-parallel Hamming (Shift-And) and Levenshtein (Myers) searches.
+        Teddy        //!< Adaptive for single patterns, and IMultiPatternSearchEngine: SIMD nibble filter over the first bytes of small sets of short patterns.
+    };
+
     /**
      * @brief Factory for creating data search engine
      * @details This factory is used to create a data search engine
@@ -17,9 +34,26 @@ namespace Program::Module
         /**
          * @brief Create a data search engine
          * @return A unique pointer to the created data search engine
-         * @note A unique pointer to the created data search engine
+         * @note The engine also implements IMultiPatternSearchEngine
          */
         static std::unique_ptr<IDataSearchEngine> Create() noexcept;
+
+        /**
+         * @brief Create a data search engine of the given type
+         * @param type Data search engine type
+         * @return A unique pointer to the created data search engine
+         * @note A unique pointer to the created data search engine
+         */
+        static std::unique_ptr<IDataSearchEngine> Create(const DataSearchEngineType type) noexcept;
+
+        /**
+         * @brief Create a data search engine of the given type, with its kernels bound to an instruction set tier
+         * @param type Data search engine type
+         * @param tier The instruction set tier, e.g. to benchmark the tiers against each other. Capped by what the processor supports.
+         * @return A unique pointer to the created data search engine
+         * @note Without a tier, the kernels bind to Helpers::get_cpu_tier(): the detected tier, capped by the TESTSENIOR_CPU_TIER environment variable
+         */
+        static std::unique_ptr<IDataSearchEngine> Create(const DataSearchEngineType type, const Helpers::cpu_tier tier) noexcept;
     };
 } // namespace Program::Module
 
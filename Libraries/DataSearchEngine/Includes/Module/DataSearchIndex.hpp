@@ -0,0 +1,124 @@
+#pragma once
+#ifndef __MODULE_DATA_SEARCH_INDEX_HPP__ // clang-format off
+#define __MODULE_DATA_SEARCH_INDEX_HPP__ // clang-format on
+
+ #include "Helpers/ragged_array.hpp"
+ #include <cinttypes>
+ #include <cstddef>
+ #include <filesystem>
+ #include <memory>
+ #include <span>
+ #include <string_view>
+ #include <utility>
+ #include <vector>
+
+namespace Program::Module
+{
+    /**
+     * @brief Occurrence of a pattern in an indexed source.
+     */
+    struct DataIndexMatch
+    {
+        std::uint64_t m_Source; //!< Index of the source, in the order the sources were added
+        std::uint64_t m_Offset; //!< Offset of the occurrence in the source
+
+        bool operator==(const DataIndexMatch&) const noexcept = default;
+    };
+
+    /**
+     * @brief Suffix array index
+     * @details Indexes a growing set of sources, e.g. the results of a run or a loaded file, to query them many times: the suffix
+     * array of the sources answers whether a pattern occurs, how many times and where, with two binary searches of O(m log n)
+     * for a pattern of m bytes in n indexed bytes, whatever the number of occurrences. The LCP array, the common prefix of
+     * neighbouring suffixes, lets a new batch of sources be merged in linear time instead of re-sorting the whole index.
+     * An occurrence never spans two sources.
+     * @note Costs 16 bytes per indexed byte on top of the sources. Queries are const and may run on several threads; Add may not
+     * run concurrently with anything else.
+     */
+    class DataSearchIndex final
+    {
+    public:
+        static constexpr std::string_view Magic = "TSSUFIDX"; //!< File magic (8 bytes, no terminator)
+
+        /**
+         * @brief Add a batch of sources
+         * @details The batch is indexed on its own, then merged into the index.
+         * @param sources The sources. Empty ones are kept, so the source indices match, but never match.
+         */
+        void Add(const Helpers::ragged_array<std::byte>& sources) noexcept;
+
+        /**
+         * @brief Add one source
+         * @param source The source, e.g. the content of a mapped file
+         */
+        void Add(const std::span<const std::byte> source) noexcept;
+
+        /**
+         * @brief Get the number of sources
+         */
+        std::uint64_t GetSourceCount() const noexcept;
+
+        /**
+         * @brief Get a source
+         * @param index Source index, smaller than GetSourceCount()
+         * @return A view of the source inside the index
+         */
+        std::span<const std::byte> GetSource(const std::uint64_t index) const noexcept;
+
+        /**
+         * @brief Get the number of indexed bytes
+         */
+        std::uint64_t GetSize() const noexcept;
+
+        /**
+         * @brief Check whether a pattern occurs in any source
+         * @param pattern The data to search for. An empty pattern has no occurrence.
+         * @return True if the pattern occurs
+         */
+        bool Contains(const std::span<const std::byte> pattern) const noexcept;
+
+        /**
+         * @brief Count the occurrences of a pattern
+         * @param pattern The data to search for. An empty pattern has no occurrence.
+         * @return The number of occurrences, overlapping ones included
+         */
+        std::uint64_t Count(const std::span<const std::byte> pattern) const noexcept;
+
+        /**
+         * @brief Locate the occurrences of a pattern
+         * @param pattern The data to search for. An empty pattern has no occurrence.
+         * @return The occurrences, overlapping ones included, sorted by source and offset
+         */
+        std::vector<DataIndexMatch> Locate(const std::span<const std::byte> pattern) const noexcept;
+
+        /**
+         * @brief Write the index to a file
+         * @param path The file to write
+         * @return True if the whole file was written
+         */
+        bool Save(const std::filesystem::path& path) const noexcept;
+
+        /**
+         * @brief Read an index written by Save
+         * @details The arrays are read as they are, nothing is sorted again.
+         * @param path The file to read
+         * @return The index, or nullptr if the file cannot be read or is not a valid index file
+         */
+        static std::shared_ptr<DataSearchIndex> Load(const std::filesystem::path& path) noexcept;
+
+    private:
+        /**
+         * @brief Find the suffixes that start with a pattern
+         * @param pattern The data to search for
+         * @return The range [first, last) of the suffix array
+         */
+        std::pair<std::size_t, std::size_t> FindRange(const std::span<const std::byte> pattern) const noexcept;
+
+    private:
+        Helpers::ragged_array<std::byte> m_Sources;     //!< The indexed sources, back to back
+        std::vector<std::uint64_t>       m_SuffixArray; //!< Start of every suffix, in sorted order
+        std::vector<std::uint64_t>       m_Lcp;         //!< Common prefix of every suffix with the previous one
+    };
+} // namespace Program::Module
+
+#endif // __MODULE_DATA_SEARCH_INDEX_HPP__
@@ -0,0 +1,34 @@
+#pragma once
+#ifndef __MODULE_DATA_SEARCH_PLANNER_HPP__ // clang-format off
+#define __MODULE_DATA_SEARCH_PLANNER_HPP__ // clang-format on
+
+ #include "Module/IDataSearchEngine.hpp"
+ #include "Module/IPatternSet.hpp"
+ #include <memory>
+
+namespace Program::Module
+{
+    /**
+     * @brief Pattern set planner
+     * @details Analyses a set of patterns once and compiles it into tiers: the 1-byte patterns into a 256-bit byte presence
+     * bitmap, the 2-byte patterns into a 64K-bit bigram bitmap, and only the longer patterns with the search engine, as one
+     * pattern set if the engine implements IMultiPatternSearchEngine, one compiled pattern each otherwise. The long patterns
+     * are prefiltered by byte fingerprint: a pattern longer than the source, or with a byte the source lacks, is not searched.
+     * The long patterns are compiled once, and the short ones always taken out into the bitmaps. If the set of the engine has
+     * a prefilter of its own, the long patterns are not fingerprinted; a set with neither short patterns nor fingerprints is
+     * returned as the engine compiled it.
+     * @note The answers are the ones of searching every pattern on its own with the engine
+     */
+    struct DataSearchPlanner
+    {
+        /**
+         * @brief Compile a set of patterns
+         * @param engine The search engine of the patterns longer than 2 bytes
+         * @param patterns The data to search for. The pattern index of a match is the index in this vector.
+         * @return The compiled, immutable pattern set
+         */
+        static std::shared_ptr<const IPatternSet> Compile(const IDataSearchEngine& engine, const std::vector<std::vector<std::byte>>& patterns) noexcept;
+    };
+} // namespace Program::Module
+
+#endif // __MODULE_DATA_SEARCH_PLANNER_HPP__
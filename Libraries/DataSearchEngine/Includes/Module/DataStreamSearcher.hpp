@@ -0,0 +1,55 @@
+#pragma once
+#ifndef __MODULE_DATA_STREAM_SEARCHER_HPP__ // clang-format off
+#define __MODULE_DATA_STREAM_SEARCHER_HPP__ // clang-format on
+
+ #include "Module/ICompiledPattern.hpp"
+ #include <memory>
+
+namespace Program::Module
+{
+    /**
+     * @brief Streaming searcher
+     * @details Searches a compiled pattern in a source pushed as consecutive chunks, e.g. read from a pipe, a socket or a file,
+     * without holding the whole source. Between two chunks it only keeps the last pattern length - 1 bytes, the only ones a
+     * match spanning the boundary can start in; each chunk is searched in place, and the carried bytes together with the head
+     * of the next chunk. Memory is bounded by the pattern length, whatever the length of the source.
+     * @note Works with the compiled patterns of every engine, masked ones included. One searcher per stream: it is not thread-safe.
+     */
+    class DataStreamSearcher final
+    {
+    public:
+        /**
+         * @brief Construct a searcher at the start of a stream
+         * @param pattern The compiled pattern to search for
+         */
+        explicit DataStreamSearcher(std::shared_ptr<const ICompiledPattern> pattern) noexcept;
+
+        /**
+         * @brief Search the next chunk of the stream
+         * @param chunk The bytes that follow the previous chunk. Any length, empty included.
+         * @param offsets The absolute 64-bit offsets of the occurrences that end in this chunk are appended to it, in increasing
+         * order, overlapping ones included. Reuse the vector across chunks to avoid allocations.
+         * @return The number of offsets appended
+         */
+        std::size_t Push(const std::span<const std::byte> chunk, std::vector<std::uint64_t>& offsets) noexcept;
+
+        /**
+         * @brief Start a new stream with the same pattern
+         */
+        void Reset() noexcept;
+
+        /**
+         * @brief Get the position in the stream
+         * @return The number of bytes pushed since the start of the stream
+         */
+        std::uint64_t GetPosition() const noexcept;
+
+    private:
+        std::shared_ptr<const ICompiledPattern> m_Pattern;  //!< The compiled pattern
+        std::vector<std::byte>                  m_Carry;    //!< The last bytes of the stream, at most the pattern length - 1
+        std::vector<std::byte>                  m_Boundary; //!< Scratch: the carried bytes, then the head of the chunk
+        std::uint64_t                           m_Position; //!< Number of bytes pushed
+    };
+} // namespace Program::Module
+
+#endif // __MODULE_DATA_STREAM_SEARCHER_HPP__
@@ -0,0 +1,75 @@
+#pragma once
+#ifndef __INTERFACE_MODULE_APPROXIMATE_PATTERN_HPP__ // clang-format off
+#define __INTERFACE_MODULE_APPROXIMATE_PATTERN_HPP__ // clang-format on
+
+ #include <vector>
+ #include <cinttypes>
+ #include <cstddef>
+ #include <optional>
+ #include <span>
+
+namespace Program::Module
+{
+    /**
+     * @brief Distance between a pattern and a substring of the source.
+     */
+    enum class ApproximateMetric : std::uint8_t
+    {
+        Hamming,    //!< Byte substitutions only: the substring has the length of the pattern.
+        Levenshtein //!< Byte substitutions, insertions and deletions: the substring may be shorter or longer than the pattern.
+    };
+
+    /**
+     * @brief A match of an approximate search.
+     */
+    struct ApproximateMatch
+    {
+        std::uint64_t offset;   //!< Index of the first byte of the matching substring in the source.
+        std::size_t   length;   //!< Length of the matching substring.
+        std::size_t   distance; //!< Distance between the pattern and the matching substring.
+    };
+
+    /**
+     * @brief Interface for a compiled approximate pattern
+     * @details A pattern compiled once by IApproximateSearchEngine::Compile with its metric and its maximum distance, and searched
+     * with bit-parallel kernels: one machine word per 64 bytes of pattern
+     * @note Compiled patterns are immutable, so one pattern can be shared by every thread
+     */
+    struct IApproximatePattern
+    {
+        /**
+         * @brief Destructor
+         * @details Virtual destructor
+         * @note Virtual destructor
+         */
+        virtual ~IApproximatePattern() = default;
+
+        /**
+         * @brief Get the pattern
+         * @return The data to search for
+         */
+        virtual const std::vector<std::byte>& GetPattern() const noexcept = 0;
+
+        /**
+         * @brief Get the metric
+         * @return The distance the pattern is searched with
+         */
+        virtual ApproximateMetric GetMetric() const noexcept = 0;
+
+        /**
+         * @brief Get the maximum distance
+         * @return The largest distance of a match, after capping: see IApproximateSearchEngine::Compile
+         */
+        virtual std::size_t GetMaxDistance() const noexcept = 0;
+
+        /**
+         * @brief Search for the pattern in a given source data
+         * @param source The source data to search in
+         * @return The match that ends first in the source data, see IApproximateSearchEngine::Search
+         * @note If the pattern is not found, or is empty, the function will return an empty optional
+         */
+        virtual std::optional<ApproximateMatch> Search(const std::span<const std::byte> source) const noexcept = 0;
+    };
+} // namespace Program::Module
+
+#endif // __INTERFACE_MODULE_APPROXIMATE_PATTERN_HPP__
@@ -0,0 +1,49 @@
+#pragma once
+#ifndef __INTERFACE_MODULE_APPROXIMATE_SEARCH_ENGINE_HPP__ // clang-format off
+#define __INTERFACE_MODULE_APPROXIMATE_SEARCH_ENGINE_HPP__ // clang-format on
+
+ #include "Module/IApproximatePattern.hpp"
+ #include <memory>
+
+namespace Program::Module
+{
+    /**
+     * @brief Interface for approximate search engine
+     * @details This interface is used to search for near-matches of a pattern: substrings of the source within a maximum Hamming or
+     * Levenshtein distance of the pattern
+     * @note Search engines implement it next to IDataSearchEngine; query it with dynamic_cast
+     */
+    struct IApproximateSearchEngine
+    {
+        /**
+         * @brief Destructor
+         * @details Virtual destructor
+         * @note Virtual destructor
+         */
+        virtual ~IApproximateSearchEngine() = default;
+
+        /**
+         * @brief Compile a pattern once, to search it many times
+         * @param values_to_search The data to search for
+         * @param max_distance The largest distance of a match. Capped to the pattern length for Hamming, and to the pattern length
+         * minus one for Levenshtein, where the empty substring is always at the pattern length.
+         * @param metric The distance
+         * @return The compiled, immutable pattern
+         */
+        virtual std::shared_ptr<const IApproximatePattern> Compile(const std::span<const std::byte> values_to_search, const std::size_t max_distance, const ApproximateMetric metric) const noexcept = 0;
+
+        /**
+         * @brief Search for near-matches of a specific data in a given source data
+         * @param source The source data to search in
+         * @param values_to_search The data to search for
+         * @param max_distance The largest distance of a match, capped as by Compile
+         * @param metric The distance
+         * @return The match that ends first in the source data. For Levenshtein the end is moved forward while the distance keeps
+         * decreasing, and the reported substring is the shortest one ending there at that distance.
+         * @note If the data to search for is not found, or is empty, the function will return an empty optional
+         */
+        virtual std::optional<ApproximateMatch> Search(const std::span<const std::byte> source, const std::span<const std::byte> values_to_search, const std::size_t max_distance, const ApproximateMetric metric) const noexcept = 0;
+    };
+} // namespace Program::Module
+
+#endif // __INTERFACE_MODULE_APPROXIMATE_SEARCH_ENGINE_HPP__
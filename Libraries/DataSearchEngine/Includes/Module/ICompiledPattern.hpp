@@ -0,0 +1,51 @@
+#pragma once
+#ifndef __INTERFACE_MODULE_COMPILED_PATTERN_HPP__ // clang-format off
+#define __INTERFACE_MODULE_COMPILED_PATTERN_HPP__ // clang-format on
+
+ #include <vector>
+ #include <cinttypes>
+ #include <cstddef>
+ #include <optional>
+ #include <span>
+
+namespace Program::Module
+{
+    /**
+     * @brief Interface for a compiled pattern
+     * @details A pattern compiled once by IDataSearchEngine::Compile, with its search tables built ahead of time
+     * @note Compiled patterns are immutable, so one pattern can be shared by every thread
+     */
+    struct ICompiledPattern
+    {
+        /**
+         * @brief Destructor
+         * @details Virtual destructor
+         * @note Virtual destructor
+         */
+        virtual ~ICompiledPattern() = default;
+
+        /**
+         * @brief Get the pattern
+         * @return The data to search for
+         */
+        virtual const std::vector<std::byte>& GetPattern() const noexcept = 0;
+
+        /**
+         * @brief Search for the pattern in a given source data
+         * @param source The source data to search in
+         * @return The index of the first occurrence of the pattern in the source data
+         * @note If the pattern is not found, the function will return an empty optional
+         */
+        virtual std::optional<int32_t> Search(const std::vector<std::byte>& source) const noexcept = 0;
+
+        /**
+         * @brief Search for the pattern in a given source data, without copies
+         * @param source The source data to search in, e.g. a slice of a larger buffer or of a mapped file
+         * @return The 64-bit offset of the first occurrence of the pattern in the source data
+         * @note If the pattern is not found, the function will return an empty optional
+         */
+        virtual std::optional<std::uint64_t> Search(const std::span<const std::byte> source) const noexcept = 0;
+    };
+} // namespace Program::Module
+
+#endif // __INTERFACE_MODULE_COMPILED_PATTERN_HPP__
@@ -2,10 +2,14 @@
 #ifndef __INTERFACE_MODULE_DATA_SEARCH_ENGINE_HPP__ // clang-format off
 #define __INTERFACE_MODULE_DATA_SEARCH_ENGINE_HPP__ // clang-format on
 
+ #include "Module/ICompiledPattern.hpp"
+ #include "Helpers/masked_byte.hpp"
  #include <vector>
  #include <cinttypes>
  #include <cstddef>
  #include <optional>
+ #include <memory>
+ #include <span>
 
 namespace Program::Module
 {
@@ -30,7 +34,58 @@ namespace Program::Module
          * @return The index of the first occurrence of the data to search for in the source data
          * @note If the data to search for is not found, the function will return an empty optional
          */
-        virtual std::optional<int32_t> Search(const std::vector<std::byte>& source, const std::vector<std::byte> values_to_search) const noexcept = 0;
+        virtual std::optional<int32_t> Search(const std::vector<std::byte>& source, const std::vector<std::byte>& values_to_search) const noexcept = 0;
+
+        /**
+         * @brief Compile a pattern once, to search it many times
+         * @param values_to_search The data to search for
+         * @return The compiled, immutable pattern
+         */
+        virtual std::shared_ptr<const ICompiledPattern> Compile(const std::vector<std::byte>& values_to_search) const noexcept = 0;
+
+        /**
+         * @brief Compile a masked pattern once, to search it many times
+         * @param values_to_search The data to search for, e.g. 0x4? ?? 0xFF: only the bits set in the mask of a byte are compared
+         * @return The compiled, immutable pattern; its GetPattern returns the values with the bits outside the masks cleared
+         */
+        virtual std::shared_ptr<const ICompiledPattern> Compile(const std::vector<Helpers::masked_byte>& values_to_search) const noexcept = 0;
+
+        /**
+         * @brief Search for a compiled pattern in a given source data
+         * @param source The source data to search in
+         * @param pattern The compiled pattern to search for
+         * @return The index of the first occurrence of the pattern in the source data
+         * @note If the pattern is not found, the function will return an empty optional
+         */
+        virtual std::optional<int32_t> Search(const std::vector<std::byte>& source, const ICompiledPattern& pattern) const noexcept = 0;
+
+        /**
+         * @brief Search for a specific data in a given source data, without copies
+         * @param source The source data to search in, e.g. a slice of a larger buffer or of a mapped file
+         * @param values_to_search The data to search for
+         * @return The 64-bit offset of the first occurrence of the data to search for in the source data
+         * @note If the data to search for is not found, or is empty, the function will return an empty optional
+         */
+        virtual std::optional<std::uint64_t> Search(const std::span<const std::byte> source, const std::span<const std::byte> values_to_search) const noexcept = 0;
+
+        /**
+         * @brief Find every occurrence of a specific data in a given source data, overlapping ones included
+         * @param source The source data to search in
+         * @param values_to_search The data to search for
+         * @param offsets The caller buffer of the 64-bit offsets, in increasing order
+         * @return The number of offsets written
+         * @note The search stops when the buffer is full; it resumes by searching the source again from the last offset + 1
+         */
+        virtual std::size_t FindAll(const std::span<const std::byte> source, const std::span<const std::byte> values_to_search, const std::span<std::uint64_t> offsets) const noexcept = 0;
+
+        /**
+         * @brief Count the occurrences of a specific data in a given source data
+         * @param source The source data to search in
+         * @param values_to_search The data to search for
+         * @param overlapping Whether an occurrence may start inside the previous one: "aa" occurs twice in "aaa" if so, once otherwise
+         * @return The number of occurrences
+         */
+        virtual std::uint64_t Count(const std::span<const std::byte> source, const std::span<const std::byte> values_to_search, const bool overlapping) const noexcept = 0;
     };
 } // namespace Program::Module
 
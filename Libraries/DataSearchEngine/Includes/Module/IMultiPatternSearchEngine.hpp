@@ -0,0 +1,34 @@
+#pragma once
+#ifndef __INTERFACE_MODULE_MULTI_PATTERN_SEARCH_ENGINE_HPP__ // clang-format off
+#define __INTERFACE_MODULE_MULTI_PATTERN_SEARCH_ENGINE_HPP__ // clang-format on
+
+ #include "Module/IPatternSet.hpp"
+ #include <memory>
+
+namespace Program::Module
+{
+    /**
+     * @brief Interface for multi-pattern search engine
+     * @details This interface is used to search for many patterns at once: the patterns are compiled once into an IPatternSet,
+     * which is then searched in a single pass over each source data
+     * @note Search engines implement it next to IDataSearchEngine; query it with dynamic_cast
+     */
+    struct IMultiPatternSearchEngine
+    {
+        /**
+         * @brief Destructor
+         * @details Virtual destructor
+         * @note Virtual destructor
+         */
+        virtual ~IMultiPatternSearchEngine() = default;
+
+        /**
+         * @brief Compile a set of patterns
+         * @param patterns The data to search for. The pattern index of a match is the index in this vector.
+         * @return The compiled, immutable pattern set
+         */
+        virtual std::shared_ptr<const IPatternSet> Compile(const std::vector<std::vector<std::byte>>& patterns) const noexcept = 0;
+    };
+} // namespace Program::Module
+
+#endif // __INTERFACE_MODULE_MULTI_PATTERN_SEARCH_ENGINE_HPP__
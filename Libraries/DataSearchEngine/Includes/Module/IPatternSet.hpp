@@ -0,0 +1,79 @@
+#pragma once
+#ifndef __INTERFACE_MODULE_PATTERN_SET_HPP__ // clang-format off
+#define __INTERFACE_MODULE_PATTERN_SET_HPP__ // clang-format on
+
+ #include <vector>
+ #include <cinttypes>
+ #include <cstddef>
+ #include <optional>
+ #include <span>
+
+namespace Program::Module
+{
+    /**
+     * @brief A match of a compiled pattern set.
+     */
+    struct PatternMatch
+    {
+        std::size_t pattern; //!< Index of the matching pattern in the compiled set.
+        std::size_t offset;  //!< Index of the first byte of the match in the source.
+    };
+
+    /**
+     * @brief Interface for a compiled pattern set
+     * @details A set of patterns compiled once by an IMultiPatternSearchEngine and searched in a single pass over every source.
+     * @note Compiled sets are immutable, so one set can be shared by every thread.
+     */
+    struct IPatternSet
+    {
+        /**
+         * @brief Destructor
+         * @details Virtual destructor
+         * @note Virtual destructor
+         */
+        virtual ~IPatternSet() = default;
+
+        /**
+         * @brief Get the number of patterns in the set
+         * @return The number of patterns, empty patterns included
+         */
+        virtual std::size_t GetPatternCount() const noexcept = 0;
+
+        /**
+         * @brief Search for every pattern of the set in a given source data
+         * @param source The source data to search in
+         * @return The leftmost match; among matches at the same offset, the one with the lowest pattern index
+         * @note If no pattern is found, the function will return an empty optional. Empty patterns never match.
+         */
+        virtual std::optional<PatternMatch> Search(const std::span<const std::byte> source) const noexcept = 0;
+
+        /**
+         * @brief Check if any pattern of the set occurs in a given source data
+         * @param source The source data to search in
+         * @return True if Search would find a match
+         * @note Cheaper than Search: the search stops at the first match found, whichever pattern it is
+         */
+        virtual bool Contains(const std::span<const std::byte> source) const noexcept = 0;
+
+        /**
+         * @brief Find every pattern of the set that occurs in a given source data
+         * @param source The source data to search in
+         * @param matches A cleared bitset of GetPatternCount() bits, pattern i in bit i % 64 of word i / 64. The bit of every
+         * pattern that occurs is set.
+         * @note The most expensive query: the whole source is searched for every pattern. Empty patterns never match.
+         */
+        virtual void Match(const std::span<const std::byte> source, const std::span<std::uint64_t> matches) const noexcept = 0;
+
+        /**
+         * @brief Check if the set rejects the sources without a match itself, before any per-pattern work
+         * @return True if a cheap filter of its own already screens every source, so an outer prefilter would only add work
+         * @note False by default: DataSearchPlanner puts its byte fingerprints in front of such sets.
+         */
+        virtual bool HasOwnPrefilter() const noexcept
+        {
+            return false;
+        }
+    };
+} // namespace Program::Module
+
+#endif // __INTERFACE_MODULE_PATTERN_SET_HPP__
@@ -0,0 +1,67 @@
+#pragma once
+#ifndef __MODULE_ADAPTIVE_PATTERN_HPP__ // clang-format off
+#define __MODULE_ADAPTIVE_PATTERN_HPP__ // clang-format on
+
+ #include "Module/ICompiledPattern.hpp"
+ #include "Module/Internal/SearchCalibration.hpp"
+ #include <optional>
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Adaptive compiled pattern
+     * @details Owns a copy of the pattern and the prepared searcher of every strategy the calibration selected for it, one
+     * strategy per source length bucket; every search picks the strategy of the length of its source
+     * @note The searchers refer to the owned copy: the object is neither copyable nor movable
+     */
+    class AdaptivePattern final : public ICompiledPattern
+    {
+    public:
+        /**
+         * @brief Compile a pattern
+         * @param values_to_search The data to search for
+         * @param tier The instruction set tier of the Simd strategy
+         * @param calibration The measured thresholds of the tier
+         */
+        AdaptivePattern(const std::vector<std::byte>& values_to_search, const Helpers::cpu_tier tier, const SearchCalibration& calibration) noexcept;
+
+        AdaptivePattern(const AdaptivePattern&)            = delete;
+        AdaptivePattern& operator=(const AdaptivePattern&) = delete;
+
+        /**
+         * @brief Destructor
+         * @details Virtual destructor
+         * @note Virtual destructor
+         */
+        virtual ~AdaptivePattern() = default;
+
+        /**
+         * @brief Get the pattern
+         * @return The data to search for
+         */
+        virtual const std::vector<std::byte>& GetPattern() const noexcept override;
+
+        /**
+         * @brief Search for the pattern in a given source data
+         * @param source The source data to search in
+         * @return The index of the first occurrence of the pattern in the source data
+         * @note If the pattern is not found, the function will return an empty optional
+         */
+        virtual std::optional<int32_t> Search(const std::vector<std::byte>& source) const noexcept override;
+
+        /**
+         * @brief Search for the pattern in a given source data, without copies
+         * @param source The source data to search in
+         * @return The 64-bit offset of the first occurrence of the pattern in the source data
+         * @note If the pattern is not found, the function will return an empty optional
+         */
+        virtual std::optional<std::uint64_t> Search(const std::span<const std::byte> source) const noexcept override;
+
+    private:
+        std::vector<std::byte>                                           m_Pattern;    //!< The data to search for
+        std::array<SearchStrategy, SearchCalibration::SourceBuckets>     m_Strategies; //!< The strategy of every source length bucket
+        std::array<std::optional<StrategySearcher>, SearchStrategyCount> m_Searchers;  //!< The prepared searcher of every selected strategy
+    };
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_ADAPTIVE_PATTERN_HPP__
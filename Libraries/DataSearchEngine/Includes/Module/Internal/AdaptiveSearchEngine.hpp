@@ -0,0 +1,102 @@
+#pragma once
+#ifndef __MODULE_ADAPTIVE_SEARCH_ENGINE_HPP__ // clang-format off
+#define __MODULE_ADAPTIVE_SEARCH_ENGINE_HPP__ // clang-format on
+
+ #include "Module/IDataSearchEngine.hpp"
+ #include "Module/Internal/SearchCalibration.hpp"
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Adaptive data search engine
+     * @details Owns the Simd, Horspool, Boyer-Moore and two-way strategies and picks one per search from the pattern length,
+     * the source length and the byte entropy of the pattern, with the thresholds measured by SearchCalibration on the
+     * current machine. Compiled patterns prepare the strategy of every source length bucket once.
+     * @note Returns the same first-match index as DataSearchEngine
+     */
+    struct AdaptiveSearchEngine final : public IDataSearchEngine
+    {
+        /**
+         * @brief Constructor
+         * @param tier The instruction set tier of the Simd strategy
+         * @note The tier must be supported by the processor, see Helpers::resolve_cpu_tier. The calibration of the tier runs on first use.
+         */
+        explicit AdaptiveSearchEngine(const Helpers::cpu_tier tier) noexcept;
+
+        /**
+         * @brief Destructor
+         * @details Virtual destructor
+         * @note Virtual destructor
+         */
+        virtual ~AdaptiveSearchEngine() = default;
+
+        /**
+         * @brief Search for a specific data in a given source data
+         * @param source The source data to search in
+         * @param values_to_search The data to search for
+         * @return The index of the first occurrence of the data to search for in the source data
+         * @note If the data to search for is not found, the function will return an empty optional
+         */
+        virtual std::optional<int32_t> Search(const std::vector<std::byte>& source, const std::vector<std::byte>& values_to_search) const noexcept override;
+
+        /**
+         * @brief Compile a pattern once, to search it many times
+         * @param values_to_search The data to search for
+         * @return The compiled, immutable pattern
+         * @note The strategies of the pattern are selected here, once
+         */
+        virtual std::shared_ptr<const ICompiledPattern> Compile(const std::vector<std::byte>& values_to_search) const noexcept override;
+
+        /**
+         * @brief Compile a masked pattern once, to search it many times
+         * @param values_to_search The data to search for
+         * @return The compiled, immutable pattern
+         * @note Masked patterns are searched with the SIMD kernels of the tier
+         */
+        virtual std::shared_ptr<const ICompiledPattern> Compile(const std::vector<Helpers::masked_byte>& values_to_search) const noexcept override;
+
+        /**
+         * @brief Search for a compiled pattern in a given source data
+         * @param source The source data to search in
+         * @param pattern The compiled pattern to search for
+         * @return The index of the first occurrence of the pattern in the source data
+         * @note If the pattern is not found, the function will return an empty optional
+         */
+        virtual std::optional<int32_t> Search(const std::vector<std::byte>& source, const ICompiledPattern& pattern) const noexcept override;
+
+        /**
+         * @brief Search for a specific data in a given source data, without copies
+         * @param source The source data to search in
+         * @param values_to_search The data to search for
+         * @return The 64-bit offset of the first occurrence of the data to search for in the source data
+         * @note If the data to search for is not found, or is empty, the function will return an empty optional
+         */
+        virtual std::optional<std::uint64_t> Search(const std::span<const std::byte> source, const std::span<const std::byte> values_to_search) const noexcept override;
+
+        /**
+         * @brief Find every occurrence of a specific data in a given source data, overlapping ones included
+         * @param source The source data to search in
+         * @param values_to_search The data to search for
+         * @param offsets The caller buffer of the 64-bit offsets, in increasing order
+         * @return The number of offsets written
+         * @note The strategy is selected and prepared once per call
+         */
+        virtual std::size_t FindAll(const std::span<const std::byte> source, const std::span<const std::byte> values_to_search, const std::span<std::uint64_t> offsets) const noexcept override;
+
+        /**
+         * @brief Count the occurrences of a specific data in a given source data
+         * @param source The source data to search in
+         * @param values_to_search The data to search for
+         * @param overlapping Whether an occurrence may start inside the previous one
+         * @return The number of occurrences
+         * @note The strategy is selected and prepared once per call
+         */
+        virtual std::uint64_t Count(const std::span<const std::byte> source, const std::span<const std::byte> values_to_search, const bool overlapping) const noexcept override;
+
+    private:
+        Helpers::cpu_tier        m_Tier;        //!< The instruction set tier of the Simd strategy
+        const SearchCalibration& m_Calibration; //!< The measured thresholds of the tier
+    };
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_ADAPTIVE_SEARCH_ENGINE_HPP__
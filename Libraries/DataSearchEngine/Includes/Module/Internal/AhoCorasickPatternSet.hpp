@@ -0,0 +1,96 @@
+#pragma once
+#ifndef __MODULE_AHO_CORASICK_PATTERN_SET_HPP__ // clang-format off
+#define __MODULE_AHO_CORASICK_PATTERN_SET_HPP__ // clang-format on
+
+ #include "Module/IPatternSet.hpp"
+ #include <array>
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Aho-Corasick automaton over a set of patterns
+     * @details The trie is laid out in breadth-first order, so the children of a state are contiguous and sorted by byte.
+     * Every state stores a 256-bit bitmap of its children: the child of a byte is found with one popcount over the bitmap,
+     * instead of a dense 256-entry transition row. The root, visited after almost every mismatch, keeps a dense row.
+     */
+    class AhoCorasickPatternSet final : public IPatternSet
+    {
+    public:
+        /**
+         * @brief Compile the automaton
+         * @param patterns The patterns
+         */
+        explicit AhoCorasickPatternSet(const std::vector<std::vector<std::byte>>& patterns) noexcept;
+
+        /**
+         * @brief Destructor
+         * @details Virtual destructor
+         * @note Virtual destructor
+         */
+        virtual ~AhoCorasickPatternSet() = default;
+
+        /**
+         * @brief Get the number of patterns in the set
+         * @return The number of patterns, empty patterns included
+         */
+        virtual std::size_t GetPatternCount() const noexcept override;
+
+        /**
+         * @brief Search for every pattern of the set in a given source data
+         * @param source The source data to search in
+         * @return The leftmost match; among matches at the same offset, the one with the lowest pattern index
+         * @note Single pass; the scan stops as soon as no later match can start before the best one.
+         */
+        virtual std::optional<PatternMatch> Search(const std::span<const std::byte> source) const noexcept override;
+
+        /**
+         * @brief Check if any pattern of the set occurs in a given source data
+         * @param source The source data to search in
+         * @return True if Search would find a match
+         * @note The scan stops at the first state that ends a pattern.
+         */
+        virtual bool Contains(const std::span<const std::byte> source) const noexcept override;
+
+        /**
+         * @brief Find every pattern of the set that occurs in a given source data
+         * @param source The source data to search in
+         * @param matches A cleared bitset of GetPatternCount() bits, set for every pattern that occurs
+         * @note Single pass over the whole source; the output chain of a state is only walked until a state already reported.
+         */
+        virtual void Match(const std::span<const std::byte> source, const std::span<std::uint64_t> matches) const noexcept override;
+
+    private:
+        static constexpr std::uint32_t Root = 0;          //!< Root state
+        static constexpr std::uint32_t None = UINT32_MAX; //!< No state, no pattern
+
+        /**
+         * @brief Automaton state
+         */
+        struct State
+        {
+            std::array<std::uint64_t, 4> children{};      //!< Bitmap of the bytes with a child
+            std::uint32_t                first_child{ 0 }; //!< Index of the child of the lowest byte
+            std::uint32_t                failure{ Root };  //!< Longest proper suffix that is a state
+            std::uint32_t                output{ None };   //!< Closest state, this one included, that ends a pattern
+            std::uint32_t                pattern{ None };  //!< Lowest index of the patterns ending exactly here
+            std::uint32_t                depth{ 0 };       //!< Length of the path from the root
+        };
+
+        /**
+         * @brief Follow the goto and failure transitions
+         * @param state The current state
+         * @param value The next byte
+         * @return The next state
+         */
+        std::uint32_t Next(std::uint32_t state, const std::byte value) const noexcept;
+
+    private:
+        std::vector<State>              m_States;       //!< States in breadth-first order
+        std::array<std::uint32_t, 256>  m_RootNext;     //!< Dense transitions of the root
+        std::vector<std::uint32_t>      m_SamePattern;  //!< Next higher index of a pattern equal to every pattern, None for the last one
+        std::size_t                     m_PatternCount; //!< Number of patterns
+        std::size_t                     m_MaxLength;    //!< Length of the longest pattern
+    };
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_AHO_CORASICK_PATTERN_SET_HPP__
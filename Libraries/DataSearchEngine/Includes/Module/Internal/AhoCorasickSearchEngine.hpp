@@ -0,0 +1,42 @@
+#pragma once
+#ifndef __MODULE_AHO_CORASICK_SEARCH_ENGINE_HPP__ // clang-format off
+#define __MODULE_AHO_CORASICK_SEARCH_ENGINE_HPP__ // clang-format on
+
+ #include "Module/IMultiPatternSearchEngine.hpp"
+ #include "Module/Internal/DelegatingSearchEngine.hpp"
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Aho-Corasick data search engine
+     * @details Compiles pattern sets into an AhoCorasickPatternSet; single patterns are searched with the adaptive engine
+     * @note Single patterns are delegated to AdaptiveSearchEngine by DelegatingSearchEngine
+     */
+    struct AhoCorasickSearchEngine final : public DelegatingSearchEngine, public IMultiPatternSearchEngine
+    {
+        /**
+         * @brief Constructor
+         * @param tier The instruction set tier of the single pattern searches
+         * @note The tier must be supported by the processor, see Helpers::resolve_cpu_tier
+         */
+        explicit AhoCorasickSearchEngine(const Helpers::cpu_tier tier) noexcept;
+
+        /**
+         * @brief Destructor
+         * @details Virtual destructor
+         * @note Virtual destructor
+         */
+        virtual ~AhoCorasickSearchEngine() = default;
+
+        using DelegatingSearchEngine::Compile; //!< The single pattern compiles, hidden by the overload below
+
+        /**
+         * @brief Compile a set of patterns into an Aho-Corasick automaton
+         * @param patterns The data to search for
+         * @return The compiled, immutable pattern set
+         */
+        virtual std::shared_ptr<const IPatternSet> Compile(const std::vector<std::vector<std::byte>>& patterns) const noexcept override;
+    };
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_AHO_CORASICK_SEARCH_ENGINE_HPP__
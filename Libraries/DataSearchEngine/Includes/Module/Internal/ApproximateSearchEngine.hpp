@@ -0,0 +1,57 @@
+#pragma once
+#ifndef __MODULE_APPROXIMATE_SEARCH_ENGINE_HPP__ // clang-format off
+#define __MODULE_APPROXIMATE_SEARCH_ENGINE_HPP__ // clang-format on
+
+ #include "Module/IApproximateSearchEngine.hpp"
+ #include "Module/Internal/DelegatingSearchEngine.hpp"
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Approximate data search engine
+     * @details Compiles Hamming patterns into a ShiftAndPattern and Levenshtein patterns into a MyersPattern; exact searches are
+     * delegated to the adaptive engine
+     * @note Exact searches are delegated to AdaptiveSearchEngine by DelegatingSearchEngine
+     */
+    struct ApproximateSearchEngine final : public DelegatingSearchEngine, public IApproximateSearchEngine
+    {
+        /**
+         * @brief Constructor
+         * @param tier The instruction set tier of the exact searches
+         * @note The tier must be supported by the processor, see Helpers::resolve_cpu_tier
+         */
+        explicit ApproximateSearchEngine(const Helpers::cpu_tier tier) noexcept;
+
+        /**
+         * @brief Destructor
+         * @details Virtual destructor
+         * @note Virtual destructor
+         */
+        virtual ~ApproximateSearchEngine() = default;
+
+        using DelegatingSearchEngine::Compile; //!< The single pattern compiles, hidden by the overload below
+        using DelegatingSearchEngine::Search;  //!< The exact searches, hidden by the overload below
+
+        /**
+         * @brief Compile a pattern once, to search it many times within a maximum distance
+         * @param values_to_search The data to search for
+         * @param max_distance The largest distance of a match, capped as documented by IApproximateSearchEngine
+         * @param metric The distance
+         * @return The compiled, immutable pattern
+         */
+        virtual std::shared_ptr<const IApproximatePattern> Compile(const std::span<const std::byte> values_to_search, const std::size_t max_distance, const ApproximateMetric metric) const noexcept override;
+
+        /**
+         * @brief Search for near-matches of a specific data in a given source data
+         * @param source The source data to search in
+         * @param values_to_search The data to search for
+         * @param max_distance The largest distance of a match
+         * @param metric The distance
+         * @return The match that ends first in the source data, see IApproximateSearchEngine::Search
+         * @note The masks are built for this one search: compile the pattern to search it many times
+         */
+        virtual std::optional<ApproximateMatch> Search(const std::span<const std::byte> source, const std::span<const std::byte> values_to_search, const std::size_t max_distance, const ApproximateMetric metric) const noexcept override;
+    };
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_APPROXIMATE_SEARCH_ENGINE_HPP__
@@ -0,0 +1,64 @@
+#pragma once
+#ifndef __MODULE_BOYER_MOORE_PATTERN_HPP__ // clang-format off
+#define __MODULE_BOYER_MOORE_PATTERN_HPP__ // clang-format on
+
+ #include "Module/ICompiledPattern.hpp"
+ #include <functional>
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Boyer-Moore compiled pattern
+     * @details Owns a copy of the pattern and the std::boyer_moore_searcher built over it, so the skip tables are built once
+     * @note The searcher refers to the owned copy: the object is neither copyable nor movable
+     */
+    class BoyerMoorePattern final : public ICompiledPattern
+    {
+    public:
+        /**
+         * @brief Compile a pattern
+         * @param values_to_search The data to search for
+         */
+        explicit BoyerMoorePattern(const std::vector<std::byte>& values_to_search) noexcept;
+
+        BoyerMoorePattern(const BoyerMoorePattern&)            = delete;
+        BoyerMoorePattern& operator=(const BoyerMoorePattern&) = delete;
+
+        /**
+         * @brief Destructor
+         * @details Virtual destructor
+         * @note Virtual destructor
+         */
+        virtual ~BoyerMoorePattern() = default;
+
+        /**
+         * @brief Get the pattern
+         * @return The data to search for
+         */
+        virtual const std::vector<std::byte>& GetPattern() const noexcept override;
+
+        /**
+         * @brief Search for the pattern in a given source data
+         * @param source The source data to search in
+         * @return The index of the first occurrence of the pattern in the source data
+         * @note If the pattern is not found, the function will return an empty optional
+         */
+        virtual std::optional<int32_t> Search(const std::vector<std::byte>& source) const noexcept override;
+
+        /**
+         * @brief Search for the pattern in a given source data, without copies
+         * @param source The source data to search in
+         * @return The 64-bit offset of the first occurrence of the pattern in the source data
+         * @note If the pattern is not found, the function will return an empty optional
+         */
+        virtual std::optional<std::uint64_t> Search(const std::span<const std::byte> source) const noexcept override;
+
+    private:
+        using searcher_type = std::boyer_moore_searcher<std::vector<std::byte>::const_iterator>; //!< Searcher type
+
+        std::vector<std::byte> m_Pattern;  //!< The data to search for
+        searcher_type          m_Searcher; //!< Boyer-Moore searcher over m_Pattern
+    };
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_BOYER_MOORE_PATTERN_HPP__
@@ -0,0 +1,45 @@
+#pragma once
+#ifndef __MODULE_BYTE_FINGERPRINT_HPP__ // clang-format off
+#define __MODULE_BYTE_FINGERPRINT_HPP__ // clang-format on
+
+ #include <array>
+ #include <cinttypes>
+ #include <cstddef>
+ #include <span>
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Byte fingerprint
+     * @details The 256-bit set of the bytes present in some data, and its length. A pattern can only occur in a source whose
+     * fingerprint holds every byte of the pattern and is at least as long: checking it takes four AND instructions.
+     */
+    class ByteFingerprint final
+    {
+    public:
+        /**
+         * @brief Fingerprint of some data
+         * @param data The data
+         */
+        explicit ByteFingerprint(const std::span<const std::byte> data) noexcept;
+
+        /**
+         * @brief Check if a pattern may occur in the data
+         * @param pattern The fingerprint of the pattern
+         * @return False if the pattern cannot occur: it is longer, or it has a byte the data lacks
+         */
+        bool MayContain(const ByteFingerprint& pattern) const noexcept;
+
+        /**
+         * @brief Get the length of the data
+         * @return The number of bytes the fingerprint was taken of
+         */
+        std::size_t GetSize() const noexcept;
+
+    private:
+        std::array<std::uint64_t, 4> m_Bytes; //!< Set of the bytes present
+        std::size_t                  m_Size;  //!< Length of the data
+    };
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_BYTE_FINGERPRINT_HPP__
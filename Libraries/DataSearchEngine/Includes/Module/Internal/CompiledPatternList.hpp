@@ -0,0 +1,70 @@
+#pragma once
+#ifndef __MODULE_COMPILED_PATTERN_LIST_HPP__ // clang-format off
+#define __MODULE_COMPILED_PATTERN_LIST_HPP__ // clang-format on
+
+ #include "Module/IPatternSet.hpp"
+ #include "Module/IDataSearchEngine.hpp"
+ #include "Module/Internal/ByteFingerprint.hpp"
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Pattern set of single compiled patterns
+     * @details Pattern set for the engines without IMultiPatternSearchEngine: every pattern is compiled with
+     * IDataSearchEngine::Compile and searched on its own, in order. The fingerprint of the source is taken once per call,
+     * and the patterns it cannot contain are skipped without calling the engine
+     */
+    class CompiledPatternList final : public IPatternSet
+    {
+    public:
+        /**
+         * @brief Compile every pattern
+         * @param engine The search engine that compiles the patterns
+         * @param patterns The patterns
+         */
+        CompiledPatternList(const IDataSearchEngine& engine, const std::vector<std::vector<std::byte>>& patterns) noexcept;
+
+        /**
+         * @brief Destructor
+         * @details Virtual destructor
+         * @note Virtual destructor
+         */
+        virtual ~CompiledPatternList() = default;
+
+        /**
+         * @brief Get the number of patterns in the set
+         * @return The number of patterns, empty patterns included
+         */
+        virtual std::size_t GetPatternCount() const noexcept override;
+
+        /**
+         * @brief Search for every pattern of the set in a given source data
+         * @param source The source data to search in
+         * @return The leftmost match; among matches at the same offset, the one with the lowest pattern index
+         * @note Every pattern the fingerprint of the source admits is searched: one full search per pattern
+         */
+        virtual std::optional<PatternMatch> Search(const std::span<const std::byte> source) const noexcept override;
+
+        /**
+         * @brief Check if any pattern of the set occurs in a given source data
+         * @param source The source data to search in
+         * @return True if Search would find a match
+         * @note The patterns are searched in order, up to the first one found
+         */
+        virtual bool Contains(const std::span<const std::byte> source) const noexcept override;
+
+        /**
+         * @brief Find every pattern of the set that occurs in a given source data
+         * @param source The source data to search in
+         * @param matches A cleared bitset of GetPatternCount() bits, set for every pattern that occurs
+         * @note Every pattern the fingerprint of the source admits is searched: one full search per pattern
+         */
+        virtual void Match(const std::span<const std::byte> source, const std::span<std::uint64_t> matches) const noexcept override;
+
+    private:
+        std::vector<std::shared_ptr<const ICompiledPattern>> m_Patterns;     //!< The compiled patterns
+        std::vector<ByteFingerprint>                         m_Fingerprints; //!< The fingerprint of every pattern
+    };
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_COMPILED_PATTERN_LIST_HPP__
@@ -0,0 +1,100 @@
+#pragma once
+#ifndef __MODULE_DELEGATING_SEARCH_ENGINE_HPP__ // clang-format off
+#define __MODULE_DELEGATING_SEARCH_ENGINE_HPP__ // clang-format on
+
+ #include "Module/IDataSearchEngine.hpp"
+ #include "Module/Internal/AdaptiveSearchEngine.hpp"
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Base of the data search engines that delegate single patterns to the adaptive engine
+     * @details Implements IDataSearchEngine by forwarding every call to an AdaptiveSearchEngine of the tier, so a derived
+     * engine only adds the compile of its own interface: a pattern set, or an approximate pattern.
+     * @note A derived engine declaring a Compile or Search overload brings these ones back with a using declaration
+     */
+    struct DelegatingSearchEngine : public IDataSearchEngine
+    {
+        /**
+         * @brief Constructor
+         * @param tier The instruction set tier of the single pattern searches
+         * @note The tier must be supported by the processor, see Helpers::resolve_cpu_tier
+         */
+        explicit DelegatingSearchEngine(const Helpers::cpu_tier tier) noexcept;
+
+        /**
+         * @brief Destructor
+         * @details Virtual destructor
+         * @note Virtual destructor
+         */
+        virtual ~DelegatingSearchEngine() = default;
+
+        /**
+         * @brief Search for a specific data in a given source data
+         * @param source The source data to search in
+         * @param values_to_search The data to search for
+         * @return The index of the first occurrence of the data to search for in the source data
+         * @note If the data to search for is not found, the function will return an empty optional
+         */
+        virtual std::optional<int32_t> Search(const std::vector<std::byte>& source, const std::vector<std::byte>& values_to_search) const noexcept override;
+
+        /**
+         * @brief Compile a pattern once, to search it many times
+         * @param values_to_search The data to search for
+         * @return The compiled, immutable pattern
+         * @note The strategies of the pattern are selected here, once
+         */
+        virtual std::shared_ptr<const ICompiledPattern> Compile(const std::vector<std::byte>& values_to_search) const noexcept override;
+
+        /**
+         * @brief Compile a masked pattern once, to search it many times
+         * @param values_to_search The data to search for
+         * @return The compiled, immutable pattern
+         * @note Compiled by AdaptiveSearchEngine
+         */
+        virtual std::shared_ptr<const ICompiledPattern> Compile(const std::vector<Helpers::masked_byte>& values_to_search) const noexcept override;
+
+        /**
+         * @brief Search for a compiled pattern in a given source data
+         * @param source The source data to search in
+         * @param pattern The compiled pattern to search for
+         * @return The index of the first occurrence of the pattern in the source data
+         * @note If the pattern is not found, the function will return an empty optional
+         */
+        virtual std::optional<int32_t> Search(const std::vector<std::byte>& source, const ICompiledPattern& pattern) const noexcept override;
+
+        /**
+         * @brief Search for a specific data in a given source data, without copies
+         * @param source The source data to search in
+         * @param values_to_search The data to search for
+         * @return The 64-bit offset of the first occurrence of the data to search for in the source data
+         * @note If the data to search for is not found, or is empty, the function will return an empty optional
+         */
+        virtual std::optional<std::uint64_t> Search(const std::span<const std::byte> source, const std::span<const std::byte> values_to_search) const noexcept override;
+
+        /**
+         * @brief Find every occurrence of a specific data in a given source data, overlapping ones included
+         * @param source The source data to search in
+         * @param values_to_search The data to search for
+         * @param offsets The caller buffer of the 64-bit offsets, in increasing order
+         * @return The number of offsets written
+         * @note Searched by AdaptiveSearchEngine
+         */
+        virtual std::size_t FindAll(const std::span<const std::byte> source, const std::span<const std::byte> values_to_search, const std::span<std::uint64_t> offsets) const noexcept override;
+
+        /**
+         * @brief Count the occurrences of a specific data in a given source data
+         * @param source The source data to search in
+         * @param values_to_search The data to search for
+         * @param overlapping Whether an occurrence may start inside the previous one
+         * @return The number of occurrences
+         * @note Searched by AdaptiveSearchEngine
+         */
+        virtual std::uint64_t Count(const std::span<const std::byte> source, const std::span<const std::byte> values_to_search, const bool overlapping) const noexcept override;
+
+    private:
+        AdaptiveSearchEngine m_SearchEngine; //!< Single pattern search engine
+    };
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_DELEGATING_SEARCH_ENGINE_HPP__
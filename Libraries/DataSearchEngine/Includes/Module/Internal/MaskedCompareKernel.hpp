@@ -0,0 +1,30 @@
+#pragma once
+#ifndef __MODULE_MASKED_COMPARE_KERNEL_HPP__ // clang-format off
+#define __MODULE_MASKED_COMPARE_KERNEL_HPP__ // clang-format on
+
+ #include "Helpers/cpu_features.hpp"
+ #include <cstddef>
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Masked compare kernel.
+     * @details Checks (source & masks) == values over 8, 16, 32 or 64 bytes at a time (words, SSE2, AVX2 or AVX-512BW); the
+     * AVX-512 kernel loads the last partial step with a byte mask, the others finish with words and single bytes.
+     * @param source The candidate position. At least size bytes must be readable.
+     * @param values The values to compare with, with the bits outside the masks cleared.
+     * @param masks The compared bits of every byte.
+     * @param size The number of bytes.
+     * @return Whether every byte matches.
+     */
+    using MaskedCompareKernel = bool (*)(const std::byte* source, const std::byte* values, const std::byte* masks, const std::size_t size) noexcept;
+
+    /**
+     * @brief Get the masked compare kernel of a tier.
+     * @param tier The instruction set tier: scalar, SSE2, AVX2 or AVX-512BW. Every tier returns the same answer.
+     * @return The kernel. Only call it on a processor that supports the tier, see Helpers::resolve_cpu_tier.
+     */
+    MaskedCompareKernel GetMaskedCompareKernel(const Helpers::cpu_tier tier) noexcept;
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_MASKED_COMPARE_KERNEL_HPP__
@@ -0,0 +1,68 @@
+#pragma once
+#ifndef __MODULE_MASKED_PATTERN_HPP__ // clang-format off
+#define __MODULE_MASKED_PATTERN_HPP__ // clang-format on
+
+ #include "Module/ICompiledPattern.hpp"
+ #include "Module/Internal/MaskedCompareKernel.hpp"
+ #include "Module/Internal/SimdSearchKernel.hpp"
+ #include "Helpers/masked_byte.hpp"
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Masked compiled pattern
+     * @details A pattern where every byte has a mask of compared bits, e.g. 0x4? ?? 0xFF. The longest run of fully specified
+     * bytes is the anchor: it is searched with the SIMD candidate filter kernel of its length bucket, and every anchor hit is
+     * verified over the whole pattern with the vectorized masked compare kernel. A pattern without any fully specified byte
+     * is compared at every position.
+     */
+    class MaskedPattern final : public ICompiledPattern
+    {
+    public:
+        /**
+         * @brief Compile a pattern
+         * @param values_to_search The data to search for
+         * @param tier The instruction set tier of the kernels
+         */
+        MaskedPattern(const std::vector<Helpers::masked_byte>& values_to_search, const Helpers::cpu_tier tier) noexcept;
+
+        /**
+         * @brief Destructor
+         * @details Virtual destructor
+         * @note Virtual destructor
+         */
+        virtual ~MaskedPattern() = default;
+
+        /**
+         * @brief Get the pattern
+         * @return The values of the data to search for, with the bits outside the masks cleared
+         */
+        virtual const std::vector<std::byte>& GetPattern() const noexcept override;
+
+        /**
+         * @brief Search for the pattern in a given source data
+         * @param source The source data to search in
+         * @return The index of the first occurrence of the pattern in the source data
+         * @note If the pattern is not found, the function will return an empty optional
+         */
+        virtual std::optional<int32_t> Search(const std::vector<std::byte>& source) const noexcept override;
+
+        /**
+         * @brief Search for the pattern in a given source data, without copies
+         * @param source The source data to search in
+         * @return The 64-bit offset of the first occurrence of the pattern in the source data
+         * @note If the pattern is not found, or is empty, the function will return an empty optional
+         */
+        virtual std::optional<std::uint64_t> Search(const std::span<const std::byte> source) const noexcept override;
+
+    private:
+        std::vector<std::byte> m_Pattern;    //!< The values, with the bits outside the masks cleared
+        std::vector<std::byte> m_Masks;      //!< The compared bits of every byte
+        std::size_t            m_Anchor;     //!< Offset of the longest run of fully specified bytes
+        std::size_t            m_AnchorSize; //!< Length of that run, 0 if every byte has a wildcard bit
+        SimdSearchKernel       m_Search;     //!< Search kernel of the length bucket of the anchor
+        MaskedCompareKernel    m_Compare;    //!< Masked compare kernel of the tier
+    };
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_MASKED_PATTERN_HPP__
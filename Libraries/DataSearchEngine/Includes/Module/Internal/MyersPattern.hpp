@@ -0,0 +1,73 @@
+#pragma once
+#ifndef __MODULE_MYERS_PATTERN_HPP__ // clang-format off
+#define __MODULE_MYERS_PATTERN_HPP__ // clang-format on
+
+ #include "Module/IApproximatePattern.hpp"
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Levenshtein distance compiled pattern, searched with Myers' bit-vector algorithm
+     * @details The column of the edit distance matrix at every source byte is kept as two bit vectors of vertical +1 and -1
+     * deltas, one bit per pattern byte, and advanced with a handful of word operations; only the score of the last row is
+     * tracked. A pattern longer than 64 bytes spans several words, and the horizontal delta of the last row of a word is
+     * carried into the next one, as in Hyyrö's blocked formulation.
+     * @see https://doi.org/10.1145/316542.316550
+     */
+    class MyersPattern final : public IApproximatePattern
+    {
+    public:
+        /**
+         * @brief Compile a pattern
+         * @param values_to_search The data to search for
+         * @param max_distance The largest number of edits, capped to the pattern length minus one
+         */
+        MyersPattern(const std::span<const std::byte> values_to_search, const std::size_t max_distance) noexcept;
+
+        /**
+         * @brief Destructor
+         * @details Virtual destructor
+         * @note Virtual destructor
+         */
+        virtual ~MyersPattern() = default;
+
+        /**
+         * @brief Get the pattern
+         * @return The data to search for
+         */
+        virtual const std::vector<std::byte>& GetPattern() const noexcept override;
+
+        /**
+         * @brief Get the metric
+         * @return ApproximateMetric::Levenshtein
+         */
+        virtual ApproximateMetric GetMetric() const noexcept override;
+
+        /**
+         * @brief Get the maximum distance
+         * @return The largest number of edits of a match
+         */
+        virtual std::size_t GetMaxDistance() const noexcept override;
+
+        /**
+         * @brief Search for the pattern in a given source data
+         * @param source The source data to search in
+         * @return The match that ends first, moved forward while the distance keeps decreasing, and the shortest substring
+         * ending there at that distance
+         * @note If the pattern is not found, or is empty, the function will return an empty optional
+         * @note The start is found by a second pass backwards from the end, over at most the pattern length plus the distance
+         */
+        virtual std::optional<ApproximateMatch> Search(const std::span<const std::byte> source) const noexcept override;
+
+    private:
+        static constexpr std::size_t StackWords = 16; //!< Delta words kept on the stack; longer patterns are allocated
+
+        std::vector<std::byte>     m_Pattern;     //!< The data to search for
+        std::size_t                m_MaxDistance; //!< The largest number of edits
+        std::size_t                m_Words;       //!< Words per bit vector
+        std::vector<std::uint64_t> m_Forward;     //!< Per byte value, m_Words words: bit i is set when the pattern byte i is that value
+        std::vector<std::uint64_t> m_Backward;    //!< The same masks for the reversed pattern
+    };
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_MYERS_PATTERN_HPP__
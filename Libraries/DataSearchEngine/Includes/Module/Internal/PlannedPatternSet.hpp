@@ -0,0 +1,107 @@
+#pragma once
+#ifndef __MODULE_PLANNED_PATTERN_SET_HPP__ // clang-format off
+#define __MODULE_PLANNED_PATTERN_SET_HPP__ // clang-format on
+
+ #include "Module/IPatternSet.hpp"
+ #include "Module/Internal/ByteFingerprint.hpp"
+ #include <array>
+ #include <memory>
+ #include <utility>
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Pattern set split in tiers by pattern length
+     * @details The 1-byte patterns are answered with a 256-bit byte presence bitmap, the 2-byte patterns with a 64K-bit
+     * bigram bitmap, and only the longer patterns are sent to a real searcher, itself a pattern set. Given the fingerprints
+     * of the longer patterns, the real searcher is skipped for the sources none of them can occur in.
+     * @note Built by DataSearchPlanner; the answers are the ones of searching every pattern on its own.
+     */
+    class PlannedPatternSet final : public IPatternSet
+    {
+    public:
+        /**
+         * @brief Split the patterns in tiers
+         * @param patterns The patterns
+         * @param long_patterns The patterns longer than 2 bytes, compiled by the real searcher
+         * @param long_indexes The index in patterns of every pattern of long_patterns
+         * @param long_fingerprints The fingerprint of every pattern of long_patterns, or none if long_patterns filters the sources itself
+         */
+        PlannedPatternSet(const std::vector<std::vector<std::byte>>& patterns, std::shared_ptr<const IPatternSet> long_patterns, std::vector<std::size_t> long_indexes, std::vector<ByteFingerprint> long_fingerprints) noexcept;
+
+        /**
+         * @brief Destructor
+         * @details Virtual destructor
+         * @note Virtual destructor
+         */
+        virtual ~PlannedPatternSet() = default;
+
+        /**
+         * @brief Get the number of patterns in the set
+         * @return The number of patterns, empty patterns included
+         */
+        virtual std::size_t GetPatternCount() const noexcept override;
+
+        /**
+         * @brief Search for every pattern of the set in a given source data
+         * @param source The source data to search in
+         * @return The leftmost match; among matches at the same offset, the one with the lowest pattern index
+         * @note The leftmost match of every tier is found, then the best one is kept
+         */
+        virtual std::optional<PatternMatch> Search(const std::span<const std::byte> source) const noexcept override;
+
+        /**
+         * @brief Check if any pattern of the set occurs in a given source data
+         * @param source The source data to search in
+         * @return True if Search would find a match
+         * @note The cheap tiers are checked first; the real searcher only runs if they found nothing
+         */
+        virtual bool Contains(const std::span<const std::byte> source) const noexcept override;
+
+        /**
+         * @brief Find every pattern of the set that occurs in a given source data
+         * @param source The source data to search in
+         * @param matches A cleared bitset of GetPatternCount() bits, set for every pattern that occurs
+         * @note The 1-byte patterns are matched against the bytes present in the source, the 2-byte ones against its bigrams
+         */
+        virtual void Match(const std::span<const std::byte> source, const std::span<std::uint64_t> matches) const noexcept override;
+
+    private:
+        /**
+         * @brief Leftmost offset of a 1-byte pattern.
+         */
+        std::optional<std::size_t> FindByte(const std::span<const std::byte> source) const noexcept;
+
+        /**
+         * @brief Leftmost offset of a 2-byte pattern.
+         */
+        std::optional<std::size_t> FindBigram(const std::span<const std::byte> source) const noexcept;
+
+        /**
+         * @brief Check if a pattern longer than 2 bytes may occur in the source.
+         */
+        bool MayContainLong(const std::span<const std::byte> source) const noexcept;
+
+        /**
+         * @brief Read a bigram.
+         */
+        static std::size_t GetBigram(const std::byte first, const std::byte second) noexcept;
+
+    private:
+        static constexpr std::size_t None        = SIZE_MAX; //!< No pattern
+        static constexpr std::size_t InlineWords = 4;        //!< Words of the long pattern bitset Match keeps on the stack: 256 long patterns
+
+        std::array<std::uint64_t, 4>                     m_Bytes;            //!< Bitmap of the 1-byte patterns
+        std::array<std::size_t, 256>                     m_ByteIndexes;      //!< Lowest index of the 1-byte pattern of every byte
+        std::vector<std::pair<std::size_t, std::size_t>> m_BytePatterns;     //!< Byte and index of every 1-byte pattern
+        std::vector<std::uint64_t>                       m_Bigrams;          //!< Bitmap of the 2-byte patterns, empty if there are none
+        std::vector<std::pair<std::size_t, std::size_t>> m_BigramIndexes;    //!< Bigram and index of every 2-byte pattern, sorted
+        std::shared_ptr<const IPatternSet>               m_LongPatterns;     //!< The patterns longer than 2 bytes, nullptr if there are none
+        std::vector<std::size_t>                         m_LongIndexes;      //!< Index of every long pattern
+        std::vector<ByteFingerprint>                     m_LongFingerprints; //!< Fingerprint of every long pattern, empty if the sources are not filtered
+        std::size_t                                      m_PatternCount;     //!< Number of patterns
+        bool                                             m_HasBytes;         //!< Whether there are 1-byte patterns
+    };
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_PLANNED_PATTERN_SET_HPP__
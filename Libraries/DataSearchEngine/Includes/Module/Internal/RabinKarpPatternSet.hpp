@@ -0,0 +1,129 @@
+#pragma once
+#ifndef __MODULE_RABIN_KARP_PATTERN_SET_HPP__ // clang-format off
+#define __MODULE_RABIN_KARP_PATTERN_SET_HPP__ // clang-format on
+
+ #include "Module/IPatternSet.hpp"
+ #include "Helpers/ragged_array.hpp"
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Rabin-Karp pattern set, bucketed by prefix length
+     * @details Every pattern is keyed by its first 1, 2, 4 or 8 bytes, the largest of these that fits in it, so the patterns
+     * fall in at most 4 prefix classes. A single pass over the source reads the 8 bytes at every offset once and masks the
+     * key of every class out of them: the window hashes are never recomputed per pattern length. Every key is tested
+     * against a bitmap of the hashed keys of its class first, and only the few that pass probe the compact open-addressing
+     * table of the class; the rest of the pattern bytes are only compared on a key hit. Memory is linear in the total
+     * pattern bytes.
+     */
+    class RabinKarpPatternSet final : public IPatternSet
+    {
+    public:
+        /**
+         * @brief Hash the patterns and build the tables
+         * @param patterns The patterns
+         */
+        explicit RabinKarpPatternSet(const std::vector<std::vector<std::byte>>& patterns) noexcept;
+
+        /**
+         * @brief Destructor
+         * @details Virtual destructor
+         * @note Virtual destructor
+         */
+        virtual ~RabinKarpPatternSet() = default;
+
+        /**
+         * @brief Get the number of patterns in the set
+         * @return The number of patterns, empty patterns included
+         */
+        virtual std::size_t GetPatternCount() const noexcept override;
+
+        /**
+         * @brief Search for every pattern of the set in a given source data
+         * @param source The source data to search in
+         * @return The leftmost match; among matches at the same offset, the one with the lowest pattern index
+         * @note One pass over the source; it stops at the first offset with a verified match.
+         */
+        virtual std::optional<PatternMatch> Search(const std::span<const std::byte> source) const noexcept override;
+
+        /**
+         * @brief Check if any pattern of the set occurs in a given source data
+         * @param source The source data to search in
+         * @return True if Search would find a match
+         * @note The pass stops at the first verified match.
+         */
+        virtual bool Contains(const std::span<const std::byte> source) const noexcept override;
+
+        /**
+         * @brief Find every pattern of the set that occurs in a given source data
+         * @param source The source data to search in
+         * @param matches A cleared bitset of GetPatternCount() bits, set for every pattern that occurs
+         * @note One full pass over the source; every verified key hit sets its pattern.
+         */
+        virtual void Match(const std::span<const std::byte> source, const std::span<std::uint64_t> matches) const noexcept override;
+
+    private:
+        static constexpr std::size_t None = SIZE_MAX; //!< No pattern
+
+        /**
+         * @brief Hash table slot: the run of entries of one key
+         */
+        struct Slot
+        {
+            std::uint64_t m_Key;   //!< The key of the entries
+            std::size_t   m_First; //!< First entry of the key in m_Entries, None for a free slot
+        };
+
+        /**
+         * @brief A pattern of a prefix class
+         */
+        struct Entry
+        {
+            std::uint64_t m_Key;     //!< The prefix bytes of the pattern
+            std::size_t   m_Pattern; //!< Index of the pattern
+        };
+
+        /**
+         * @brief Patterns keyed by the same number of prefix bytes
+         */
+        struct PrefixClass
+        {
+            std::size_t   m_Length;    //!< Number of prefix bytes, 1, 2, 4 or 8
+            std::uint64_t m_Mask;      //!< Keeps the prefix bytes of an 8-byte window
+            std::size_t   m_Gate;      //!< First word of the bitmap of the class in m_Gates
+            std::uint32_t m_GateShift; //!< 64 minus the number of bits of a bitmap index
+            std::size_t   m_Slots;     //!< First slot of the table of the class in m_Slots
+            std::size_t   m_SlotMask;  //!< Table size minus one, a power of two minus one
+            std::uint32_t m_SlotShift; //!< 64 minus the number of bits of a table index
+            std::size_t   m_Entries;   //!< End of the entries of the class in m_Entries
+        };
+
+        /**
+         * @brief Pass every verified match to a visitor, by increasing offset.
+         * @param visit Called with the offset and the lowest pattern index matching there; returns true to stop.
+         */
+        template<typename TVisit>
+        void Scan(const std::span<const std::byte> source, TVisit&& visit) const noexcept;
+
+        /**
+         * @brief Verify the patterns of a key hit at an offset.
+         * @param verified Called with the index of every pattern that occurs at the offset.
+         */
+        template<typename TVerified>
+        void Verify(const PrefixClass& prefix_class, const std::size_t first, const std::span<const std::byte> source, const std::size_t offset, TVerified&& verified) const noexcept;
+
+        /**
+         * @brief Read up to 8 bytes as a little endian key, the missing high bytes zero.
+         */
+        static std::uint64_t GetKey(const std::byte* data, const std::size_t size) noexcept;
+
+    private:
+        Helpers::ragged_array<std::byte> m_Patterns; //!< Every pattern, back to back
+        std::vector<PrefixClass>         m_Classes;  //!< One class per prefix length in use, by increasing length
+        std::vector<std::uint64_t>       m_Gates;    //!< The key bitmaps of every class, back to back
+        std::vector<Slot>                m_Slots;    //!< The tables of every class, back to back
+        std::vector<Entry>               m_Entries;  //!< The non-empty patterns, by class, then by key, then by index
+    };
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_RABIN_KARP_PATTERN_SET_HPP__
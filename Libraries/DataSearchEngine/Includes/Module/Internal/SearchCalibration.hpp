@@ -0,0 +1,79 @@
+#pragma once
+#ifndef __MODULE_SEARCH_CALIBRATION_HPP__ // clang-format off
+#define __MODULE_SEARCH_CALIBRATION_HPP__ // clang-format on
+
+ #include "Module/Internal/StrategySearcher.hpp"
+ #include <array>
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Search strategy thresholds measured on the current machine
+     * @details A short calibration run times every strategy on synthetic data, for every pattern length bucket (1, 2, 3-4,
+     * 5-8, 9-16, 17-32, 33-64, longer), source length bucket (up to 256 bytes, up to 8 KiB, longer) and entropy class
+     * (random bytes, 4-letter alphabet), and keeps the fastest one of every cell. There are two tables: one for single
+     * searches, where the preprocessing is paid on every call, and one for prepared patterns, where it is paid once.
+     * @note The calibration runs once per tier and process, on first use, and takes a few milliseconds
+     */
+    class SearchCalibration final
+    {
+    public:
+        static constexpr std::size_t PatternBuckets = 8; //!< Pattern length buckets
+        static constexpr std::size_t SourceBuckets  = 3; //!< Source length buckets
+        static constexpr std::size_t EntropyClasses = 2; //!< High and low entropy
+
+        /**
+         * @brief Run the calibration
+         * @param tier The instruction set tier of the Simd strategy
+         */
+        explicit SearchCalibration(const Helpers::cpu_tier tier) noexcept;
+
+        /**
+         * @brief Get the calibration of a tier
+         * @param tier The instruction set tier. It must be supported by the processor, see Helpers::resolve_cpu_tier
+         * @return The calibration, run on the first call for the tier
+         */
+        static const SearchCalibration& Get(const Helpers::cpu_tier tier) noexcept;
+
+        /**
+         * @brief Select the fastest strategy
+         * @param pattern The pattern
+         * @param source_bucket The length bucket of the source, see GetSourceBucket
+         * @param prepared Whether the preprocessing is paid once for many searches
+         * @return The strategy measured fastest for the cell
+         * @note The entropy of the pattern is only estimated if the two entropy classes disagree
+         */
+        SearchStrategy Select(const std::span<const std::byte> pattern, const std::size_t source_bucket, const bool prepared) const noexcept;
+
+        /**
+         * @brief Get the length bucket of a pattern
+         */
+        static std::size_t GetPatternBucket(const std::size_t pattern_size) noexcept;
+
+        /**
+         * @brief Get the length bucket of a source
+         */
+        static std::size_t GetSourceBucket(const std::size_t source_size) noexcept;
+
+        /**
+         * @brief Check if a pattern has low byte entropy
+         * @param pattern The pattern
+         * @return True if the Shannon entropy of its first 256 bytes is under 3/4 of the maximum for their length. Patterns under 4 bytes are never low entropy.
+         */
+        static bool IsLowEntropy(const std::span<const std::byte> pattern) noexcept;
+
+    private:
+        using table_type = std::array<SearchStrategy, PatternBuckets * SourceBuckets * EntropyClasses>; //!< One strategy per cell
+
+        /**
+         * @brief Index of a cell.
+         */
+        static std::size_t GetCell(const std::size_t pattern_bucket, const std::size_t source_bucket, const bool low_entropy) noexcept;
+
+    private:
+        table_type m_Single;   //!< Fastest strategies, preprocessing included
+        table_type m_Prepared; //!< Fastest strategies, search only
+    };
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_SEARCH_CALIBRATION_HPP__
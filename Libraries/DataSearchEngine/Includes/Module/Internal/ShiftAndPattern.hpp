@@ -0,0 +1,70 @@
+#pragma once
+#ifndef __MODULE_SHIFT_AND_PATTERN_HPP__ // clang-format off
+#define __MODULE_SHIFT_AND_PATTERN_HPP__ // clang-format on
+
+ #include "Module/IApproximatePattern.hpp"
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Hamming distance compiled pattern, searched with Shift-And
+     * @details Bit i of state d is set when the first i + 1 bytes of the pattern end at the current source byte with at most d
+     * substitutions. Every source byte shifts the k + 1 states by one bit, ANDs them with the mask of the byte and ORs in the
+     * previous state shifted, which spends one substitution; a pattern longer than 64 bytes spans several words per state.
+     * @note k + 1 states of one word per 64 bytes: the cost per source byte grows with the maximum distance
+     */
+    class ShiftAndPattern final : public IApproximatePattern
+    {
+    public:
+        /**
+         * @brief Compile a pattern
+         * @param values_to_search The data to search for
+         * @param max_distance The largest number of substitutions, capped to the pattern length
+         */
+        ShiftAndPattern(const std::span<const std::byte> values_to_search, const std::size_t max_distance) noexcept;
+
+        /**
+         * @brief Destructor
+         * @details Virtual destructor
+         * @note Virtual destructor
+         */
+        virtual ~ShiftAndPattern() = default;
+
+        /**
+         * @brief Get the pattern
+         * @return The data to search for
+         */
+        virtual const std::vector<std::byte>& GetPattern() const noexcept override;
+
+        /**
+         * @brief Get the metric
+         * @return ApproximateMetric::Hamming
+         */
+        virtual ApproximateMetric GetMetric() const noexcept override;
+
+        /**
+         * @brief Get the maximum distance
+         * @return The largest number of substitutions of a match
+         */
+        virtual std::size_t GetMaxDistance() const noexcept override;
+
+        /**
+         * @brief Search for the pattern in a given source data
+         * @param source The source data to search in
+         * @return The leftmost window of the length of the pattern with at most the maximum number of substitutions, and its
+         * number of substitutions
+         * @note If the pattern is not found, or is empty, the function will return an empty optional
+         */
+        virtual std::optional<ApproximateMatch> Search(const std::span<const std::byte> source) const noexcept override;
+
+    private:
+        static constexpr std::size_t StackWords = 256; //!< State words kept on the stack; larger states are allocated
+
+        std::vector<std::byte>     m_Pattern;     //!< The data to search for
+        std::size_t                m_MaxDistance; //!< The largest number of substitutions
+        std::size_t                m_Words;       //!< Words per state
+        std::vector<std::uint64_t> m_Masks;       //!< Per byte value, m_Words words: bit i is set when the pattern byte i is that value
+    };
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_SHIFT_AND_PATTERN_HPP__
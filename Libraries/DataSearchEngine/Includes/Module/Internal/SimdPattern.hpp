@@ -0,0 +1,60 @@
+#pragma once
+#ifndef __MODULE_SIMD_PATTERN_HPP__ // clang-format off
+#define __MODULE_SIMD_PATTERN_HPP__ // clang-format on
+
+ #include "Module/ICompiledPattern.hpp"
+ #include "Module/Internal/SimdSearchKernel.hpp"
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief SIMD compiled pattern
+     * @details Owns a copy of the pattern; searched with the first/last byte candidate filter kernel
+     * @note The kernel needs no tables: compiling copies the pattern and picks the kernel of its length bucket
+     */
+    class SimdPattern final : public ICompiledPattern
+    {
+    public:
+        /**
+         * @brief Compile a pattern
+         * @param values_to_search The data to search for
+         * @param kernel The search kernel of the length bucket of the pattern, chosen by the engine
+         */
+        SimdPattern(const std::vector<std::byte>& values_to_search, const SimdSearchKernel kernel) noexcept;
+
+        /**
+         * @brief Destructor
+         * @details Virtual destructor
+         * @note Virtual destructor
+         */
+        virtual ~SimdPattern() = default;
+
+        /**
+         * @brief Get the pattern
+         * @return The data to search for
+         */
+        virtual const std::vector<std::byte>& GetPattern() const noexcept override;
+
+        /**
+         * @brief Search for the pattern in a given source data
+         * @param source The source data to search in
+         * @return The index of the first occurrence of the pattern in the source data
+         * @note If the pattern is not found, the function will return an empty optional
+         */
+        virtual std::optional<int32_t> Search(const std::vector<std::byte>& source) const noexcept override;
+
+        /**
+         * @brief Search for the pattern in a given source data, without copies
+         * @param source The source data to search in
+         * @return The 64-bit offset of the first occurrence of the pattern in the source data
+         * @note If the pattern is not found, the function will return an empty optional
+         */
+        virtual std::optional<std::uint64_t> Search(const std::span<const std::byte> source) const noexcept override;
+
+    private:
+        std::vector<std::byte> m_Pattern; //!< The data to search for
+        SimdSearchKernel       m_Kernel;  //!< The search kernel
+    };
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_SIMD_PATTERN_HPP__
@@ -0,0 +1,44 @@
+#pragma once
+#ifndef __MODULE_SIMD_SEARCH_KERNEL_HPP__ // clang-format off
+#define __MODULE_SIMD_SEARCH_KERNEL_HPP__ // clang-format on
+
+ #include "Helpers/cpu_features.hpp"
+ #include <cinttypes>
+ #include <cstddef>
+ #include <optional>
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief SIMD first/last byte candidate filter search kernel.
+     * @details The first and last bytes of the pattern are broadcast into vector registers and compared with 16, 32 or 64
+     * source positions at once. The full pattern is only compared at the positions where both bytes match. The positions the
+     * vectors cannot cover are searched one by one, so the kernel never reads past the end of the source.
+     * @param source The source data to search in.
+     * @param source_size The size of the source data.
+     * @param pattern The data to search for.
+     * @param pattern_size The size of the data to search for.
+     * @return The index of the first occurrence of the pattern, or an empty optional if not found or if the pattern is empty.
+     */
+    using SimdSearchKernel = std::optional<std::size_t> (*)(const std::byte* source, const std::size_t source_size, const std::byte* pattern, const std::size_t pattern_size) noexcept;
+
+    /**
+     * @brief Get the search kernel of a tier, for patterns of any length.
+     * @param tier The instruction set tier: scalar, SSE2, AVX2 or AVX-512BW. Every tier returns the same index.
+     * @return The kernel. Only call it on a processor that supports the tier, see Helpers::resolve_cpu_tier.
+     */
+    SimdSearchKernel GetSimdSearchKernel(const Helpers::cpu_tier tier) noexcept;
+
+    /**
+     * @brief Get the search kernel of a tier, specialized for the length bucket of a pattern.
+     * @details One kernel per bucket: 1, 2, 3-4, 5-8, 9-16, 17-32 and longer. Single bytes go straight to memchr, 2 bytes
+     * need no verification, and up to 32 bytes the candidates are verified with two overlapping fixed-size compares
+     * (2, 4, 8 or 16 bytes) instead of memcmp. Choose the kernel once, when the pattern is compiled.
+     * @param tier The instruction set tier.
+     * @param pattern_size The size of the pattern. The kernel may only be called with patterns of the same bucket.
+     * @return The kernel. Only call it on a processor that supports the tier, see Helpers::resolve_cpu_tier.
+     */
+    SimdSearchKernel GetSimdSearchKernel(const Helpers::cpu_tier tier, const std::size_t pattern_size) noexcept;
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_SIMD_SEARCH_KERNEL_HPP__
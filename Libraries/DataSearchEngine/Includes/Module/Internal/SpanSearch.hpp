@@ -0,0 +1,112 @@
+#pragma once
+#ifndef __MODULE_SPAN_SEARCH_HPP__ // clang-format off
+#define __MODULE_SPAN_SEARCH_HPP__ // clang-format on
+
+ #include <cinttypes>
+ #include <cstddef>
+ #include <optional>
+ #include <span>
+ #include <vector>
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Write the offset of every occurrence of a pattern, overlapping ones included
+     * @param source The source data to search in
+     * @param pattern_size The length of the pattern. An empty pattern has no occurrence.
+     * @param offsets The buffer of the offsets
+     * @param find The searcher, called with a suffix of the source: returns the offset of the first occurrence in it
+     * @return The number of offsets written. It is offsets.size() if the buffer filled up; the search resumes from the last offset + 1.
+     */
+    template<typename TFind>
+    std::size_t FindAllOffsets(const std::span<const std::byte> source, const std::size_t pattern_size, const std::span<std::uint64_t> offsets, TFind&& find) noexcept
+    {
+        std::size_t count    = 0;
+        std::size_t position = 0;
+
+        while ( pattern_size > 0 && count < offsets.size() && position + pattern_size <= source.size() )
+        {
+            const std::optional<std::size_t> found = find(source.subspan(position));
+
+            if ( not found )
+            {
+                break;
+            }
+
+            position += *found;
+            offsets[count++] = position++;
+        }
+
+        return count;
+    }
+
+    /**
+     * @brief Append the offset of every occurrence of a pattern to a vector, overlapping ones included
+     * @param source The source data to search in
+     * @param pattern_size The length of the pattern. An empty pattern has no occurrence.
+     * @param base The offset of the source, added to every offset
+     * @param offsets The vector the offsets are appended to, in increasing order
+     * @param find The searcher, called with a suffix of the source: returns the offset of the first occurrence in it
+     * @note The vector grows by batches filled by FindAllOffsets; a full batch resumes from the last offset + 1.
+     */
+    template<typename TFind>
+    void AppendAllOffsets(const std::span<const std::byte> source, const std::size_t pattern_size, const std::uint64_t base, std::vector<std::uint64_t>& offsets, TFind&& find) noexcept
+    {
+        constexpr std::size_t BatchSize = 256; //!< Offsets per batch
+        std::size_t           position  = 0;
+
+        while ( position < source.size() )
+        {
+            const std::size_t count = offsets.size();
+
+            offsets.resize(count + BatchSize);
+            const std::size_t written = FindAllOffsets(source.subspan(position), pattern_size, std::span<std::uint64_t>{ offsets }.subspan(count), find);
+            offsets.resize(count + written);
+
+            for ( std::size_t index = count; index < offsets.size(); ++index )
+            {
+                offsets[index] += base + position;
+            }
+
+            if ( written < BatchSize )
+            {
+                break;
+            }
+
+            position = static_cast<std::size_t>(offsets.back() - base) + 1;
+        }
+    }
+
+    /**
+     * @brief Count the occurrences of a pattern
+     * @param source The source data to search in
+     * @param pattern_size The length of the pattern. An empty pattern has no occurrence.
+     * @param overlapping Whether an occurrence may start inside the previous one
+     * @param find The searcher, called with a suffix of the source: returns the offset of the first occurrence in it
+     * @return The number of occurrences
+     */
+    template<typename TFind>
+    std::uint64_t CountOffsets(const std::span<const std::byte> source, const std::size_t pattern_size, const bool overlapping, TFind&& find) noexcept
+    {
+        const std::size_t step     = overlapping ? 1 : pattern_size; //!< Distance from an occurrence to the first offset of the next one
+        std::uint64_t     count    = 0;
+        std::size_t       position = 0;
+
+        while ( pattern_size > 0 && position + pattern_size <= source.size() )
+        {
+            const std::optional<std::size_t> found = find(source.subspan(position));
+
+            if ( not found )
+            {
+                break;
+            }
+
+            position += *found + step;
+            ++count;
+        }
+
+        return count;
+    }
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_SPAN_SEARCH_HPP__
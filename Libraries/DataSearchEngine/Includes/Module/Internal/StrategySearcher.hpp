@@ -0,0 +1,69 @@
+#pragma once
+#ifndef __MODULE_STRATEGY_SEARCHER_HPP__ // clang-format off
+#define __MODULE_STRATEGY_SEARCHER_HPP__ // clang-format on
+
+ #include "Module/Internal/SimdSearchKernel.hpp"
+ #include "Module/Internal/TwoWaySearcher.hpp"
+ #include <functional>
+ #include <span>
+ #include <variant>
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Single pattern search algorithms
+     */
+    enum class SearchStrategy : std::uint8_t
+    {
+        Simd,       //!< First/last byte candidate filter (naive scan on the scalar tier), no preprocessing
+        Horspool,   //!< Boyer-Moore-Horspool: bad character table only
+        BoyerMoore, //!< Boyer-Moore: bad character and good suffix tables
+        TwoWay      //!< Crochemore-Perrin two-way: critical factorization, no table
+    };
+
+    /**
+     * @brief Number of search strategies
+     */
+    inline constexpr std::size_t SearchStrategyCount = 4;
+
+    /**
+     * @brief Searcher of one pattern with one strategy
+     * @details Builds the preprocessing of the strategy once, then searches any number of sources
+     * @note The searcher refers to the pattern: the pattern must outlive it
+     */
+    class StrategySearcher final
+    {
+    public:
+        /**
+         * @brief Build the preprocessing of a strategy
+         * @param strategy The search algorithm
+         * @param tier The instruction set tier of the Simd strategy
+         * @param pattern The data to search for
+         */
+        StrategySearcher(const SearchStrategy strategy, const Helpers::cpu_tier tier, const std::span<const std::byte> pattern) noexcept;
+
+        /**
+         * @brief Search for the pattern in a given source data
+         * @param source The source data to search in
+         * @return The offset of the first occurrence of the pattern, or an empty optional if not found or if the pattern is empty
+         */
+        std::optional<std::size_t> Search(const std::span<const std::byte> source) const noexcept;
+
+    private:
+        using iterator_type    = std::span<const std::byte>::iterator;                  //!< Pattern iterator type
+        using horspool_type    = std::boyer_moore_horspool_searcher<iterator_type>;     //!< Horspool searcher type
+        using boyer_moore_type = std::boyer_moore_searcher<iterator_type>;              //!< Boyer-Moore searcher type
+        using searcher_type    = std::variant<SimdSearchKernel, horspool_type, boyer_moore_type, TwoWaySearcher>; //!< One alternative per strategy
+
+        /**
+         * @brief Build the searcher of a strategy.
+         */
+        static searcher_type MakeSearcher(const SearchStrategy strategy, const Helpers::cpu_tier tier, const std::span<const std::byte> pattern) noexcept;
+
+    private:
+        std::span<const std::byte> m_Pattern;  //!< The data to search for
+        searcher_type              m_Searcher; //!< The preprocessed searcher
+    };
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_STRATEGY_SEARCHER_HPP__
@@ -0,0 +1,56 @@
+#pragma once
+#ifndef __MODULE_SUFFIX_ARRAY_HPP__ // clang-format off
+#define __MODULE_SUFFIX_ARRAY_HPP__ // clang-format on
+
+ #include <cinttypes>
+ #include <cstddef>
+ #include <span>
+ #include <vector>
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Suffix array and LCP array of a set of sources.
+     * @details The sources are stored back to back, as in Helpers::ragged_array: source i is [offsets[i], offsets[i + 1]) of the
+     * values. Every suffix is cut at the end of its source, the end sorting before every byte, so no suffix spans two sources.
+     * Equal suffixes are sorted by position. lcp[i] is the length of the longest common prefix of the suffixes at suffix_array[i - 1]
+     * and suffix_array[i], lcp[0] is 0.
+     */
+    struct SuffixArray
+    {
+        std::vector<std::uint64_t> m_Positions; //!< Start of every suffix, in sorted order
+        std::vector<std::uint64_t> m_Lcp;       //!< Common prefix of every suffix with the previous one
+    };
+
+    /**
+     * @brief Get a suffix, cut at the end of its source
+     * @param values The sources, back to back
+     * @param offsets The source boundaries, starting at 0 and ending at values.size()
+     * @param position The start of the suffix, smaller than values.size()
+     * @return The suffix
+     */
+    std::span<const std::byte> GetSuffix(const std::span<const std::byte> values, const std::span<const std::size_t> offsets, const std::uint64_t position) noexcept;
+
+    /**
+     * @brief Build the suffix array and the LCP array of a set of sources
+     * @details Prefix doubling with two counting sorts per round, O(n log L) for L the longest source, then Kasai's LCP in O(n).
+     * @param values The sources, back to back
+     * @param offsets The source boundaries, starting at 0 and ending at values.size()
+     * @return The arrays, one entry per byte of the sources
+     */
+    SuffixArray BuildSuffixArray(const std::span<const std::byte> values, const std::span<const std::size_t> offsets) noexcept;
+
+    /**
+     * @brief Merge two suffix arrays of disjoint sources into one
+     * @details LCP-aware merge: a suffix that shares a longer prefix with the last merged one than the other head is the smaller,
+     * so bytes are only compared when both heads share the same prefix, and from the end of it. The merged LCP array is a by-product.
+     * @param values The sources of both arrays, back to back
+     * @param offsets The source boundaries of both arrays
+     * @param first The first array. Its positions must all be smaller than the ones of the second, so equal suffixes keep sorted by position.
+     * @param second The second array
+     * @return The merged arrays
+     */
+    SuffixArray MergeSuffixArrays(const std::span<const std::byte> values, const std::span<const std::size_t> offsets, const SuffixArray& first, const SuffixArray& second) noexcept;
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_SUFFIX_ARRAY_HPP__
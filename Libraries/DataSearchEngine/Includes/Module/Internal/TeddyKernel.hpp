@@ -0,0 +1,64 @@
+#pragma once
+#ifndef __MODULE_TEDDY_KERNEL_HPP__ // clang-format off
+#define __MODULE_TEDDY_KERNEL_HPP__ // clang-format on
+
+ #include "Helpers/cpu_features.hpp"
+ #include <array>
+ #include <cinttypes>
+ #include <cstddef>
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Candidate filter tables of a Teddy pattern set.
+     * @details The patterns are spread over 8 buckets, one bit each. For every one of the first m_Length bytes of the patterns,
+     * a byte b at that position passes the buckets m_Low[j][b & 15] & m_High[j][b >> 4] in the vector kernels, and the
+     * buckets m_Bytes[j][b] in the scalar kernel. A position is a candidate for the buckets every fingerprint byte passes.
+     * The 16-entry nibble tables are stored 4 times over, once per 128-bit lane of the widest vector: the byte shuffle
+     * looks up inside each lane, and every vector width loads its tables directly.
+     */
+    struct TeddyMasks
+    {
+        std::size_t                                  m_Length; //!< Fingerprint length, 1 to 4 bytes
+        std::array<std::array<std::uint8_t, 64>, 4>  m_Low;    //!< Buckets per low nibble, per fingerprint byte, repeated per lane
+        std::array<std::array<std::uint8_t, 64>, 4>  m_High;   //!< Buckets per high nibble, per fingerprint byte, repeated per lane
+        std::array<std::array<std::uint8_t, 256>, 4> m_Bytes;  //!< Buckets per byte, per fingerprint byte: exact, for the scalar kernel
+    };
+
+    /**
+     * @brief Candidates of up to 64 consecutive positions.
+     */
+    struct TeddyBlock
+    {
+        std::size_t                  m_Position; //!< First position of the block
+        std::uint64_t                m_Lanes;    //!< Bit i is set if position + i is a candidate
+        std::array<std::uint8_t, 64> m_Buckets;  //!< Buckets of every candidate position, by lane
+    };
+
+    /**
+     * @brief Teddy candidate filter kernel.
+     * @details Finds the next block of positions with candidates, 16 to 64 positions per step: every fingerprint byte of every
+     * position is split into its two nibbles, looked up in the nibble tables with one byte shuffle each, and the bucket
+     * bytes are combined with AND. The few lanes that pass are narrowed with the byte tables. The positions the vectors
+     * cannot cover are filtered one by one with the byte tables, so the kernel never reads past the end of the source.
+     * @param masks The filter tables.
+     * @param source The source data to search in.
+     * @param source_size The size of the source data, at least the fingerprint length.
+     * @param end The end of the positions to filter, at most source_size - m_Length + 1.
+     * @param position The first position to filter; advanced past the block returned.
+     * @param block Receives the block.
+     * @return True if a block with candidates was found, false once every position up to end was filtered.
+     */
+    using TeddyKernel = bool (*)(const TeddyMasks& masks, const std::byte* source, const std::size_t source_size, const std::size_t end, std::size_t& position, TeddyBlock& block) noexcept;
+
+    /**
+     * @brief Get the filter kernel of a tier, for one fingerprint length.
+     * @param tier The instruction set tier: scalar, SSE2, AVX2 or AVX-512BW. The byte shuffle needs SSSE3, so the SSE2 tier
+     * gets the scalar kernel. Every tier reports the same candidates.
+     * @param length The fingerprint length, 1 to 4 bytes.
+     * @return The kernel. Only call it on a processor that supports the tier, see Helpers::resolve_cpu_tier.
+     */
+    TeddyKernel GetTeddyKernel(const Helpers::cpu_tier tier, const std::size_t length) noexcept;
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_TEDDY_KERNEL_HPP__
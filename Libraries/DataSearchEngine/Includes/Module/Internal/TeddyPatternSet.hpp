@@ -0,0 +1,115 @@
+#pragma once
+#ifndef __MODULE_TEDDY_PATTERN_SET_HPP__ // clang-format off
+#define __MODULE_TEDDY_PATTERN_SET_HPP__ // clang-format on
+
+ #include "Module/IPatternSet.hpp"
+ #include "Module/Internal/TeddyKernel.hpp"
+ #include "Helpers/ragged_array.hpp"
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Teddy pattern set: SIMD nibble filter, bucketed verification
+     * @details The patterns are sorted by their first bytes and cut into 8 buckets, so patterns that share a prefix share a
+     * bucket. TeddyKernel filters 16 to 64 source positions per step on the first 1 to 4 bytes of the patterns (as many as
+     * the shortest pattern has), and every candidate position is only verified against the patterns of the buckets it
+     * passed, found by a binary search on their first bytes.
+     * @note Made for small sets of short patterns: every bucket of a large set lets most bytes through, and the filter
+     * stops filtering. TeddySearchEngine compiles large sets into an Aho-Corasick automaton instead.
+     */
+    class TeddyPatternSet final : public IPatternSet
+    {
+    public:
+        /**
+         * @brief Bucket the patterns and build the filter tables
+         * @param patterns The patterns
+         * @param tier The instruction set tier of the filter kernel
+         * @note The tier must be supported by the processor, see Helpers::resolve_cpu_tier
+         */
+        TeddyPatternSet(const std::vector<std::vector<std::byte>>& patterns, const Helpers::cpu_tier tier) noexcept;
+
+        /**
+         * @brief Destructor
+         * @details Virtual destructor
+         * @note Virtual destructor
+         */
+        virtual ~TeddyPatternSet() = default;
+
+        /**
+         * @brief Get the number of patterns in the set
+         * @return The number of patterns, empty patterns included
+         */
+        virtual std::size_t GetPatternCount() const noexcept override;
+
+        /**
+         * @brief Search for every pattern of the set in a given source data
+         * @param source The source data to search in
+         * @return The leftmost match; among matches at the same offset, the one with the lowest pattern index
+         * @note The candidates come in increasing order: the search stops at the first one verified.
+         */
+        virtual std::optional<PatternMatch> Search(const std::span<const std::byte> source) const noexcept override;
+
+        /**
+         * @brief Check if any pattern of the set occurs in a given source data
+         * @param source The source data to search in
+         * @return True if Search would find a match
+         * @note Answered by Search: the leftmost match is the first one verified anyway.
+         */
+        virtual bool Contains(const std::span<const std::byte> source) const noexcept override;
+
+        /**
+         * @brief Find every pattern of the set that occurs in a given source data
+         * @param source The source data to search in
+         * @param matches A cleared bitset of GetPatternCount() bits, set for every pattern that occurs
+         * @note One filter pass; every candidate is verified against every pattern of its buckets.
+         */
+        virtual void Match(const std::span<const std::byte> source, const std::span<std::uint64_t> matches) const noexcept override;
+
+        /**
+         * @brief Check if the set rejects the sources without a match itself, before any per-pattern work
+         * @return True: the SIMD nibble filter rejects a source faster than byte fingerprints would
+         */
+        virtual bool HasOwnPrefilter() const noexcept override;
+
+    private:
+        static constexpr std::size_t BucketCount = 8; //!< One bit of a filter byte per bucket
+
+        /**
+         * @brief A pattern of a bucket
+         */
+        struct Entry
+        {
+            std::uint32_t m_Key;     //!< The fingerprint bytes of the pattern
+            std::size_t   m_Pattern; //!< Index of the pattern
+        };
+
+        /**
+         * @brief Filter the source and pass every candidate position to a visitor, in increasing order.
+         * @param visit Called with the position and its buckets; returns true to stop.
+         */
+        template<typename TVisit>
+        void Scan(const std::span<const std::byte> source, TVisit&& visit) const noexcept;
+
+        /**
+         * @brief Verify a candidate position against the patterns of its buckets.
+         * @param verified Called with the index of every pattern that occurs at the position.
+         */
+        template<typename TVerified>
+        void Verify(const std::span<const std::byte> source, const std::size_t position, const std::uint8_t buckets, TVerified&& verified) const noexcept;
+
+        /**
+         * @brief The fingerprint bytes at some data, as one word.
+         */
+        std::uint32_t GetKey(const std::byte* data) const noexcept;
+
+    private:
+        Helpers::ragged_array<std::byte>         m_Patterns; //!< Every pattern, back to back
+        std::size_t                              m_Shortest; //!< Length of the shortest non-empty pattern
+        TeddyMasks                               m_Masks;    //!< Filter tables
+        TeddyKernel                              m_Kernel;   //!< Filter kernel of the tier and the fingerprint length
+        std::vector<Entry>                       m_Entries;  //!< The non-empty patterns, by bucket, then by key
+        std::array<std::size_t, BucketCount + 1> m_Buckets;  //!< First entry of every bucket, then the entry count
+    };
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_TEDDY_PATTERN_SET_HPP__
@@ -0,0 +1,50 @@
+#pragma once
+#ifndef __MODULE_TEDDY_SEARCH_ENGINE_HPP__ // clang-format off
+#define __MODULE_TEDDY_SEARCH_ENGINE_HPP__ // clang-format on
+
+ #include "Module/IMultiPatternSearchEngine.hpp"
+ #include "Module/Internal/DelegatingSearchEngine.hpp"
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Teddy data search engine
+     * @details Compiles small pattern sets into a TeddyPatternSet, and the sets too large for its 8 buckets into an
+     * AhoCorasickPatternSet; single patterns are searched with the adaptive engine
+     * @note Single patterns are delegated to AdaptiveSearchEngine by DelegatingSearchEngine
+     */
+    struct TeddySearchEngine final : public DelegatingSearchEngine, public IMultiPatternSearchEngine
+    {
+        /**
+         * @brief Constructor
+         * @param tier The instruction set tier of the single pattern searches and of the pattern set filter
+         * @note The tier must be supported by the processor, see Helpers::resolve_cpu_tier
+         */
+        explicit TeddySearchEngine(const Helpers::cpu_tier tier) noexcept;
+
+        /**
+         * @brief Destructor
+         * @details Virtual destructor
+         * @note Virtual destructor
+         */
+        virtual ~TeddySearchEngine() = default;
+
+        using DelegatingSearchEngine::Compile; //!< The single pattern compiles, hidden by the overload below
+
+        /**
+         * @brief Compile a set of patterns into SIMD filter tables and buckets
+         * @param patterns The data to search for
+         * @return The compiled, immutable pattern set
+         * @note Sets of more than MaxPatternsPerByte non-empty patterns per fingerprint byte are compiled into an Aho-Corasick
+         * automaton: every fingerprint byte filters, so the longer the shortest pattern, the larger the set the buckets can take
+         */
+        virtual std::shared_ptr<const IPatternSet> Compile(const std::vector<std::vector<std::byte>>& patterns) const noexcept override;
+
+        static constexpr std::size_t MaxPatternsPerByte = 64; //!< Largest set the buckets still filter, per fingerprint byte
+
+    private:
+        Helpers::cpu_tier m_Tier; //!< Instruction set tier of the pattern set filter
+    };
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_TEDDY_SEARCH_ENGINE_HPP__
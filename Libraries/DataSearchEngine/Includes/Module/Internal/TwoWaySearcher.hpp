@@ -0,0 +1,44 @@
+#pragma once
+#ifndef __MODULE_TWO_WAY_SEARCHER_HPP__ // clang-format off
+#define __MODULE_TWO_WAY_SEARCHER_HPP__ // clang-format on
+
+ #include <cinttypes>
+ #include <cstddef>
+ #include <optional>
+ #include <span>
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Two-way string matching searcher
+     * @details Crochemore-Perrin: the pattern is split at a critical factorization, the right part is matched forwards and
+     * the left part backwards, and the shifts use the period of the pattern. Linear time, constant extra space and no table
+     * to build, so it never degrades on low entropy data the way the skip tables of Boyer-Moore do.
+     * @note The searcher refers to the pattern: the pattern must outlive it
+     * @see https://doi.org/10.1145/116825.116845
+     */
+    class TwoWaySearcher final
+    {
+    public:
+        /**
+         * @brief Compute the critical factorization and the period of a pattern
+         * @param pattern The data to search for
+         */
+        explicit TwoWaySearcher(const std::span<const std::byte> pattern) noexcept;
+
+        /**
+         * @brief Search for the pattern in a given source data
+         * @param source The source data to search in
+         * @return The offset of the first occurrence of the pattern, or an empty optional if not found or if the pattern is empty
+         */
+        std::optional<std::size_t> Search(const std::span<const std::byte> source) const noexcept;
+
+    private:
+        std::span<const std::byte> m_Pattern;  //!< The data to search for
+        std::size_t                m_Suffix;   //!< Start of the right part of the critical factorization
+        std::size_t                m_Period;   //!< Shift after a full match; the period if m_Periodic
+        bool                       m_Periodic; //!< Whether the left part repeats with the period, so matched bytes can be remembered
+    };
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_TWO_WAY_SEARCHER_HPP__
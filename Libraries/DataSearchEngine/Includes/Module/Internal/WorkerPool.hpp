@@ -0,0 +1,60 @@
+#pragma once
+#ifndef __MODULE_WORKER_POOL_HPP__ // clang-format off
+#define __MODULE_WORKER_POOL_HPP__ // clang-format on
+
+ #include <atomic>
+ #include <cstddef>
+ #include <thread>
+ #include <vector>
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Get the number of workers to run
+     * @param requested The requested number, 0 for one per hardware thread
+     * @return The number of workers, at least 1
+     */
+    inline std::size_t GetWorkerCount(const std::size_t requested) noexcept
+    {
+        const std::size_t hardware_concurrency = std::thread::hardware_concurrency();
+        return requested != 0 ? requested : (hardware_concurrency == 0 ? 2 : hardware_concurrency);
+    }
+
+    /**
+     * @brief Run numbered tasks on a pool of workers
+     * @details The workers take the task indices from a shared counter, so the tasks are started in increasing order and a
+     * slow task does not hold back the others. The calling thread is one of the workers; no thread is started for a single one.
+     * @param task_count The number of tasks
+     * @param worker_count The number of workers. Capped by the number of tasks.
+     * @param work Called with a task index; returns false to stop the worker, e.g. because the remaining tasks are useless
+     */
+    template<typename TWork>
+    void RunWorkers(const std::size_t task_count, const std::size_t worker_count, TWork&& work) noexcept
+    {
+        std::atomic<std::size_t> next{ 0 };
+        const auto               worker = [task_count, &work, &next]() noexcept
+        {
+            for ( std::size_t index = next.fetch_add(1, std::memory_order_relaxed); index < task_count && work(index); index = next.fetch_add(1, std::memory_order_relaxed) )
+            {
+            }
+        };
+
+        const std::size_t        thread_count = worker_count < task_count ? worker_count : task_count;
+        std::vector<std::thread> threads;
+        threads.reserve(thread_count > 0 ? thread_count - 1 : 0);
+
+        for ( std::size_t index = 1; index < thread_count; ++index )
+        {
+            threads.emplace_back(worker);
+        }
+
+        worker();
+
+        for ( auto& thread : threads )
+        {
+            thread.join();
+        }
+    }
+} // namespace Program::Module::Internal
+
+#endif // __MODULE_WORKER_POOL_HPP__
@@ -0,0 +1,294 @@
+#include "Module/DataFileSearcher.hpp"
+#include "Module/Internal/WorkerPool.hpp"
+#include "Module/Internal/SpanSearch.hpp"
+#include <algorithm>
+#include <atomic>
+#include <limits>
+
+#if defined(_WIN32)
+ #define WIN32_LEAN_AND_MEAN
+ #define NOMINMAX
+ #include <Windows.h>
+#else
+ #include <fcntl.h>
+ #include <sys/mman.h>
+ #include <sys/stat.h>
+ #include <unistd.h>
+#endif
+
+namespace
+{
+    constexpr std::size_t   MinChunkSize    = std::size_t{ 1 } << 20;                   //!< Smallest chunk: below it the threads cost more than they save
+    constexpr std::size_t   ChunksPerThread = 4;                                        //!< Chunks per worker, so a worker that found a match early frees the others
+    constexpr std::uint64_t NotFound        = std::numeric_limits<std::uint64_t>::max(); //!< Earliest offset before any match
+
+    /**
+     * @brief Cut of a source into chunks.
+     */
+    struct ChunkPlan
+    {
+        std::size_t m_ChunkSize;   //!< Length of every chunk but the last, overlap excluded
+        std::size_t m_ChunkCount;  //!< Number of chunks
+        std::size_t m_ThreadCount; //!< Number of workers, the calling thread included
+    };
+
+    /**
+     * @brief Cut a source into chunks.
+     * @param source_size The length of the source.
+     * @param thread_count The requested number of workers, 0 for one per hardware thread.
+     * @return The plan. There are never more workers than chunks.
+     */
+    ChunkPlan PlanChunks(const std::size_t source_size, const std::size_t thread_count) noexcept
+    {
+        const std::size_t threads     = Program::Module::Internal::GetWorkerCount(thread_count);
+        const std::size_t chunk_size  = std::max(MinChunkSize, (source_size + threads * ChunksPerThread - 1) / (threads * ChunksPerThread));
+        const std::size_t chunk_count = (source_size + chunk_size - 1) / chunk_size;
+
+        return { chunk_size, chunk_count, std::min(threads, chunk_count) };
+    }
+
+    /**
+     * @brief Get the bytes a chunk searches.
+     * @param source The source.
+     * @param plan The plan.
+     * @param index The chunk index.
+     * @param overlap The pattern length - 1: the bytes of the next chunk a match starting in this one can reach.
+     * @return The chunk followed by the overlap, truncated at the end of the source.
+     */
+    std::span<const std::byte> GetChunk(const std::span<const std::byte> source, const ChunkPlan& plan, const std::size_t index, const std::size_t overlap) noexcept
+    {
+        const std::size_t begin = index * plan.m_ChunkSize;
+        return source.subspan(begin, std::min(plan.m_ChunkSize + overlap, source.size() - begin));
+    }
+
+    /**
+     * @brief Map a whole file read-only.
+     * @param path The file to map.
+     * @param mapping Receives the mapping, nullptr if the file is empty.
+     * @param size Receives the file size.
+     * @return True on success, empty files included.
+     */
+    bool MapFile(const std::filesystem::path& path, const std::byte*& mapping, std::size_t& size) noexcept
+    {
+#if defined(_WIN32)
+        const HANDLE file = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+        if ( file == INVALID_HANDLE_VALUE )
+        {
+            return false;
+        }
+
+        LARGE_INTEGER file_size{};
+
+        if ( not ::GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0 )
+        {
+            const bool empty = file_size.QuadPart == 0;
+            ::CloseHandle(file);
+            return empty;
+        }
+
+        const HANDLE file_mapping = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        ::CloseHandle(file);
+
+        if ( file_mapping == nullptr )
+        {
+            return false;
+        }
+
+        const void* view = ::MapViewOfFile(file_mapping, FILE_MAP_READ, 0, 0, 0);
+        ::CloseHandle(file_mapping);
+
+        mapping = static_cast<const std::byte*>(view);
+        size    = static_cast<std::size_t>(file_size.QuadPart);
+        return view != nullptr;
+#else
+        const int32_t file = ::open(path.c_str(), O_RDONLY);
+
+        if ( file < 0 )
+        {
+            return false;
+        }
+
+        struct stat status{};
+        void*       view = MAP_FAILED;
+
+        if ( ::fstat(file, &status) == 0 && status.st_size == 0 )
+        {
+            ::close(file);
+            return true;
+        }
+
+        if ( status.st_size > 0 )
+        {
+            view = ::mmap(nullptr, static_cast<std::size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+        }
+
+        ::close(file);
+
+        if ( view == MAP_FAILED )
+        {
+            return false;
+        }
+
+        ::madvise(view, static_cast<std::size_t>(status.st_size), MADV_SEQUENTIAL); //!< Every chunk is read front to back: let the kernel read ahead.
+
+        mapping = static_cast<const std::byte*>(view);
+        size    = static_cast<std::size_t>(status.st_size);
+        return true;
+#endif
+    }
+} // namespace
+
+/**
+ * @brief Map a file.
+ * @param path The file to map.
+ * @return The searcher, or nullptr if the file cannot be mapped.
+ */
+std::shared_ptr<Program::Module::DataFileSearcher> Program::Module::DataFileSearcher::Open(const std::filesystem::path& path) noexcept
+{
+    std::shared_ptr<DataFileSearcher> searcher{ new DataFileSearcher{} };
+    return MapFile(path, searcher->m_Mapping, searcher->m_MappingSize) ? searcher : nullptr;
+}
+
+/**
+ * @brief Unmap the file.
+ */
+Program::Module::DataFileSearcher::~DataFileSearcher() noexcept
+{
+    if ( m_Mapping != nullptr )
+    {
+#if defined(_WIN32)
+        ::UnmapViewOfFile(m_Mapping);
+#else
+        ::munmap(const_cast<std::byte*>(m_Mapping), m_MappingSize);
+#endif
+    }
+}
+
+/**
+ * @brief Get the content of the file.
+ * @return A view of the mapping.
+ */
+std::span<const std::byte> Program::Module::DataFileSearcher::GetData() const noexcept
+{
+    return { m_Mapping, m_MappingSize };
+}
+
+/**
+ * @brief Search for the first occurrence of a pattern in the file.
+ * @param pattern The compiled pattern.
+ * @param thread_count The number of worker threads.
+ * @return The offset of the first occurrence.
+ */
+std::optional<std::uint64_t> Program::Module::DataFileSearcher::Search(const ICompiledPattern& pattern, const std::size_t thread_count) const noexcept
+{
+    return Search(GetData(), pattern, thread_count);
+}
+
+/**
+ * @brief Search for every occurrence of a pattern in the file.
+ * @param pattern The compiled pattern.
+ * @param thread_count The number of worker threads.
+ * @return The offsets of the occurrences.
+ */
+std::vector<std::uint64_t> Program::Module::DataFileSearcher::FindAll(const ICompiledPattern& pattern, const std::size_t thread_count) const noexcept
+{
+    return FindAll(GetData(), pattern, thread_count);
+}
+
+/**
+ * @brief Search for the first occurrence of a pattern in a buffer, on several threads.
+ * @param source The source data.
+ * @param pattern The compiled pattern.
+ * @param thread_count The number of worker threads.
+ * @return The offset of the first occurrence.
+ * @note A match found in a chunk starts inside it, the overlap only completes it, so the earliest match over the chunks is the
+ * first occurrence. The chunks are started in increasing order: once one starts past the earliest match found so far, every
+ * later one does too, and the worker stops.
+ */
+std::optional<std::uint64_t> Program::Module::DataFileSearcher::Search(const std::span<const std::byte> source, const ICompiledPattern& pattern, const std::size_t thread_count) noexcept
+{
+    const std::size_t size = pattern.GetPattern().size();
+
+    if ( size == 0 || size > source.size() )
+    {
+        return std::nullopt;
+    }
+
+    const ChunkPlan            plan = PlanChunks(source.size(), thread_count);
+    std::atomic<std::uint64_t> earliest{ NotFound };
+
+    Internal::RunWorkers(plan.m_ChunkCount, plan.m_ThreadCount,
+                         [&](const std::size_t index) noexcept
+                         {
+                             const std::uint64_t begin = static_cast<std::uint64_t>(index) * plan.m_ChunkSize;
+
+                             if ( begin >= earliest.load(std::memory_order_relaxed) )
+                             {
+                                 return false;
+                             }
+
+                             if ( const auto found = pattern.Search(GetChunk(source, plan, index, size - 1)) )
+                             {
+                                 std::uint64_t current = earliest.load(std::memory_order_relaxed);
+
+                                 while ( begin + *found < current && not earliest.compare_exchange_weak(current, begin + *found, std::memory_order_relaxed) )
+                                 {
+                                 }
+                             }
+
+                             return true;
+                         });
+
+    const std::uint64_t found = earliest.load(std::memory_order_relaxed);
+    return found == NotFound ? std::nullopt : std::optional<std::uint64_t>{ found };
+}
+
+/**
+ * @brief Search for every occurrence of a pattern in a buffer, on several threads.
+ * @param source The source data.
+ * @param pattern The compiled pattern.
+ * @param thread_count The number of worker threads.
+ * @return The offsets of the occurrences.
+ * @note A match that starts in the overlap of a chunk does not fit in it, so every chunk only reports the matches that start
+ * inside it and a match is reported once; the per-chunk lists are already sorted and are concatenated in chunk order.
+ */
+std::vector<std::uint64_t> Program::Module::DataFileSearcher::FindAll(const std::span<const std::byte> source, const ICompiledPattern& pattern, const std::size_t thread_count) noexcept
+{
+    const std::size_t size = pattern.GetPattern().size();
+
+    if ( size == 0 || size > source.size() )
+    {
+        return {};
+    }
+
+    const ChunkPlan                         plan = PlanChunks(source.size(), thread_count);
+    std::vector<std::vector<std::uint64_t>> chunk_offsets(plan.m_ChunkCount);
+
+    Internal::RunWorkers(plan.m_ChunkCount, plan.m_ThreadCount,
+                         [&](const std::size_t index) noexcept
+                         {
+                             const std::uint64_t begin = static_cast<std::uint64_t>(index) * plan.m_ChunkSize;
+
+                             Internal::AppendAllOffsets(GetChunk(source, plan, index, size - 1), size, begin, chunk_offsets[index], [&pattern](const std::span<const std::byte> suffix) noexcept { return pattern.Search(suffix); });
+
+                             return true;
+                         });
+
+    std::size_t total = 0;
+
+    for ( const auto& offsets : chunk_offsets )
+    {
+        total += offsets.size();
+    }
+
+    std::vector<std::uint64_t> offsets;
+    offsets.reserve(total);
+
+    for ( const auto& chunk : chunk_offsets )
+    {
+        offsets.insert(offsets.end(), chunk.begin(), chunk.end());
+    }
+
+    return offsets;
+}
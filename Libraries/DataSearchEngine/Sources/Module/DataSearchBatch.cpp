@@ -0,0 +1,75 @@
+#include "Module/DataSearchBatch.hpp"
+#include "Module/Internal/WorkerPool.hpp"
+#include <algorithm>
+
+namespace
+{
+    constexpr std::size_t BlockSize = 256; //!< Sources per task: large enough to amortize the counter, small enough to balance the workers
+
+    /**
+     * @brief Run a function on every source of a batch, on a pool of workers.
+     * @param sources The sources.
+     * @param thread_count The requested number of workers.
+     * @param function Called with a source index and the source.
+     */
+    template<typename TFunction>
+    void ForEachSource(const Program::Helpers::ragged_array<std::byte>& sources, const std::size_t thread_count, TFunction&& function) noexcept
+    {
+        const std::size_t block_count = (sources.size() + BlockSize - 1) / BlockSize;
+
+        Program::Module::Internal::RunWorkers(block_count, Program::Module::Internal::GetWorkerCount(thread_count),
+                                              [&sources, &function](const std::size_t block) noexcept
+                                              {
+                                                  const std::size_t last = std::min(sources.size(), (block + 1) * BlockSize);
+
+                                                  for ( std::size_t index = block * BlockSize; index < last; ++index )
+                                                  {
+                                                      function(index, sources[index]);
+                                                  }
+
+                                                  return true;
+                                              });
+    }
+} // namespace
+
+/**
+ * @brief Find the leftmost match of a pattern set in every source of a batch.
+ * @param patterns The compiled pattern set.
+ * @param sources The sources.
+ * @param thread_count The number of worker threads.
+ * @return One result per source.
+ * @note Every worker writes the results of its own sources, so the workers share nothing but the read-only set and batch.
+ */
+std::vector<std::optional<Program::Module::PatternMatch>> Program::Module::DataSearchBatch::Search(const IPatternSet& patterns, const Helpers::ragged_array<std::byte>& sources, const std::size_t thread_count) noexcept
+{
+    std::vector<std::optional<PatternMatch>> results(sources.size());
+
+    ForEachSource(sources, thread_count, [&patterns, &results](const std::size_t index, const std::span<const std::byte> source) noexcept { results[index] = patterns.Search(source); });
+    return results;
+}
+
+/**
+ * @brief Find every pattern of a set that occurs in every source of a batch.
+ * @param patterns The compiled pattern set.
+ * @param sources The sources.
+ * @param thread_count The number of worker threads.
+ * @return One bitset per source, back to back.
+ */
+std::vector<std::uint64_t> Program::Module::DataSearchBatch::Match(const IPatternSet& patterns, const Helpers::ragged_array<std::byte>& sources, const std::size_t thread_count) noexcept
+{
+    const std::size_t          words = GetWordCount(patterns);
+    std::vector<std::uint64_t> matches(sources.size() * words, 0);
+
+    ForEachSource(sources, thread_count, [&patterns, &matches, words](const std::size_t index, const std::span<const std::byte> source) noexcept { patterns.Match(source, std::span{ matches }.subspan(index * words, words)); });
+    return matches;
+}
+
+/**
+ * @brief Get the number of 64-bit words of the bitset of one source.
+ * @param patterns The compiled pattern set.
+ * @return The number of words.
+ */
+std::size_t Program::Module::DataSearchBatch::GetWordCount(const IPatternSet& patterns) noexcept
+{
+    return (patterns.GetPatternCount() + 63) / 64;
+}
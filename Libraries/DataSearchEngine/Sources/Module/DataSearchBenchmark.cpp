@@ -0,0 +1,117 @@
+#include "Module/DataSearchBenchmark.hpp"
+#include "Module/DataSearchEngineFactory.hpp"
+#include "Module/DataSearchBatch.hpp"
+#include "Module/DataSearchPlanner.hpp"
+#include <algorithm>
+#include <iterator>
+
+namespace
+{
+    /**
+     * @brief Deterministic byte sequences of random length.
+     * @param count The number of sequences.
+     * @param state The SplitMix64 state.
+     * @return Sequences of 1 to 100 random bytes.
+     */
+    std::vector<std::vector<std::byte>> GenerateSequences(const std::size_t count, std::uint64_t& state) noexcept
+    {
+        const auto next = [&state]() noexcept
+        {
+            std::uint64_t z = (state += 0x9E3779B97F4A7C15);
+            z               = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+            z               = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+            return z ^ (z >> 31);
+        };
+
+        std::vector<std::vector<std::byte>> sequences(count);
+
+        for ( auto& sequence : sequences )
+        {
+            sequence.resize(1 + next() % 100);
+            std::generate(sequence.begin(), sequence.end(), [&next]() noexcept { return static_cast<std::byte>(next()); });
+        }
+
+        return sequences;
+    }
+
+    /**
+     * @brief Time one contender.
+     * @param name The name of the contender.
+     * @param sources The sources.
+     * @param contains Whether a source contains any pattern.
+     * @return The result.
+     */
+    template<typename TContains>
+    Program::Module::DataSearchBenchmarkResult Measure(const std::string_view name, const std::vector<std::vector<std::byte>>& sources, TContains&& contains) noexcept
+    {
+        const auto    start   = std::chrono::steady_clock::now();
+        std::uint64_t matches = 0;
+
+        for ( const auto& source : sources )
+        {
+            matches += contains(source) ? 1 : 0;
+        }
+
+        return { name, std::chrono::steady_clock::now() - start, matches };
+    }
+
+    /**
+     * @brief Time one contender that searches the whole batch in one call.
+     * @param name The name of the contender.
+     * @note The contender must search on one thread, as the per-source ones do, or the timings are not comparable.
+     * @param count The number of sources that contain any pattern.
+     * @return The result.
+     */
+    template<typename TCount>
+    Program::Module::DataSearchBenchmarkResult MeasureBatch(const std::string_view name, TCount&& count) noexcept
+    {
+        const auto          start   = std::chrono::steady_clock::now();
+        const std::uint64_t matches = count();
+
+        return { name, std::chrono::steady_clock::now() - start, matches };
+    }
+} // namespace
+
+/**
+ * @brief Time the pattern set engines against the per-pattern Boyer-Moore loop.
+ * @param pattern_count The number of patterns.
+ * @param source_count The number of sources.
+ * @param seed The seed of the data.
+ * @return One result per contender, the per-pattern loop first.
+ */
+std::vector<Program::Module::DataSearchBenchmarkResult> Program::Module::DataSearchBenchmark::Run(const std::size_t pattern_count, const std::size_t source_count, const std::uint64_t seed) noexcept
+{
+    std::uint64_t state    = seed;
+    const auto    patterns = GenerateSequences(pattern_count, state);
+    const auto    sources  = GenerateSequences(source_count, state);
+
+    const auto boyer_moore  = DataSearchEngineFactory::Create(DataSearchEngineType::BoyerMoore);
+    const auto rabin_karp   = DataSearchEngineFactory::Create(DataSearchEngineType::RabinKarp);
+    const auto aho_corasick = DataSearchEngineFactory::Create(DataSearchEngineType::AhoCorasick);
+    const auto teddy        = DataSearchEngineFactory::Create(DataSearchEngineType::Teddy);
+
+    std::vector<std::shared_ptr<const ICompiledPattern>> compiled_patterns;
+    std::transform(patterns.cbegin(), patterns.cend(), std::back_inserter(compiled_patterns), [&boyer_moore](const auto& pattern) { return boyer_moore->Compile(pattern); });
+
+    const auto rabin_karp_set    = dynamic_cast<const IMultiPatternSearchEngine&>(*rabin_karp).Compile(patterns);
+    const auto aho_corasick_set  = dynamic_cast<const IMultiPatternSearchEngine&>(*aho_corasick).Compile(patterns);
+    const auto aho_corasick_plan = DataSearchPlanner::Compile(*aho_corasick, patterns);
+    const auto teddy_plan        = DataSearchPlanner::Compile(*teddy, patterns);
+
+    Helpers::ragged_array<std::byte> batch;
+    batch.reserve(sources.size(), sources.size() * 100);
+
+    for ( const auto& source : sources )
+    {
+        batch.push_back(source);
+    }
+
+    return {
+        Measure("Boyer-Moore, per pattern", sources, [&compiled_patterns](const auto& source) { return std::any_of(compiled_patterns.cbegin(), compiled_patterns.cend(), [&source](const auto& pattern) { return pattern->Search(source).has_value(); }); }),
+        Measure("Rabin-Karp, pattern set", sources, [&rabin_karp_set](const auto& source) { return rabin_karp_set->Contains(source); }),
+        Measure("Aho-Corasick, pattern set", sources, [&aho_corasick_set](const auto& source) { return aho_corasick_set->Contains(source); }),
+        Measure("Aho-Corasick, planned set", sources, [&aho_corasick_plan](const auto& source) { return aho_corasick_plan->Contains(source); }),
+        Measure("Teddy, planned set", sources, [&teddy_plan](const auto& source) { return teddy_plan->Contains(source); }),
+        MeasureBatch("Aho-Corasick, batch", [&aho_corasick_set, &batch]() { const auto results = DataSearchBatch::Search(*aho_corasick_set, batch, 1); return static_cast<std::uint64_t>(std::count_if(results.cbegin(), results.cend(), [](const auto& result) { return result.has_value(); })); }),
+    };
+}
@@ -1,12 +1,62 @@
 #include "Module/DataSearchEngineFactory.hpp"
 #include "Module/Internal/DataSearchEngine.hpp"
+#include "Module/Internal/AhoCorasickSearchEngine.hpp"
+#include "Module/Internal/SimdSearchEngine.hpp"
+#include "Module/Internal/AdaptiveSearchEngine.hpp"
+#include "Module/Internal/RabinKarpSearchEngine.hpp"
+#include "Module/Internal/ApproximateSearchEngine.hpp"
+#include "Module/Internal/TeddySearchEngine.hpp"
 
 /**
  * @brief Create a data search engine
  * @return A unique pointer to the created data search engine
- * @note A unique pointer to the created data search engine
+ * @note The default engine compiles small sets of patterns into a Teddy filter, and larger ones into an Aho-Corasick automaton
  */
 std::unique_ptr<Program::Module::IDataSearchEngine> Program::Module::DataSearchEngineFactory::Create() noexcept
 {
-    return std::make_unique<Internal::DataSearchEngine>();
+    return Create(DataSearchEngineType::Teddy);
+}
+
+/**
+ * @brief Create a data search engine of the given type
+ * @param type Data search engine type
+ * @return A unique pointer to the created data search engine
+ */
+std::unique_ptr<Program::Module::IDataSearchEngine> Program::Module::DataSearchEngineFactory::Create(const DataSearchEngineType type) noexcept
+{
+    return Create(type, Helpers::get_cpu_tier());
+}
+
+/**
+ * @brief Create a data search engine of the given type, with its kernels bound to an instruction set tier
+ * @param type Data search engine type
+ * @param tier The instruction set tier
+ * @return A unique pointer to the created data search engine
+ */
+std::unique_ptr<Program::Module::IDataSearchEngine> Program::Module::DataSearchEngineFactory::Create(const DataSearchEngineType type, const Helpers::cpu_tier tier) noexcept
+{
+    switch ( type )
+    {
+        case DataSearchEngineType::BoyerMoore:
+            return std::make_unique<Internal::DataSearchEngine>(Helpers::resolve_cpu_tier(tier));
+
+        case DataSearchEngineType::Simd:
+            return std::make_unique<Internal::SimdSearchEngine>(Helpers::resolve_cpu_tier(tier));
+
+        case DataSearchEngineType::Adaptive:
+            return std::make_unique<Internal::AdaptiveSearchEngine>(Helpers::resolve_cpu_tier(tier));
+
+        case DataSearchEngineType::RabinKarp:
+            return std::make_unique<Internal::RabinKarpSearchEngine>(Helpers::resolve_cpu_tier(tier));
+
+        case DataSearchEngineType::Approximate:
+            return std::make_unique<Internal::ApproximateSearchEngine>(Helpers::resolve_cpu_tier(tier));
+
+        case DataSearchEngineType::Teddy:
+            return std::make_unique<Internal::TeddySearchEngine>(Helpers::resolve_cpu_tier(tier));
+
+        case DataSearchEngineType::AhoCorasick:
+        default:
+            return std::make_unique<Internal::AhoCorasickSearchEngine>(Helpers::resolve_cpu_tier(tier));
+    }
 }
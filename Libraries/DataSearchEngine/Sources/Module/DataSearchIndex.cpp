@@ -0,0 +1,252 @@
+#include "Module/DataSearchIndex.hpp"
+#include "Module/Internal/SuffixArray.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+namespace
+{
+    /**
+     * @brief Compare a suffix with a pattern on the length of the pattern.
+     * @return A negative value if the suffix sorts before every string that starts with the pattern, 0 if it starts with the
+     * pattern, a positive value if it sorts after.
+     */
+    int32_t ComparePrefix(const std::span<const std::byte> suffix, const std::span<const std::byte> pattern) noexcept
+    {
+        const int32_t result = std::memcmp(suffix.data(), pattern.data(), std::min(suffix.size(), pattern.size()));
+        return result != 0 ? result : (suffix.size() < pattern.size() ? -1 : 0);
+    }
+
+    /**
+     * @brief Write an array of 64-bit values.
+     */
+    void WriteWords(std::ofstream& stream, const std::span<const std::uint64_t> words) noexcept
+    {
+        stream.write(reinterpret_cast<const char*>(words.data()), static_cast<std::streamsize>(words.size_bytes()));
+    }
+
+    /**
+     * @brief Read an array of 64-bit values.
+     */
+    bool ReadWords(std::ifstream& stream, const std::span<std::uint64_t> words) noexcept
+    {
+        return static_cast<bool>(stream.read(reinterpret_cast<char*>(words.data()), static_cast<std::streamsize>(words.size_bytes())));
+    }
+} // namespace
+
+/**
+ * @brief Add a batch of sources.
+ * @param sources The sources.
+ * @note The batch is sorted on its own, in O(b log b) for b new bytes, and merged with the index in O(n + b) plus the bytes the
+ * merge compares: an index built batch by batch is the one built at once.
+ */
+void Program::Module::DataSearchIndex::Add(const Helpers::ragged_array<std::byte>& sources) noexcept
+{
+    const std::uint64_t      base  = GetSize();
+    Internal::SuffixArray    batch = Internal::BuildSuffixArray(sources.values(), sources.offsets());
+    Internal::SuffixArray    index{ std::move(m_SuffixArray), std::move(m_Lcp) };
+
+    for ( const auto source : sources )
+    {
+        m_Sources.push_back(source);
+    }
+
+    for ( std::uint64_t& position : batch.m_Positions )
+    {
+        position += base;
+    }
+
+    Internal::SuffixArray merged = index.m_Positions.empty() ? std::move(batch) : Internal::MergeSuffixArrays(m_Sources.values(), m_Sources.offsets(), index, batch);
+    m_SuffixArray                = std::move(merged.m_Positions);
+    m_Lcp                        = std::move(merged.m_Lcp);
+}
+
+/**
+ * @brief Add one source.
+ * @param source The source.
+ */
+void Program::Module::DataSearchIndex::Add(const std::span<const std::byte> source) noexcept
+{
+    Helpers::ragged_array<std::byte> sources;
+    sources.push_back(source);
+    Add(sources);
+}
+
+/**
+ * @brief Get the number of sources.
+ */
+std::uint64_t Program::Module::DataSearchIndex::GetSourceCount() const noexcept
+{
+    return m_Sources.size();
+}
+
+/**
+ * @brief Get a source.
+ * @param index Source index.
+ * @return A view of the source.
+ */
+std::span<const std::byte> Program::Module::DataSearchIndex::GetSource(const std::uint64_t index) const noexcept
+{
+    return m_Sources[static_cast<std::size_t>(index)];
+}
+
+/**
+ * @brief Get the number of indexed bytes.
+ */
+std::uint64_t Program::Module::DataSearchIndex::GetSize() const noexcept
+{
+    return m_Sources.values().size();
+}
+
+/**
+ * @brief Check whether a pattern occurs in any source.
+ * @param pattern The data to search for.
+ * @return True if the pattern occurs.
+ */
+bool Program::Module::DataSearchIndex::Contains(const std::span<const std::byte> pattern) const noexcept
+{
+    const auto [first, last] = FindRange(pattern);
+    return first < last;
+}
+
+/**
+ * @brief Count the occurrences of a pattern.
+ * @param pattern The data to search for.
+ * @return The number of occurrences.
+ */
+std::uint64_t Program::Module::DataSearchIndex::Count(const std::span<const std::byte> pattern) const noexcept
+{
+    const auto [first, last] = FindRange(pattern);
+    return last - first;
+}
+
+/**
+ * @brief Locate the occurrences of a pattern.
+ * @param pattern The data to search for.
+ * @return The occurrences, sorted by source and offset.
+ * @note The suffix array lists the occurrences in the order of the text after them, so they are sorted by position before
+ * being mapped to their source.
+ */
+std::vector<Program::Module::DataIndexMatch> Program::Module::DataSearchIndex::Locate(const std::span<const std::byte> pattern) const noexcept
+{
+    const auto [first, last] = FindRange(pattern);
+    const auto& offsets      = m_Sources.offsets();
+
+    std::vector<std::uint64_t> positions(m_SuffixArray.begin() + static_cast<std::ptrdiff_t>(first), m_SuffixArray.begin() + static_cast<std::ptrdiff_t>(last));
+    std::sort(positions.begin(), positions.end());
+
+    std::vector<DataIndexMatch> matches;
+    matches.reserve(positions.size());
+
+    for ( auto source = offsets.begin(); const std::uint64_t position : positions )
+    {
+        source = std::upper_bound(source, offsets.end(), position) - 1;
+        matches.push_back({ static_cast<std::uint64_t>(source - offsets.begin()), position - *source });
+    }
+
+    return matches;
+}
+
+/**
+ * @brief Write the index to a file.
+ * @param path The file to write.
+ * @return True if the whole file was written.
+ * @note Layout: the magic, the source count, the byte count, the source boundaries, the bytes, the suffix array and the LCP
+ * array, every number a 64-bit word in native byte order.
+ */
+bool Program::Module::DataSearchIndex::Save(const std::filesystem::path& path) const noexcept
+{
+    std::ofstream stream{ path, std::ios::binary | std::ios::trunc };
+
+    if ( not stream )
+    {
+        return false;
+    }
+
+    const std::uint64_t              header[] = { GetSourceCount(), GetSize() };
+    const std::vector<std::uint64_t> offsets(m_Sources.offsets().begin(), m_Sources.offsets().end());
+
+    stream.write(Magic.data(), Magic.size());
+    WriteWords(stream, header);
+    WriteWords(stream, offsets);
+    stream.write(reinterpret_cast<const char*>(m_Sources.values().data()), static_cast<std::streamsize>(GetSize()));
+    WriteWords(stream, m_SuffixArray);
+    WriteWords(stream, m_Lcp);
+    return static_cast<bool>(stream.flush());
+}
+
+/**
+ * @brief Read an index written by Save.
+ * @param path The file to read.
+ * @return The index, or nullptr if the file is not a valid index file.
+ * @note The sizes are checked against the file size before anything is allocated, and the boundaries and the suffix array
+ * are checked to stay inside the bytes, so a damaged file cannot make a query read out of bounds.
+ */
+std::shared_ptr<Program::Module::DataSearchIndex> Program::Module::DataSearchIndex::Load(const std::filesystem::path& path) noexcept
+{
+    std::error_code      error;
+    const std::uintmax_t file_size = std::filesystem::file_size(path, error);
+    std::ifstream        stream{ path, std::ios::binary };
+    char                 magic[Magic.size()]{};
+    std::uint64_t        header[2]{};
+
+    if ( error || not stream || not stream.read(magic, sizeof(magic)) || std::string_view{ magic, sizeof(magic) } != Magic || not ReadWords(stream, header) )
+    {
+        return nullptr;
+    }
+
+    const auto [source_count, size] = header;
+    const std::uintmax_t expected   = sizeof(magic) + sizeof(header) + (source_count + 1) * sizeof(std::uint64_t) + size * (1 + 2 * sizeof(std::uint64_t));
+
+    if ( source_count >= file_size || size >= file_size || expected != file_size )
+    {
+        return nullptr;
+    }
+
+    std::vector<std::uint64_t> offsets(static_cast<std::size_t>(source_count + 1));
+    std::vector<std::byte>     values(static_cast<std::size_t>(size));
+    auto                       index = std::make_shared<DataSearchIndex>();
+
+    index->m_SuffixArray.resize(static_cast<std::size_t>(size));
+    index->m_Lcp.resize(static_cast<std::size_t>(size));
+
+    if ( not ReadWords(stream, offsets) || not stream.read(reinterpret_cast<char*>(values.data()), static_cast<std::streamsize>(size)) || not ReadWords(stream, index->m_SuffixArray) || not ReadWords(stream, index->m_Lcp) )
+    {
+        return nullptr;
+    }
+
+    if ( offsets.front() != 0 || offsets.back() != size || not std::is_sorted(offsets.begin(), offsets.end()) || std::any_of(index->m_SuffixArray.begin(), index->m_SuffixArray.end(), [size](const std::uint64_t position) noexcept { return position >= size; }) )
+    {
+        return nullptr;
+    }
+
+    index->m_Sources.reserve(static_cast<std::size_t>(source_count), static_cast<std::size_t>(size));
+
+    for ( std::size_t source = 0; source < source_count; ++source )
+    {
+        index->m_Sources.push_back(std::span{ values }.subspan(offsets[source], offsets[source + 1] - offsets[source]));
+    }
+
+    return index;
+}
+
+/**
+ * @brief Find the suffixes that start with a pattern.
+ * @param pattern The data to search for.
+ * @return The range of the suffix array.
+ * @note The suffixes that start with the pattern are contiguous in the suffix array: the first one is found by a binary search
+ * for the first suffix not below the pattern, the end by a second one for the first suffix above it.
+ */
+std::pair<std::size_t, std::size_t> Program::Module::DataSearchIndex::FindRange(const std::span<const std::byte> pattern) const noexcept
+{
+    if ( pattern.empty() )
+    {
+        return { 0, 0 };
+    }
+
+    const auto suffix = [this](const std::uint64_t position) noexcept { return Internal::GetSuffix(m_Sources.values(), m_Sources.offsets(), position); };
+    const auto first  = std::partition_point(m_SuffixArray.begin(), m_SuffixArray.end(), [&](const std::uint64_t position) noexcept { return ComparePrefix(suffix(position), pattern) < 0; });
+    const auto last   = std::partition_point(first, m_SuffixArray.end(), [&](const std::uint64_t position) noexcept { return ComparePrefix(suffix(position), pattern) == 0; });
+
+    return { static_cast<std::size_t>(first - m_SuffixArray.begin()), static_cast<std::size_t>(last - m_SuffixArray.begin()) };
+}
@@ -0,0 +1,57 @@
+#include "Module/DataSearchPlanner.hpp"
+#include "Module/IMultiPatternSearchEngine.hpp"
+#include "Module/Internal/CompiledPatternList.hpp"
+#include "Module/Internal/PlannedPatternSet.hpp"
+#include <algorithm>
+#include <iterator>
+
+/**
+ * @brief Compile a set of patterns
+ * @param engine The search engine of the patterns longer than 2 bytes
+ * @param patterns The data to search for
+ * @return The compiled, immutable pattern set
+ */
+std::shared_ptr<const Program::Module::IPatternSet> Program::Module::DataSearchPlanner::Compile(const IDataSearchEngine& engine, const std::vector<std::vector<std::byte>>& patterns) noexcept
+{
+    std::vector<std::vector<std::byte>> long_patterns; //!< The patterns the bitmaps cannot answer
+    std::vector<std::size_t>            long_indexes;  //!< Their index in patterns
+
+    for ( std::size_t index = 0; index < patterns.size(); ++index )
+    {
+        if ( patterns[index].size() > 2 )
+        {
+            long_patterns.push_back(patterns[index]);
+            long_indexes.push_back(index);
+        }
+    }
+
+    std::shared_ptr<const IPatternSet>     long_pattern_set;  //!< The real searcher of the long patterns, compiled once
+    std::vector<Internal::ByteFingerprint> long_fingerprints; //!< Not for the compiled pattern list and the sets with a prefilter of their own: they filter every pattern themselves
+
+    if ( not long_patterns.empty() )
+    {
+        if ( const auto* multi_pattern_engine = dynamic_cast<const IMultiPatternSearchEngine*>(&engine) )
+        {
+            long_pattern_set = multi_pattern_engine->Compile(long_patterns);
+
+            const bool fingerprinted = not long_pattern_set->HasOwnPrefilter(); //!< A prefilter of its own rejects a source faster than the fingerprints
+
+            if ( not fingerprinted && long_patterns.size() == patterns.size() )
+            {
+                return long_pattern_set; //!< No short pattern to take out and no prefilter to add: the tiers would only add a call.
+            }
+
+            if ( fingerprinted )
+            {
+                long_fingerprints.reserve(long_patterns.size());
+                std::transform(long_patterns.cbegin(), long_patterns.cend(), std::back_inserter(long_fingerprints), [](const auto& pattern) { return Internal::ByteFingerprint{ pattern }; });
+            }
+        }
+        else
+        {
+            long_pattern_set = std::make_shared<Internal::CompiledPatternList>(engine, long_patterns);
+        }
+    }
+
+    return std::make_shared<Internal::PlannedPatternSet>(patterns, std::move(long_pattern_set), std::move(long_indexes), std::move(long_fingerprints));
+}
@@ -0,0 +1,87 @@
+#include "Module/DataStreamSearcher.hpp"
+#include "Module/Internal/SpanSearch.hpp"
+#include <algorithm>
+
+/**
+ * @brief Construct a searcher at the start of a stream.
+ * @param pattern The compiled pattern.
+ * @note The scratch buffers are reserved once, for the longest boundary: 2 * (pattern length - 1) bytes.
+ */
+Program::Module::DataStreamSearcher::DataStreamSearcher(std::shared_ptr<const ICompiledPattern> pattern) noexcept
+    : m_Pattern{ std::move(pattern) }
+    , m_Carry{}
+    , m_Boundary{}
+    , m_Position{ 0 }
+{
+    const std::size_t overlap = m_Pattern->GetPattern().empty() ? 0 : m_Pattern->GetPattern().size() - 1;
+
+    m_Carry.reserve(overlap);
+    m_Boundary.reserve(2 * overlap);
+}
+
+/**
+ * @brief Search the next chunk of the stream.
+ * @param chunk The next bytes of the stream.
+ * @param offsets The vector the absolute offsets are appended to.
+ * @return The number of offsets appended.
+ * @note A match that starts in the carried bytes ends in the head of the chunk, and a match of the carried bytes alone was
+ * already reported: a match is longer than the carry. A match that starts past the carry does not fit in the head, so the
+ * boundary only reports matches that start in the carry, and the chunk reports the others.
+ */
+std::size_t Program::Module::DataStreamSearcher::Push(const std::span<const std::byte> chunk, std::vector<std::uint64_t>& offsets) noexcept
+{
+    const std::size_t size  = m_Pattern->GetPattern().size();
+    const std::size_t count = offsets.size();
+
+    if ( size == 0 )
+    {
+        m_Position += chunk.size();
+        return 0;
+    }
+
+    const std::size_t overlap = size - 1;
+    const auto        find    = [this](const std::span<const std::byte> suffix) noexcept { return m_Pattern->Search(suffix); };
+
+    if ( not m_Carry.empty() )
+    {
+        const std::size_t head = std::min(overlap, chunk.size());
+
+        m_Boundary.assign(m_Carry.begin(), m_Carry.end());
+        m_Boundary.insert(m_Boundary.end(), chunk.begin(), chunk.begin() + static_cast<std::ptrdiff_t>(head));
+
+        Internal::AppendAllOffsets(m_Boundary, size, m_Position - m_Carry.size(), offsets, find);
+    }
+
+    Internal::AppendAllOffsets(chunk, size, m_Position, offsets, find);
+
+    if ( chunk.size() >= overlap )
+    {
+        m_Carry.assign(chunk.end() - static_cast<std::ptrdiff_t>(overlap), chunk.end());
+    }
+    else
+    {
+        m_Carry.insert(m_Carry.end(), chunk.begin(), chunk.end());
+        m_Carry.erase(m_Carry.begin(), m_Carry.end() - static_cast<std::ptrdiff_t>(std::min(overlap, m_Carry.size())));
+    }
+
+    m_Position += chunk.size();
+    return offsets.size() - count;
+}
+
+/**
+ * @brief Start a new stream with the same pattern.
+ */
+void Program::Module::DataStreamSearcher::Reset() noexcept
+{
+    m_Carry.clear();
+    m_Position = 0;
+}
+
+/**
+ * @brief Get the position in the stream.
+ * @return The number of bytes pushed.
+ */
+std::uint64_t Program::Module::DataStreamSearcher::GetPosition() const noexcept
+{
+    return m_Position;
+}
@@ -0,0 +1,58 @@
+#include "Module/Internal/AdaptivePattern.hpp"
+
+/**
+ * @brief Compile a pattern.
+ * @param values_to_search The sequence of bytes to search for.
+ * @param tier The instruction set tier of the Simd strategy.
+ * @param calibration The measured thresholds of the tier.
+ * @note m_Pattern is declared before m_Searchers, so the searchers are built over the owned copy.
+ */
+Program::Module::Internal::AdaptivePattern::AdaptivePattern(const std::vector<std::byte>& values_to_search, const Helpers::cpu_tier tier, const SearchCalibration& calibration) noexcept
+    : m_Pattern{ values_to_search }
+    , m_Strategies{}
+    , m_Searchers{}
+{
+    for ( std::size_t source_bucket = 0; source_bucket < m_Strategies.size(); ++source_bucket )
+    {
+        const auto strategy = calibration.Select(m_Pattern, source_bucket, true);
+        auto&      searcher = m_Searchers[static_cast<std::size_t>(strategy)];
+
+        m_Strategies[source_bucket] = strategy;
+
+        if ( not searcher )
+        {
+            searcher.emplace(strategy, tier, std::span<const std::byte>{ m_Pattern });
+        }
+    }
+}
+
+/**
+ * @brief Get the pattern.
+ * @return The sequence of bytes to search for.
+ */
+const std::vector<std::byte>& Program::Module::Internal::AdaptivePattern::GetPattern() const noexcept
+{
+    return m_Pattern;
+}
+
+/**
+ * @brief Search for the pattern in a source sequence.
+ * @param source The source sequence.
+ * @return The index of the first occurrence of the pattern in the source sequence, or std::nullopt if the pattern is not found.
+ */
+std::optional<int32_t> Program::Module::Internal::AdaptivePattern::Search(const std::vector<std::byte>& source) const noexcept
+{
+    const auto result = Search(std::span<const std::byte>{ source });
+    return result ? std::optional{ static_cast<int32_t>(*result) } : std::nullopt;
+}
+
+/**
+ * @brief Search for the pattern in a source sequence, without copies.
+ * @param source The source sequence.
+ * @return The 64-bit offset of the first occurrence of the pattern in the source sequence, or std::nullopt if the pattern is not found.
+ */
+std::optional<std::uint64_t> Program::Module::Internal::AdaptivePattern::Search(const std::span<const std::byte> source) const noexcept
+{
+    const auto strategy = m_Strategies[SearchCalibration::GetSourceBucket(source.size())];
+    return m_Searchers[static_cast<std::size_t>(strategy)]->Search(source);
+}
@@ -0,0 +1,104 @@
+#include "Module/Internal/AdaptiveSearchEngine.hpp"
+#include "Module/Internal/AdaptivePattern.hpp"
+#include "Module/Internal/MaskedPattern.hpp"
+#include "Module/Internal/SpanSearch.hpp"
+
+/**
+ * @brief Construct the engine.
+ * @param tier The instruction set tier of the Simd strategy.
+ */
+Program::Module::Internal::AdaptiveSearchEngine::AdaptiveSearchEngine(const Helpers::cpu_tier tier) noexcept
+    : m_Tier{ tier }
+    , m_Calibration{ SearchCalibration::Get(tier) }
+{
+}
+
+/**
+ * @brief Search for a sequence of bytes in a source sequence.
+ * @param source The source sequence.
+ * @param values_to_search The sequence of bytes to search for.
+ * @return The index of the first occurrence of the sequence of bytes in the source sequence, or std::nullopt if the sequence of bytes is not found.
+ */
+std::optional<int32_t> Program::Module::Internal::AdaptiveSearchEngine::Search(const std::vector<std::byte>& source, const std::vector<std::byte>& values_to_search) const noexcept
+{
+    const auto result = Search(std::span<const std::byte>{ source }, std::span<const std::byte>{ values_to_search });
+    return result ? std::optional{ static_cast<int32_t>(*result) } : std::nullopt;
+}
+
+/**
+ * @brief Compile a sequence of bytes to search for.
+ * @param values_to_search The sequence of bytes to search for.
+ * @return The compiled pattern, with the searcher of every selected strategy prepared.
+ */
+std::shared_ptr<const Program::Module::ICompiledPattern> Program::Module::Internal::AdaptiveSearchEngine::Compile(const std::vector<std::byte>& values_to_search) const noexcept
+{
+    return std::make_shared<AdaptivePattern>(values_to_search, m_Tier, m_Calibration);
+}
+
+/**
+ * @brief Compile a masked sequence of bytes to search for.
+ * @param values_to_search The masked bytes to search for.
+ * @return The masked pattern, bound to the kernels of the tier.
+ */
+std::shared_ptr<const Program::Module::ICompiledPattern> Program::Module::Internal::AdaptiveSearchEngine::Compile(const std::vector<Helpers::masked_byte>& values_to_search) const noexcept
+{
+    return std::make_shared<MaskedPattern>(values_to_search, m_Tier);
+}
+
+/**
+ * @brief Search for a compiled pattern in a source sequence.
+ * @param source The source sequence.
+ * @param pattern The compiled pattern.
+ * @return The index of the first occurrence of the pattern in the source sequence, or std::nullopt if the pattern is not found.
+ */
+std::optional<int32_t> Program::Module::Internal::AdaptiveSearchEngine::Search(const std::vector<std::byte>& source, const ICompiledPattern& pattern) const noexcept
+{
+    return pattern.Search(source);
+}
+
+/**
+ * @brief Search for a sequence of bytes in a source sequence, without copies.
+ * @param source The source sequence.
+ * @param values_to_search The sequence of bytes to search for.
+ * @return The 64-bit offset of the first occurrence of the sequence of bytes in the source sequence, or std::nullopt if the sequence of bytes is not found.
+ * @note The preprocessing is paid by this single search, so the strategy comes from the single search table.
+ */
+std::optional<std::uint64_t> Program::Module::Internal::AdaptiveSearchEngine::Search(const std::span<const std::byte> source, const std::span<const std::byte> values_to_search) const noexcept
+{
+    if ( values_to_search.empty() || values_to_search.size() > source.size() )
+    {
+        return std::nullopt;
+    }
+
+    const auto strategy = m_Calibration.Select(values_to_search, SearchCalibration::GetSourceBucket(source.size()), false);
+    const auto result   = StrategySearcher{ strategy, m_Tier, values_to_search }.Search(source);
+    return result ? std::optional{ static_cast<std::uint64_t>(*result) } : std::nullopt;
+}
+
+/**
+ * @brief Find every occurrence of a sequence of bytes in a source sequence.
+ * @param source The source sequence.
+ * @param values_to_search The sequence of bytes to search for.
+ * @param offsets The buffer of the offsets.
+ * @return The number of offsets written.
+ */
+std::size_t Program::Module::Internal::AdaptiveSearchEngine::FindAll(const std::span<const std::byte> source, const std::span<const std::byte> values_to_search, const std::span<std::uint64_t> offsets) const noexcept
+{
+    const auto             strategy = m_Calibration.Select(values_to_search, SearchCalibration::GetSourceBucket(source.size()), true);
+    const StrategySearcher searcher{ strategy, m_Tier, values_to_search }; //!< Prepared once, shared by every occurrence.
+    return FindAllOffsets(source, values_to_search.size(), offsets, [&searcher](const std::span<const std::byte> suffix) { return searcher.Search(suffix); });
+}
+
+/**
+ * @brief Count the occurrences of a sequence of bytes in a source sequence.
+ * @param source The source sequence.
+ * @param values_to_search The sequence of bytes to search for.
+ * @param overlapping Whether an occurrence may start inside the previous one.
+ * @return The number of occurrences.
+ */
+std::uint64_t Program::Module::Internal::AdaptiveSearchEngine::Count(const std::span<const std::byte> source, const std::span<const std::byte> values_to_search, const bool overlapping) const noexcept
+{
+    const auto             strategy = m_Calibration.Select(values_to_search, SearchCalibration::GetSourceBucket(source.size()), true);
+    const StrategySearcher searcher{ strategy, m_Tier, values_to_search }; //!< Prepared once, shared by every occurrence.
+    return CountOffsets(source, values_to_search.size(), overlapping, [&searcher](const std::span<const std::byte> suffix) { return searcher.Search(suffix); });
+}
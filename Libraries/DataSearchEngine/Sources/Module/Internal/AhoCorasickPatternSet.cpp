@@ -0,0 +1,258 @@
+#include "Module/Internal/AhoCorasickPatternSet.hpp"
+#include <algorithm>
+#include <bit>
+#include <queue>
+#include <utility>
+
+namespace Program::Module::Internal
+{
+    namespace
+    {
+        /**
+         * @brief Uncompressed trie node, only used while compiling.
+         */
+        struct TrieNode
+        {
+            std::vector<std::pair<std::byte, std::uint32_t>> children; //!< Children sorted by byte
+            std::uint32_t                                    pattern;  //!< Lowest index of the patterns ending here
+        };
+    } // namespace
+
+    /**
+     * @brief Compile the automaton.
+     * @param patterns The patterns.
+     * @note The trie is built first, then renumbered breadth-first into the compact states, then the failure links are added level by level.
+     */
+    AhoCorasickPatternSet::AhoCorasickPatternSet(const std::vector<std::vector<std::byte>>& patterns) noexcept
+        : m_States{}
+        , m_RootNext{}
+        , m_SamePattern(patterns.size(), None)
+        , m_PatternCount{ patterns.size() }
+        , m_MaxLength{ 0 }
+    {
+        std::vector<TrieNode>      trie(1, TrieNode{ {}, None });
+        std::vector<std::uint32_t> pattern_nodes(patterns.size(), None); //!< Trie node of every pattern
+
+        for ( std::size_t index = 0; index < patterns.size(); ++index )
+        {
+            if ( patterns[index].empty() )
+            {
+                continue; //!< Empty patterns never match.
+            }
+
+            std::uint32_t node = Root;
+
+            for ( const std::byte value : patterns[index] )
+            {
+                auto& children = trie[node].children;
+                auto  child    = std::lower_bound(children.begin(), children.end(), value, [](const auto& lhs, const std::byte rhs) { return lhs.first < rhs; });
+
+                if ( child == children.end() || child->first != value )
+                {
+                    const auto next = static_cast<std::uint32_t>(trie.size());
+                    children.insert(child, { value, next });
+                    trie.push_back(TrieNode{ {}, None });
+                    node = next;
+                }
+                else
+                {
+                    node = child->second;
+                }
+            }
+
+            trie[node].pattern   = std::min(trie[node].pattern, static_cast<std::uint32_t>(index));
+            pattern_nodes[index] = node;
+            m_MaxLength        = std::max(m_MaxLength, patterns[index].size());
+        }
+
+        // Chain the equal patterns by increasing index, from the lowest one, which the node keeps.
+        std::vector<std::uint32_t> chains(trie.size(), None);
+
+        for ( std::size_t index = patterns.size(); index-- > 0; )
+        {
+            if ( pattern_nodes[index] != None )
+            {
+                m_SamePattern[index]          = chains[pattern_nodes[index]];
+                chains[pattern_nodes[index]] = static_cast<std::uint32_t>(index);
+            }
+        }
+
+        // Breadth-first renumbering: the children of one node are discovered together, so they get consecutive indexes.
+        std::vector<std::uint32_t> order{ Root };
+        order.reserve(trie.size());
+        m_States.resize(trie.size());
+
+        for ( std::size_t index = 0; index < order.size(); ++index )
+        {
+            const TrieNode& node  = trie[order[index]];
+            State&          state = m_States[index];
+
+            state.pattern     = node.pattern;
+            state.first_child = static_cast<std::uint32_t>(order.size());
+
+            for ( const auto& [value, child] : node.children )
+            {
+                const auto bit = std::to_integer<std::uint32_t>(value);
+                state.children[bit / 64] |= std::uint64_t{ 1 } << (bit % 64);
+                m_States[order.size()].depth = state.depth + 1;
+                order.push_back(child);
+            }
+        }
+
+        m_RootNext.fill(Root);
+
+        for ( std::size_t index = 0; index < trie[Root].children.size(); ++index )
+        {
+            m_RootNext[std::to_integer<std::size_t>(trie[Root].children[index].first)] = m_States[Root].first_child + static_cast<std::uint32_t>(index);
+        }
+
+        // Failure and output links, level by level: the links of a state only depend on shallower states.
+        for ( std::size_t index = 0; index < order.size(); ++index )
+        {
+            const TrieNode& node   = trie[order[index]];
+            const State&    parent = m_States[index];
+
+            for ( std::size_t child_index = 0; child_index < node.children.size(); ++child_index )
+            {
+                State& child  = m_States[parent.first_child + child_index];
+                child.failure = index == Root ? Root : Next(parent.failure, node.children[child_index].first);
+
+                const State& failure = m_States[child.failure];
+                child.output         = child.pattern != None ? parent.first_child + static_cast<std::uint32_t>(child_index) : failure.output;
+            }
+        }
+    }
+
+    /**
+     * @brief Get the number of patterns in the set.
+     * @return The number of patterns, empty patterns included.
+     */
+    std::size_t AhoCorasickPatternSet::GetPatternCount() const noexcept
+    {
+        return m_PatternCount;
+    }
+
+    /**
+     * @brief Follow the goto and failure transitions.
+     * @param state The current state.
+     * @param value The next byte.
+     * @return The next state.
+     * @note The child of a byte is first_child plus the number of children of the lower bytes, counted with popcount.
+     */
+    std::uint32_t AhoCorasickPatternSet::Next(std::uint32_t state, const std::byte value) const noexcept
+    {
+        const auto bit  = std::to_integer<std::uint32_t>(value);
+        const auto word = bit / 64;
+        const auto mask = std::uint64_t{ 1 } << (bit % 64);
+
+        while ( state != Root )
+        {
+            const State& current = m_States[state];
+
+            if ( current.children[word] & mask )
+            {
+                std::uint32_t rank = static_cast<std::uint32_t>(std::popcount(current.children[word] & (mask - 1)));
+
+                for ( std::uint32_t lower = 0; lower < word; ++lower )
+                {
+                    rank += static_cast<std::uint32_t>(std::popcount(current.children[lower]));
+                }
+
+                return current.first_child + rank;
+            }
+
+            state = current.failure;
+        }
+
+        return m_RootNext[bit];
+    }
+
+    /**
+     * @brief Search for every pattern of the set in a given source data.
+     * @param source The source data to search in.
+     * @return The leftmost match; among matches at the same offset, the one with the lowest pattern index.
+     * @note Matches are reported where they end. A match ending at position p starts at p + 1 - length, so once
+     * p + 1 - max_length is past the best offset, no later match can improve it and the scan stops.
+     */
+    std::optional<PatternMatch> AhoCorasickPatternSet::Search(const std::span<const std::byte> source) const noexcept
+    {
+        if ( m_MaxLength == 0 )
+        {
+            return std::nullopt;
+        }
+
+        std::optional<PatternMatch> result;
+        std::uint32_t               state = Root;
+
+        for ( std::size_t position = 0; position < source.size(); ++position )
+        {
+            if ( result && position + 1 > result->offset + m_MaxLength )
+            {
+                break;
+            }
+
+            state = Next(state, source[position]);
+
+            // The first output is the longest pattern ending here: the only one that can start at the lowest offset.
+            if ( const std::uint32_t output = m_States[state].output; output != None )
+            {
+                const PatternMatch match{ m_States[output].pattern, position + 1 - m_States[output].depth };
+
+                if ( not result || match.offset < result->offset || (match.offset == result->offset && match.pattern < result->pattern) )
+                {
+                    result = match;
+                }
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Check if any pattern of the set occurs in a given source data.
+     * @param source The source data to search in.
+     * @return True if Search would find a match.
+     */
+    bool AhoCorasickPatternSet::Contains(const std::span<const std::byte> source) const noexcept
+    {
+        std::uint32_t state = Root;
+
+        for ( const std::byte value : source )
+        {
+            state = Next(state, value);
+
+            if ( m_States[state].output != None )
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief Find every pattern of the set that occurs in a given source data.
+     * @param source The source data to search in.
+     * @param matches The cleared bitset of the patterns.
+     * @note The output chain of a state lists the states that end a pattern, longest first. Every walk reports a whole chain,
+     * so the walk stops at the first state whose lowest pattern is already set.
+     */
+    void AhoCorasickPatternSet::Match(const std::span<const std::byte> source, const std::span<std::uint64_t> matches) const noexcept
+    {
+        const auto    is_set = [&matches](const std::uint32_t pattern) noexcept { return (matches[pattern / 64] >> (pattern % 64)) & 1; };
+        std::uint32_t state  = Root;
+
+        for ( const std::byte value : source )
+        {
+            state = Next(state, value);
+
+            for ( std::uint32_t output = m_States[state].output; output != None && not is_set(m_States[output].pattern); output = m_States[m_States[output].failure].output )
+            {
+                for ( std::uint32_t pattern = m_States[output].pattern; pattern != None; pattern = m_SamePattern[pattern] )
+                {
+                    matches[pattern / 64] |= std::uint64_t{ 1 } << (pattern % 64);
+                }
+            }
+        }
+    }
+} // namespace Program::Module::Internal
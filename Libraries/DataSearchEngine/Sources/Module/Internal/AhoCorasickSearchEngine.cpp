@@ -0,0 +1,21 @@
+#include "Module/Internal/AhoCorasickSearchEngine.hpp"
+#include "Module/Internal/AhoCorasickPatternSet.hpp"
+
+/**
+ * @brief Construct the engine.
+ * @param tier The instruction set tier of the single pattern searches.
+ */
+Program::Module::Internal::AhoCorasickSearchEngine::AhoCorasickSearchEngine(const Helpers::cpu_tier tier) noexcept
+    : DelegatingSearchEngine{ tier }
+{
+}
+
+/**
+ * @brief Compile a set of patterns.
+ * @param patterns The patterns.
+ * @return The Aho-Corasick automaton of the patterns.
+ */
+std::shared_ptr<const Program::Module::IPatternSet> Program::Module::Internal::AhoCorasickSearchEngine::Compile(const std::vector<std::vector<std::byte>>& patterns) const noexcept
+{
+    return std::make_shared<AhoCorasickPatternSet>(patterns);
+}
@@ -0,0 +1,47 @@
+#include "Module/Internal/ApproximateSearchEngine.hpp"
+#include "Module/Internal/ShiftAndPattern.hpp"
+#include "Module/Internal/MyersPattern.hpp"
+
+/**
+ * @brief Construct the engine.
+ * @param tier The instruction set tier of the exact searches.
+ */
+Program::Module::Internal::ApproximateSearchEngine::ApproximateSearchEngine(const Helpers::cpu_tier tier) noexcept
+    : DelegatingSearchEngine{ tier }
+{
+}
+
+/**
+ * @brief Compile a sequence of bytes to search for within a maximum distance.
+ * @param values_to_search The sequence of bytes to search for.
+ * @param max_distance The largest distance of a match.
+ * @param metric The distance.
+ * @return The Shift-And pattern for Hamming, the Myers pattern for Levenshtein.
+ */
+std::shared_ptr<const Program::Module::IApproximatePattern> Program::Module::Internal::ApproximateSearchEngine::Compile(const std::span<const std::byte> values_to_search, const std::size_t max_distance, const ApproximateMetric metric) const noexcept
+{
+    if ( metric == ApproximateMetric::Hamming )
+    {
+        return std::make_shared<ShiftAndPattern>(values_to_search, max_distance);
+    }
+
+    return std::make_shared<MyersPattern>(values_to_search, max_distance);
+}
+
+/**
+ * @brief Search for near-matches of a sequence of bytes in a source sequence.
+ * @param source The source sequence.
+ * @param values_to_search The sequence of bytes to search for.
+ * @param max_distance The largest distance of a match.
+ * @param metric The distance.
+ * @return The first match within the maximum distance, or std::nullopt if there is none.
+ */
+std::optional<Program::Module::ApproximateMatch> Program::Module::Internal::ApproximateSearchEngine::Search(const std::span<const std::byte> source, const std::span<const std::byte> values_to_search, const std::size_t max_distance, const ApproximateMetric metric) const noexcept
+{
+    if ( metric == ApproximateMetric::Hamming )
+    {
+        return ShiftAndPattern{ values_to_search, max_distance }.Search(source);
+    }
+
+    return MyersPattern{ values_to_search, max_distance }.Search(source);
+}
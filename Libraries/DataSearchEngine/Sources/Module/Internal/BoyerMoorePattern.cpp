@@ -0,0 +1,55 @@
+#include "Module/Internal/BoyerMoorePattern.hpp"
+#include <algorithm>
+
+/**
+ * @brief Compile a pattern.
+ * @param values_to_search The sequence of bytes to search for.
+ * @note m_Pattern is declared before m_Searcher, so the searcher is built over the owned copy.
+ */
+Program::Module::Internal::BoyerMoorePattern::BoyerMoorePattern(const std::vector<std::byte>& values_to_search) noexcept
+    : m_Pattern{ values_to_search }
+    , m_Searcher{ m_Pattern.cbegin(), m_Pattern.cend() }
+{
+}
+
+/**
+ * @brief Get the pattern.
+ * @return The sequence of bytes to search for.
+ */
+const std::vector<std::byte>& Program::Module::Internal::BoyerMoorePattern::GetPattern() const noexcept
+{
+    return m_Pattern;
+}
+
+/**
+ * @brief Search for the pattern in a source sequence.
+ * @param source The source sequence.
+ * @return The index of the first occurrence of the pattern in the source sequence, or std::nullopt if the pattern is not found.
+ */
+std::optional<int32_t> Program::Module::Internal::BoyerMoorePattern::Search(const std::vector<std::byte>& source) const noexcept
+{
+    const auto result = Search(std::span<const std::byte>{ source });
+    return result ? std::optional{ static_cast<int32_t>(*result) } : std::nullopt;
+}
+
+/**
+ * @brief Search for the pattern in a source sequence, without copies.
+ * @param source The source sequence.
+ * @return The 64-bit offset of the first occurrence of the pattern in the source sequence, or std::nullopt if the pattern is not found.
+ */
+std::optional<std::uint64_t> Program::Module::Internal::BoyerMoorePattern::Search(const std::span<const std::byte> source) const noexcept
+{
+    if ( source.empty() || m_Pattern.empty() )
+    {
+        return std::nullopt;
+    }
+
+    const auto iterator_result = std::search(source.begin(), source.end(), m_Searcher);
+
+    if ( iterator_result == source.end() )
+    {
+        return std::nullopt;
+    }
+
+    return static_cast<std::uint64_t>(std::distance(source.begin(), iterator_result));
+}
@@ -0,0 +1,39 @@
+#include "Module/Internal/ByteFingerprint.hpp"
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Fingerprint of some data.
+     * @param data The data.
+     */
+    ByteFingerprint::ByteFingerprint(const std::span<const std::byte> data) noexcept
+        : m_Bytes{}
+        , m_Size{ data.size() }
+    {
+        for ( const std::byte value : data )
+        {
+            const auto bit = std::to_integer<std::size_t>(value);
+            m_Bytes[bit / 64] |= std::uint64_t{ 1 } << (bit % 64);
+        }
+    }
+
+    /**
+     * @brief Check if a pattern may occur in the data.
+     * @param pattern The fingerprint of the pattern.
+     * @return False if the pattern cannot occur: it is longer, or it has a byte the data lacks.
+     */
+    bool ByteFingerprint::MayContain(const ByteFingerprint& pattern) const noexcept
+    {
+        const std::uint64_t missing = (pattern.m_Bytes[0] & ~m_Bytes[0]) | (pattern.m_Bytes[1] & ~m_Bytes[1]) | (pattern.m_Bytes[2] & ~m_Bytes[2]) | (pattern.m_Bytes[3] & ~m_Bytes[3]);
+        return missing == 0 && pattern.m_Size <= m_Size;
+    }
+
+    /**
+     * @brief Get the length of the data.
+     * @return The number of bytes the fingerprint was taken of.
+     */
+    std::size_t ByteFingerprint::GetSize() const noexcept
+    {
+        return m_Size;
+    }
+} // namespace Program::Module::Internal
@@ -0,0 +1,96 @@
+#include "Module/Internal/CompiledPatternList.hpp"
+#include <algorithm>
+#include <iterator>
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Compile every pattern.
+     * @param engine The search engine that compiles the patterns.
+     * @param patterns The patterns.
+     */
+    CompiledPatternList::CompiledPatternList(const IDataSearchEngine& engine, const std::vector<std::vector<std::byte>>& patterns) noexcept
+        : m_Patterns{}
+        , m_Fingerprints{}
+    {
+        m_Patterns.reserve(patterns.size());
+        m_Fingerprints.reserve(patterns.size());
+        std::transform(patterns.cbegin(), patterns.cend(), std::back_inserter(m_Patterns), [&engine](const auto& pattern) { return engine.Compile(pattern); });
+        std::transform(patterns.cbegin(), patterns.cend(), std::back_inserter(m_Fingerprints), [](const auto& pattern) { return ByteFingerprint{ pattern }; });
+    }
+
+    /**
+     * @brief Get the number of patterns in the set.
+     * @return The number of patterns, empty patterns included.
+     */
+    std::size_t CompiledPatternList::GetPatternCount() const noexcept
+    {
+        return m_Patterns.size();
+    }
+
+    /**
+     * @brief Search for every pattern of the set in a given source data.
+     * @param source The source data to search in.
+     * @return The leftmost match; among matches at the same offset, the one with the lowest pattern index.
+     */
+    std::optional<PatternMatch> CompiledPatternList::Search(const std::span<const std::byte> source) const noexcept
+    {
+        std::optional<PatternMatch> result;
+        const ByteFingerprint       fingerprint{ source };
+
+        for ( std::size_t index = 0; index < m_Patterns.size(); ++index )
+        {
+            if ( not fingerprint.MayContain(m_Fingerprints[index]) )
+            {
+                continue;
+            }
+
+            const auto offset = m_Patterns[index]->Search(source);
+
+            if ( offset && (not result || static_cast<std::size_t>(*offset) < result->offset) )
+            {
+                result = PatternMatch{ index, static_cast<std::size_t>(*offset) };
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Check if any pattern of the set occurs in a given source data.
+     * @param source The source data to search in.
+     * @return True if Search would find a match.
+     */
+    bool CompiledPatternList::Contains(const std::span<const std::byte> source) const noexcept
+    {
+        const ByteFingerprint fingerprint{ source };
+
+        for ( std::size_t index = 0; index < m_Patterns.size(); ++index )
+        {
+            if ( fingerprint.MayContain(m_Fingerprints[index]) && m_Patterns[index]->Search(source) )
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief Find every pattern of the set that occurs in a given source data.
+     * @param source The source data to search in.
+     * @param matches The cleared bitset of the patterns.
+     */
+    void CompiledPatternList::Match(const std::span<const std::byte> source, const std::span<std::uint64_t> matches) const noexcept
+    {
+        const ByteFingerprint fingerprint{ source };
+
+        for ( std::size_t index = 0; index < m_Patterns.size(); ++index )
+        {
+            if ( fingerprint.MayContain(m_Fingerprints[index]) && m_Patterns[index]->Search(source) )
+            {
+                matches[index / 64] |= std::uint64_t{ 1 } << (index % 64);
+            }
+        }
+    }
+} // namespace Program::Module::Internal
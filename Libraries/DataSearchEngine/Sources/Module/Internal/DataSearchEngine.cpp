@@ -1,28 +1,134 @@
 #include "Module/Internal/DataSearchEngine.hpp"
+#include "Module/Internal/BoyerMoorePattern.hpp"
+#include "Module/Internal/MaskedPattern.hpp"
+#include "Module/Internal/SpanSearch.hpp"
 #include <algorithm>
 #include <functional>
 
+namespace
+{
+    using searcher_type = std::boyer_moore_searcher<std::span<const std::byte>::iterator>; //!< Searcher over a span
+
+    /**
+     * @brief Offset of the first occurrence of a pattern.
+     * @param source The source sequence.
+     * @param searcher The Boyer-Moore searcher of the pattern.
+     * @return The offset, or std::nullopt if the pattern is not found.
+     */
+    std::optional<std::size_t> FindFirst(const std::span<const std::byte> source, const searcher_type& searcher) noexcept
+    {
+        const auto iterator_result = std::search(source.begin(), source.end(), searcher);
+
+        if ( iterator_result == source.end() )
+        {
+            return std::nullopt;
+        }
+
+        return static_cast<std::size_t>(std::distance(source.begin(), iterator_result));
+    }
+} // namespace
+
+/**
+ * @brief Construct the engine.
+ * @param tier The instruction set tier of the masked pattern kernels.
+ */
+Program::Module::Internal::DataSearchEngine::DataSearchEngine(const Helpers::cpu_tier tier) noexcept
+    : m_Tier{ tier }
+{
+}
+
 /**
  * @brief Search for a sequence of bytes in a source sequence.
  * @param source The source sequence.
  * @param values_to_search The sequence of bytes to search for.
  * @return The index of the first occurrence of the sequence of bytes in the source sequence, or std::nullopt if the sequence of bytes is not found.
  */
-std::optional<int32_t> Program::Module::Internal::DataSearchEngine::Search(const std::vector<std::byte>& source, const std::vector<std::byte> values_to_search) const noexcept
+std::optional<int32_t> Program::Module::Internal::DataSearchEngine::Search(const std::vector<std::byte>& source, const std::vector<std::byte>& values_to_search) const noexcept
+{
+    const auto result = Search(std::span<const std::byte>{ source }, std::span<const std::byte>{ values_to_search });
+    return result ? std::optional{ static_cast<int32_t>(*result) } : std::nullopt;
+}
+
+/**
+ * @brief Compile a sequence of bytes to search for.
+ * @param values_to_search The sequence of bytes to search for.
+ * @return The compiled pattern, with its Boyer-Moore tables built.
+ */
+std::shared_ptr<const Program::Module::ICompiledPattern> Program::Module::Internal::DataSearchEngine::Compile(const std::vector<std::byte>& values_to_search) const noexcept
+{
+    return std::make_shared<BoyerMoorePattern>(values_to_search);
+}
+
+/**
+ * @brief Compile a masked sequence of bytes to search for.
+ * @param values_to_search The masked bytes to search for.
+ * @return The masked pattern, bound to the kernels of the engine tier.
+ */
+std::shared_ptr<const Program::Module::ICompiledPattern> Program::Module::Internal::DataSearchEngine::Compile(const std::vector<Helpers::masked_byte>& values_to_search) const noexcept
+{
+    return std::make_shared<MaskedPattern>(values_to_search, m_Tier);
+}
+
+/**
+ * @brief Search for a compiled pattern in a source sequence.
+ * @param source The source sequence.
+ * @param pattern The compiled pattern.
+ * @return The index of the first occurrence of the pattern in the source sequence, or std::nullopt if the pattern is not found.
+ */
+std::optional<int32_t> Program::Module::Internal::DataSearchEngine::Search(const std::vector<std::byte>& source, const ICompiledPattern& pattern) const noexcept
+{
+    return pattern.Search(source);
+}
+
+/**
+ * @brief Search for a sequence of bytes in a source sequence, without copies.
+ * @param source The source sequence.
+ * @param values_to_search The sequence of bytes to search for.
+ * @return The 64-bit offset of the first occurrence of the sequence of bytes in the source sequence, or std::nullopt if the sequence of bytes is not found.
+ */
+std::optional<std::uint64_t> Program::Module::Internal::DataSearchEngine::Search(const std::span<const std::byte> source, const std::span<const std::byte> values_to_search) const noexcept
 {
     if ( source.empty() || values_to_search.empty() )
     {
         return std::nullopt;
     }
 
-    const std::boyer_moore_searcher searcher(values_to_search.cbegin(), values_to_search.cend()); //!< Boyer-Moore algorithm is used for searching.
+    const searcher_type searcher(values_to_search.begin(), values_to_search.end()); //!< Boyer-Moore algorithm is used for searching.
+    return FindFirst(source, searcher);
+}
+
+/**
+ * @brief Find every occurrence of a sequence of bytes in a source sequence.
+ * @param source The source sequence.
+ * @param values_to_search The sequence of bytes to search for.
+ * @param offsets The buffer of the offsets.
+ * @return The number of offsets written.
+ */
+std::size_t Program::Module::Internal::DataSearchEngine::FindAll(const std::span<const std::byte> source, const std::span<const std::byte> values_to_search, const std::span<std::uint64_t> offsets) const noexcept
+{
+    if ( values_to_search.empty() )
+    {
+        return 0;
+    }
 
-    const auto iterator_result = std::search(source.cbegin(), source.cend(), searcher);
+    const searcher_type searcher(values_to_search.begin(), values_to_search.end()); //!< Built once, shared by every occurrence.
+    return FindAllOffsets(source, values_to_search.size(), offsets, [&searcher](const std::span<const std::byte> suffix) { return FindFirst(suffix, searcher); });
+}
 
-    if ( iterator_result == source.cend() )
+/**
+ * @brief Count the occurrences of a sequence of bytes in a source sequence.
+ * @param source The source sequence.
+ * @param values_to_search The sequence of bytes to search for.
+ * @param overlapping Whether an occurrence may start inside the previous one.
+ * @return The number of occurrences.
+ */
+std::uint64_t Program::Module::Internal::DataSearchEngine::Count(const std::span<const std::byte> source, const std::span<const std::byte> values_to_search, const bool overlapping) const noexcept
+{
+    if ( values_to_search.empty() )
     {
-        return std::nullopt;
+        return 0;
     }
 
-    return static_cast<int32_t>(std::distance(source.cbegin(), iterator_result));
+    const searcher_type searcher(values_to_search.begin(), values_to_search.end()); //!< Built once, shared by every occurrence.
+    return CountOffsets(source, values_to_search.size(), overlapping, [&searcher](const std::span<const std::byte> suffix) { return FindFirst(suffix, searcher); });
 }
@@ -0,0 +1,87 @@
+#include "Module/Internal/DelegatingSearchEngine.hpp"
+
+/**
+ * @brief Construct the engine.
+ * @param tier The instruction set tier of the single pattern searches.
+ */
+Program::Module::Internal::DelegatingSearchEngine::DelegatingSearchEngine(const Helpers::cpu_tier tier) noexcept
+    : m_SearchEngine{ tier }
+{
+}
+
+/**
+ * @brief Search for a sequence of bytes in a source sequence.
+ * @param source The source sequence.
+ * @param values_to_search The sequence of bytes to search for.
+ * @return The index of the first occurrence of the sequence of bytes in the source sequence, or std::nullopt if the sequence of bytes is not found.
+ */
+std::optional<int32_t> Program::Module::Internal::DelegatingSearchEngine::Search(const std::vector<std::byte>& source, const std::vector<std::byte>& values_to_search) const noexcept
+{
+    return m_SearchEngine.Search(source, values_to_search);
+}
+
+/**
+ * @brief Compile a sequence of bytes to search for.
+ * @param values_to_search The sequence of bytes to search for.
+ * @return The compiled pattern of the adaptive engine.
+ */
+std::shared_ptr<const Program::Module::ICompiledPattern> Program::Module::Internal::DelegatingSearchEngine::Compile(const std::vector<std::byte>& values_to_search) const noexcept
+{
+    return m_SearchEngine.Compile(values_to_search);
+}
+
+/**
+ * @brief Compile a masked sequence of bytes to search for.
+ * @param values_to_search The masked bytes to search for.
+ * @return The masked pattern of the adaptive engine.
+ */
+std::shared_ptr<const Program::Module::ICompiledPattern> Program::Module::Internal::DelegatingSearchEngine::Compile(const std::vector<Helpers::masked_byte>& values_to_search) const noexcept
+{
+    return m_SearchEngine.Compile(values_to_search);
+}
+
+/**
+ * @brief Search for a compiled pattern in a source sequence.
+ * @param source The source sequence.
+ * @param pattern The compiled pattern.
+ * @return The index of the first occurrence of the pattern in the source sequence, or std::nullopt if the pattern is not found.
+ */
+std::optional<int32_t> Program::Module::Internal::DelegatingSearchEngine::Search(const std::vector<std::byte>& source, const ICompiledPattern& pattern) const noexcept
+{
+    return m_SearchEngine.Search(source, pattern);
+}
+
+/**
+ * @brief Search for a sequence of bytes in a source sequence, without copies.
+ * @param source The source sequence.
+ * @param values_to_search The sequence of bytes to search for.
+ * @return The 64-bit offset of the first occurrence of the sequence of bytes in the source sequence, or std::nullopt if the sequence of bytes is not found.
+ */
+std::optional<std::uint64_t> Program::Module::Internal::DelegatingSearchEngine::Search(const std::span<const std::byte> source, const std::span<const std::byte> values_to_search) const noexcept
+{
+    return m_SearchEngine.Search(source, values_to_search);
+}
+
+/**
+ * @brief Find every occurrence of a sequence of bytes in a source sequence.
+ * @param source The source sequence.
+ * @param values_to_search The sequence of bytes to search for.
+ * @param offsets The buffer of the offsets.
+ * @return The number of offsets written.
+ */
+std::size_t Program::Module::Internal::DelegatingSearchEngine::FindAll(const std::span<const std::byte> source, const std::span<const std::byte> values_to_search, const std::span<std::uint64_t> offsets) const noexcept
+{
+    return m_SearchEngine.FindAll(source, values_to_search, offsets);
+}
+
+/**
+ * @brief Count the occurrences of a sequence of bytes in a source sequence.
+ * @param source The source sequence.
+ * @param values_to_search The sequence of bytes to search for.
+ * @param overlapping Whether an occurrence may start inside the previous one.
+ * @return The number of occurrences.
+ */
+std::uint64_t Program::Module::Internal::DelegatingSearchEngine::Count(const std::span<const std::byte> source, const std::span<const std::byte> values_to_search, const bool overlapping) const noexcept
+{
+    return m_SearchEngine.Count(source, values_to_search, overlapping);
+}
@@ -0,0 +1,161 @@
+#include "Module/Internal/MaskedCompareKernel.hpp"
+#include <cinttypes>
+#include <cstring>
+
+#if defined(__HELPER_CPU_FEATURES_X86__)
+ #include <immintrin.h>
+#endif
+
+namespace Program::Module::Internal
+{
+    namespace
+    {
+        /**
+         * @brief Compare the bytes from position to the end, 8 bytes at a time, then one by one.
+         * @details The scalar kernel, and the tail of the SSE2 and AVX2 kernels.
+         */
+        inline bool CompareTail(const std::byte* source, const std::byte* values, const std::byte* masks, const std::size_t size, std::size_t position) noexcept
+        {
+            for ( ; position + 8 <= size; position += 8 )
+            {
+                std::uint64_t source_word;
+                std::uint64_t values_word;
+                std::uint64_t masks_word;
+
+                std::memcpy(&source_word, source + position, 8);
+                std::memcpy(&values_word, values + position, 8);
+                std::memcpy(&masks_word, masks + position, 8);
+
+                if ( (source_word & masks_word) != values_word )
+                {
+                    return false;
+                }
+            }
+
+            for ( ; position < size; ++position )
+            {
+                if ( (source[position] & masks[position]) != values[position] )
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief 8 bytes per step, then one by one.
+         * @details The kernel of the scalar tier, and of every tier off x86.
+         */
+        bool CompareScalar(const std::byte* source, const std::byte* values, const std::byte* masks, const std::size_t size) noexcept
+        {
+            return CompareTail(source, values, masks, size, 0);
+        }
+
+#if defined(__HELPER_CPU_FEATURES_X86__)
+        /**
+         * @brief 16 bytes per step.
+         * @param position First byte to compare; advanced past the bytes compared.
+         */
+        HELPERS_TARGET_SSE2 inline bool CompareSse2Steps(const std::byte* source, const std::byte* values, const std::byte* masks, const std::size_t size, std::size_t& position) noexcept
+        {
+            for ( ; position + 16 <= size; position += 16 )
+            {
+                const __m128i block = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(source + position)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(masks + position)));
+                const __m128i equal = _mm_cmpeq_epi8(block, _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + position)));
+
+                if ( _mm_movemask_epi8(equal) != 0xFFFF )
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief 32 bytes per step.
+         * @param position First byte to compare; advanced past the bytes compared.
+         */
+        HELPERS_TARGET_AVX2 inline bool CompareAvx2Steps(const std::byte* source, const std::byte* values, const std::byte* masks, const std::size_t size, std::size_t& position) noexcept
+        {
+            for ( ; position + 32 <= size; position += 32 )
+            {
+                const __m256i block = _mm256_and_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + position)), _mm256_loadu_si256(reinterpret_cast<const __m256i*>(masks + position)));
+                const __m256i equal = _mm256_cmpeq_epi8(block, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + position)));
+
+                if ( _mm256_movemask_epi8(equal) != -1 )
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief 16 bytes per step, then the scalar tail.
+         */
+        HELPERS_TARGET_SSE2 bool CompareSse2(const std::byte* source, const std::byte* values, const std::byte* masks, const std::size_t size) noexcept
+        {
+            std::size_t position = 0;
+            return CompareSse2Steps(source, values, masks, size, position) && CompareTail(source, values, masks, size, position);
+        }
+
+        /**
+         * @brief 32 bytes per step, then one 16-byte step, then the scalar tail.
+         */
+        HELPERS_TARGET_AVX2 bool CompareAvx2(const std::byte* source, const std::byte* values, const std::byte* masks, const std::size_t size) noexcept
+        {
+            std::size_t position = 0;
+            return CompareAvx2Steps(source, values, masks, size, position) && CompareSse2Steps(source, values, masks, size, position) && CompareTail(source, values, masks, size, position);
+        }
+
+        /**
+         * @brief 64 bytes per step; the last step only loads the remaining bytes, so there is no tail.
+         */
+        HELPERS_TARGET_AVX512 bool CompareAvx512(const std::byte* source, const std::byte* values, const std::byte* masks, const std::size_t size) noexcept
+        {
+            for ( std::size_t position = 0; position < size; position += 64 )
+            {
+                const std::size_t remaining = size - position;
+                const __mmask64   lanes     = remaining >= 64 ? ~__mmask64{ 0 } : (__mmask64{ 1 } << remaining) - 1;
+                const __m512i     block     = _mm512_and_si512(_mm512_maskz_loadu_epi8(lanes, source + position), _mm512_maskz_loadu_epi8(lanes, masks + position));
+
+                if ( _mm512_cmpeq_epi8_mask(block, _mm512_maskz_loadu_epi8(lanes, values + position)) != ~__mmask64{ 0 } )
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+#endif
+    } // namespace
+
+    /**
+     * @brief Get the masked compare kernel of a tier.
+     * @param tier The instruction set tier.
+     * @return The kernel. Every tier gives the same answers; the scalar kernel is the only one off x86.
+     */
+    MaskedCompareKernel GetMaskedCompareKernel(const Helpers::cpu_tier tier) noexcept
+    {
+        switch ( tier )
+        {
+#if defined(__HELPER_CPU_FEATURES_X86__)
+            case Helpers::cpu_tier::avx512:
+                return &CompareAvx512;
+
+            case Helpers::cpu_tier::avx2:
+                return &CompareAvx2;
+
+            case Helpers::cpu_tier::sse2:
+                return &CompareSse2;
+#endif
+
+            case Helpers::cpu_tier::scalar:
+            default:
+                return &CompareScalar;
+        }
+    }
+} // namespace Program::Module::Internal
@@ -0,0 +1,111 @@
+#include "Module/Internal/MaskedPattern.hpp"
+
+/**
+ * @brief Compile a pattern.
+ * @param values_to_search The masked bytes to search for.
+ * @param tier The instruction set tier of the kernels.
+ * @note The anchor is the first of the longest runs of bytes whose mask is 0xFF.
+ */
+Program::Module::Internal::MaskedPattern::MaskedPattern(const std::vector<Helpers::masked_byte>& values_to_search, const Helpers::cpu_tier tier) noexcept
+    : m_Pattern{}
+    , m_Masks{}
+    , m_Anchor{ 0 }
+    , m_AnchorSize{ 0 }
+    , m_Search{ nullptr }
+    , m_Compare{ GetMaskedCompareKernel(tier) }
+{
+    m_Pattern.reserve(values_to_search.size());
+    m_Masks.reserve(values_to_search.size());
+
+    std::size_t run = 0;
+
+    for ( std::size_t index = 0; index < values_to_search.size(); ++index )
+    {
+        const auto [value, mask] = values_to_search[index];
+
+        m_Pattern.push_back(value & mask);
+        m_Masks.push_back(mask);
+
+        run = mask == std::byte{ 0xFF } ? run + 1 : 0;
+
+        if ( run > m_AnchorSize )
+        {
+            m_Anchor     = index + 1 - run;
+            m_AnchorSize = run;
+        }
+    }
+
+    m_Search = GetSimdSearchKernel(tier, m_AnchorSize);
+}
+
+/**
+ * @brief Get the pattern.
+ * @return The values of the masked bytes to search for.
+ */
+const std::vector<std::byte>& Program::Module::Internal::MaskedPattern::GetPattern() const noexcept
+{
+    return m_Pattern;
+}
+
+/**
+ * @brief Search for the pattern in a source sequence.
+ * @param source The source sequence.
+ * @return The index of the first occurrence of the pattern in the source sequence, or std::nullopt if the pattern is not found.
+ */
+std::optional<int32_t> Program::Module::Internal::MaskedPattern::Search(const std::vector<std::byte>& source) const noexcept
+{
+    const auto result = Search(std::span<const std::byte>{ source });
+    return result ? std::optional{ static_cast<int32_t>(*result) } : std::nullopt;
+}
+
+/**
+ * @brief Search for the pattern in a source sequence, without copies.
+ * @param source The source sequence.
+ * @return The 64-bit offset of the first occurrence of the pattern in the source sequence, or std::nullopt if the pattern is not found.
+ * @note The anchor is only searched where the whole pattern fits, so every anchor hit is a candidate start.
+ */
+std::optional<std::uint64_t> Program::Module::Internal::MaskedPattern::Search(const std::span<const std::byte> source) const noexcept
+{
+    const std::size_t size = m_Pattern.size();
+
+    if ( size == 0 || size > source.size() )
+    {
+        return std::nullopt;
+    }
+
+    const std::size_t last = source.size() - size; //!< Last candidate start.
+
+    if ( m_AnchorSize == 0 )
+    {
+        for ( std::size_t position = 0; position <= last; ++position )
+        {
+            if ( m_Compare(source.data() + position, m_Pattern.data(), m_Masks.data(), size) )
+            {
+                return position;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    for ( std::size_t start = 0; start <= last; )
+    {
+        const auto found = m_Search(source.data() + start + m_Anchor, last - start + m_AnchorSize, m_Pattern.data() + m_Anchor, m_AnchorSize);
+
+        if ( not found )
+        {
+            return std::nullopt;
+        }
+
+        const std::size_t candidate = start + *found;
+
+        if ( m_Compare(source.data() + candidate, m_Pattern.data(), m_Masks.data(), size) )
+        {
+            return candidate;
+        }
+
+        start = candidate + 1;
+    }
+
+    return std::nullopt;
+}
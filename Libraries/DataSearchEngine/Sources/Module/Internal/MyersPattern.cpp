@@ -0,0 +1,225 @@
+#include "Module/Internal/MyersPattern.hpp"
+#include <algorithm>
+#include <array>
+
+namespace
+{
+    /**
+     * @brief Advance one word of a column by one source byte.
+     * @param positive The vertical +1 deltas.
+     * @param negative The vertical -1 deltas.
+     * @param equal The pattern bytes equal to the source byte.
+     * @param carry The horizontal delta entering the first row of the word: 0 or 1 from the row above, -1, 0 or 1 from the word above.
+     * @param last The bit of the last row of the word that belongs to the pattern.
+     * @return The horizontal delta leaving that row.
+     */
+    inline int32_t Advance(std::uint64_t& positive, std::uint64_t& negative, std::uint64_t equal, const int32_t carry, const std::uint32_t last) noexcept
+    {
+        const std::uint64_t carry_negative = carry < 0 ? 1 : 0;
+        const std::uint64_t vertical       = equal | negative;
+
+        equal |= carry_negative;
+
+        const std::uint64_t horizontal          = (((equal & positive) + positive) ^ positive) | equal;
+        std::uint64_t       horizontal_positive = negative | ~(horizontal | positive);
+        std::uint64_t       horizontal_negative = positive & horizontal;
+
+        const int32_t delta = static_cast<int32_t>((horizontal_positive >> last) & 1) - static_cast<int32_t>((horizontal_negative >> last) & 1);
+
+        horizontal_positive = (horizontal_positive << 1) | (carry > 0 ? 1 : 0);
+        horizontal_negative = (horizontal_negative << 1) | carry_negative;
+
+        positive = horizontal_negative | ~(vertical | horizontal_positive);
+        negative = horizontal_positive & vertical;
+
+        return delta;
+    }
+
+    /**
+     * @brief Build the masks of a pattern.
+     * @param pattern The pattern bytes, in the order they are searched.
+     * @param words The words per mask.
+     * @return Per byte value, the bits of the pattern bytes of that value.
+     */
+    template<typename TIterator>
+    std::vector<std::uint64_t> GetMasks(TIterator first, const TIterator last, const std::size_t words) noexcept
+    {
+        std::vector<std::uint64_t> masks(256 * words);
+
+        for ( std::size_t index = 0; first != last; ++first, ++index )
+        {
+            masks[std::to_integer<std::size_t>(*first) * words + index / 64] |= std::uint64_t{ 1 } << (index % 64);
+        }
+
+        return masks;
+    }
+    /**
+     * @brief Run the forward and the backward pass over a source.
+     * @tparam Words The words per bit vector, or 0 when only known at run time.
+     * @param source The source sequence.
+     * @param forward The masks of the pattern.
+     * @param backward The masks of the reversed pattern.
+     * @param deltas Room for the +1 and the -1 bit vectors.
+     * @param words The words per bit vector.
+     * @param length The length of the pattern.
+     * @param max_distance The largest number of edits.
+     * @return The first match within the maximum number of edits, or std::nullopt if there is none.
+     * @note The forward pass may start anywhere in the source: no horizontal delta enters the first row. The backward pass is
+     * anchored at the end of the match: every byte adds one to the first row, so its score is the distance to the bytes read so far.
+     */
+    template<std::size_t Words>
+    std::optional<Program::Module::ApproximateMatch> SearchColumns(const std::span<const std::byte> source, const std::uint64_t* forward, const std::uint64_t* backward, std::uint64_t* deltas, const std::size_t words, const std::size_t length, const std::size_t max_distance) noexcept
+    {
+        const std::size_t   count = Words > 0 ? Words : words;
+        const std::uint32_t last  = static_cast<std::uint32_t>((length - 1) % 64);
+
+        std::array<std::uint64_t, 2 * Words> local_deltas; //!< Kept in registers when the word count is known.
+        std::uint64_t*                       positive = Words > 0 ? local_deltas.data() : deltas;
+        std::uint64_t*                       negative = positive + count;
+
+        const auto advance = [&](const std::uint64_t* masks, const std::byte value, int32_t carry) noexcept
+        {
+            const std::uint64_t* equal = masks + std::to_integer<std::size_t>(value) * count;
+
+            for ( std::size_t word = 0; word < count; ++word )
+            {
+                carry = Advance(positive[word], negative[word], equal[word], carry, word + 1 < count ? 63 : last);
+            }
+
+            return carry;
+        };
+
+        std::fill_n(positive, count, ~std::uint64_t{ 0 });
+        std::fill_n(negative, count, 0);
+
+        std::int64_t               score    = static_cast<std::int64_t>(length);
+        std::int64_t               distance = 0;
+        std::optional<std::size_t> end;
+
+        for ( std::size_t position = 0; position < source.size(); ++position )
+        {
+            score += advance(forward, source[position], 0);
+
+            if ( end )
+            {
+                if ( score >= distance )
+                {
+                    break;
+                }
+
+                end      = position;
+                distance = score;
+            }
+            else if ( score <= static_cast<std::int64_t>(max_distance) )
+            {
+                end      = position;
+                distance = score;
+            }
+
+            if ( end && distance == 0 )
+            {
+                break;
+            }
+        }
+
+        if ( not end )
+        {
+            return std::nullopt;
+        }
+
+        std::fill_n(positive, count, ~std::uint64_t{ 0 });
+        std::fill_n(negative, count, 0);
+
+        const std::size_t longest = std::min(*end + 1, length + static_cast<std::size_t>(distance));
+        score                     = static_cast<std::int64_t>(length);
+
+        for ( std::size_t size = 1; size <= longest; ++size )
+        {
+            score += advance(backward, source[*end + 1 - size], 1);
+
+            if ( score <= distance )
+            {
+                return Program::Module::ApproximateMatch{ *end + 1 - size, size, static_cast<std::size_t>(distance) };
+            }
+        }
+
+        return Program::Module::ApproximateMatch{ *end + 1 - longest, longest, static_cast<std::size_t>(distance) }; //!< Not reached: the distance of the end is reached by some start.
+    }
+} // namespace
+
+/**
+ * @brief Compile a pattern.
+ * @param values_to_search The sequence of bytes to search for.
+ * @param max_distance The largest number of edits.
+ */
+Program::Module::Internal::MyersPattern::MyersPattern(const std::span<const std::byte> values_to_search, const std::size_t max_distance) noexcept
+    : m_Pattern{ values_to_search.begin(), values_to_search.end() }
+    , m_MaxDistance{ values_to_search.empty() ? 0 : std::min(max_distance, values_to_search.size() - 1) }
+    , m_Words{ (values_to_search.size() + 63) / 64 }
+    , m_Forward{ GetMasks(values_to_search.begin(), values_to_search.end(), m_Words) }
+    , m_Backward{ GetMasks(values_to_search.rbegin(), values_to_search.rend(), m_Words) }
+{
+}
+
+/**
+ * @brief Get the pattern.
+ * @return The sequence of bytes to search for.
+ */
+const std::vector<std::byte>& Program::Module::Internal::MyersPattern::GetPattern() const noexcept
+{
+    return m_Pattern;
+}
+
+/**
+ * @brief Get the metric.
+ * @return ApproximateMetric::Levenshtein.
+ */
+Program::Module::ApproximateMetric Program::Module::Internal::MyersPattern::GetMetric() const noexcept
+{
+    return ApproximateMetric::Levenshtein;
+}
+
+/**
+ * @brief Get the maximum distance.
+ * @return The largest number of edits.
+ */
+std::size_t Program::Module::Internal::MyersPattern::GetMaxDistance() const noexcept
+{
+    return m_MaxDistance;
+}
+
+/**
+ * @brief Search for the pattern in a source sequence.
+ * @param source The source sequence.
+ * @return The first match within the maximum number of edits, or std::nullopt if there is none.
+ * @note One and two word vectors, the patterns of up to 128 bytes, get kernels with the word count known at compile time.
+ */
+std::optional<Program::Module::ApproximateMatch> Program::Module::Internal::MyersPattern::Search(const std::span<const std::byte> source) const noexcept
+{
+    if ( m_Pattern.empty() )
+    {
+        return std::nullopt;
+    }
+
+    std::array<std::uint64_t, StackWords> stack_deltas;
+    std::vector<std::uint64_t>            heap_deltas;
+    std::uint64_t*                        deltas = stack_deltas.data();
+
+    if ( 2 * m_Words > StackWords )
+    {
+        heap_deltas.resize(2 * m_Words);
+        deltas = heap_deltas.data();
+    }
+
+    switch ( m_Words )
+    {
+        case 1:
+            return SearchColumns<1>(source, m_Forward.data(), m_Backward.data(), deltas, m_Words, m_Pattern.size(), m_MaxDistance);
+
+        case 2:
+            return SearchColumns<2>(source, m_Forward.data(), m_Backward.data(), deltas, m_Words, m_Pattern.size(), m_MaxDistance);
+
+        default:
+            return SearchColumns<0>(source, m_Forward.data(), m_Backward.data(), deltas, m_Words, m_Pattern.size(), m_MaxDistance);
+    }
+}
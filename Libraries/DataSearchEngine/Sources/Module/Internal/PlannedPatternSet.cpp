@@ -0,0 +1,283 @@
+#include "Module/Internal/PlannedPatternSet.hpp"
+#include <algorithm>
+
+namespace Program::Module::Internal
+{
+    namespace
+    {
+        /**
+         * @brief Whether a bit of a bitmap is set.
+         */
+        template<typename TBitmap>
+        inline bool TestBit(const TBitmap& bitmap, const std::size_t bit) noexcept
+        {
+            return (bitmap[bit / 64] >> (bit % 64)) & 1;
+        }
+
+        /**
+         * @brief Set a bit of a bitmap.
+         */
+        template<typename TBitmap>
+        inline void SetBit(TBitmap& bitmap, const std::size_t bit) noexcept
+        {
+            bitmap[bit / 64] |= std::uint64_t{ 1 } << (bit % 64);
+        }
+
+        /**
+         * @brief Keep the leftmost match, the lowest pattern index on ties.
+         */
+        inline void KeepBest(std::optional<PatternMatch>& result, const PatternMatch& match) noexcept
+        {
+            if ( not result || match.offset < result->offset || (match.offset == result->offset && match.pattern < result->pattern) )
+            {
+                result = match;
+            }
+        }
+    } // namespace
+
+    /**
+     * @brief Split the patterns in tiers.
+     * @param patterns The patterns.
+     * @param long_patterns The patterns longer than 2 bytes, compiled by the real searcher.
+     * @param long_indexes The index in patterns of every pattern of long_patterns.
+     * @param long_fingerprints The fingerprint of every pattern of long_patterns, or none if long_patterns filters the sources itself.
+     */
+    PlannedPatternSet::PlannedPatternSet(const std::vector<std::vector<std::byte>>& patterns, std::shared_ptr<const IPatternSet> long_patterns, std::vector<std::size_t> long_indexes, std::vector<ByteFingerprint> long_fingerprints) noexcept
+        : m_Bytes{}
+        , m_ByteIndexes{}
+        , m_BytePatterns{}
+        , m_Bigrams{}
+        , m_BigramIndexes{}
+        , m_LongPatterns{ std::move(long_patterns) }
+        , m_LongIndexes{ std::move(long_indexes) }
+        , m_LongFingerprints{ std::move(long_fingerprints) }
+        , m_PatternCount{ patterns.size() }
+        , m_HasBytes{ false }
+    {
+        m_ByteIndexes.fill(None);
+
+        for ( std::size_t index = 0; index < patterns.size(); ++index )
+        {
+            const auto& pattern = patterns[index];
+
+            if ( pattern.size() == 1 )
+            {
+                const auto value = std::to_integer<std::size_t>(pattern[0]);
+                SetBit(m_Bytes, value);
+                m_ByteIndexes[value] = std::min(m_ByteIndexes[value], index);
+                m_BytePatterns.emplace_back(value, index);
+                m_HasBytes           = true;
+            }
+            else if ( pattern.size() == 2 )
+            {
+                const std::size_t bigram = GetBigram(pattern[0], pattern[1]);
+                m_Bigrams.resize(65536 / 64);
+                SetBit(m_Bigrams, bigram);
+                m_BigramIndexes.emplace_back(bigram, index);
+            }
+        }
+
+        std::sort(m_BigramIndexes.begin(), m_BigramIndexes.end());
+        std::sort(m_LongFingerprints.begin(), m_LongFingerprints.end(), [](const ByteFingerprint& left, const ByteFingerprint& right) { return left.GetSize() < right.GetSize(); });
+    }
+
+    /**
+     * @brief Get the number of patterns in the set.
+     * @return The number of patterns, empty patterns included.
+     */
+    std::size_t PlannedPatternSet::GetPatternCount() const noexcept
+    {
+        return m_PatternCount;
+    }
+
+    /**
+     * @brief Read a bigram.
+     * @return The first byte in the high bits, the second one in the low bits.
+     */
+    std::size_t PlannedPatternSet::GetBigram(const std::byte first, const std::byte second) noexcept
+    {
+        return (std::to_integer<std::size_t>(first) << 8) | std::to_integer<std::size_t>(second);
+    }
+
+    /**
+     * @brief Leftmost offset of a 1-byte pattern.
+     * @param source The source data to search in.
+     * @return The offset, or an empty optional if no 1-byte pattern occurs.
+     */
+    std::optional<std::size_t> PlannedPatternSet::FindByte(const std::span<const std::byte> source) const noexcept
+    {
+        if ( m_HasBytes )
+        {
+            const auto found = std::find_if(source.begin(), source.end(), [this](const std::byte value) { return TestBit(m_Bytes, std::to_integer<std::size_t>(value)); });
+
+            if ( found != source.end() )
+            {
+                return static_cast<std::size_t>(std::distance(source.begin(), found));
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Leftmost offset of a 2-byte pattern.
+     * @param source The source data to search in.
+     * @return The offset, or an empty optional if no 2-byte pattern occurs.
+     */
+    std::optional<std::size_t> PlannedPatternSet::FindBigram(const std::span<const std::byte> source) const noexcept
+    {
+        if ( not m_Bigrams.empty() )
+        {
+            for ( std::size_t position = 0; position + 1 < source.size(); ++position )
+            {
+                if ( TestBit(m_Bigrams, GetBigram(source[position], source[position + 1])) )
+                {
+                    return position;
+                }
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Check if a pattern longer than 2 bytes may occur in the source.
+     * @param source The source data to search in.
+     * @return False if the fingerprint of the source rejects every long pattern, so the real searcher can be skipped.
+     * @note The fingerprints are sorted by pattern length: the test stops at the first pattern longer than the source, and
+     * only the few short enough to fit are tested byte by byte.
+     */
+    bool PlannedPatternSet::MayContainLong(const std::span<const std::byte> source) const noexcept
+    {
+        if ( m_LongFingerprints.empty() )
+        {
+            return true;
+        }
+
+        const ByteFingerprint fingerprint{ source };
+
+        for ( const ByteFingerprint& pattern : m_LongFingerprints )
+        {
+            if ( pattern.GetSize() > source.size() )
+            {
+                break; //!< Every next pattern is at least as long.
+            }
+
+            if ( fingerprint.MayContain(pattern) )
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /**
+     * @brief Search for every pattern of the set in a given source data.
+     * @param source The source data to search in.
+     * @return The leftmost match; among matches at the same offset, the one with the lowest pattern index.
+     */
+    std::optional<PatternMatch> PlannedPatternSet::Search(const std::span<const std::byte> source) const noexcept
+    {
+        std::optional<PatternMatch> result;
+
+        if ( const auto offset = FindByte(source) )
+        {
+            KeepBest(result, { m_ByteIndexes[std::to_integer<std::size_t>(source[*offset])], *offset });
+        }
+
+        if ( const auto offset = FindBigram(source) )
+        {
+            // The indexes are sorted by bigram, then by index: the first one of the bigram is the lowest index.
+            const std::pair<std::size_t, std::size_t> key{ GetBigram(source[*offset], source[*offset + 1]), 0 };
+            KeepBest(result, { std::lower_bound(m_BigramIndexes.cbegin(), m_BigramIndexes.cend(), key)->second, *offset });
+        }
+
+        if ( m_LongPatterns && MayContainLong(source) )
+        {
+            if ( const auto match = m_LongPatterns->Search(source) )
+            {
+                KeepBest(result, { m_LongIndexes[match->pattern], match->offset });
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Check if any pattern of the set occurs in a given source data.
+     * @param source The source data to search in.
+     * @return True if Search would find a match.
+     */
+    bool PlannedPatternSet::Contains(const std::span<const std::byte> source) const noexcept
+    {
+        return FindByte(source) || FindBigram(source) || (m_LongPatterns && MayContainLong(source) && m_LongPatterns->Contains(source));
+    }
+
+    /**
+     * @brief Find every pattern of the set that occurs in a given source data.
+     * @param source The source data to search in.
+     * @param matches The cleared bitset of the patterns.
+     * @note The long patterns are matched into a bitset of their own, then mapped back to their indexes in the set. The
+     * bitset lives on the stack up to InlineWords words, in a buffer of the calling thread beyond: Match does not allocate
+     * once every batch worker has grown its buffer.
+     */
+    void PlannedPatternSet::Match(const std::span<const std::byte> source, const std::span<std::uint64_t> matches) const noexcept
+    {
+        if ( m_HasBytes )
+        {
+            std::array<std::uint64_t, 4> present{}; //!< Bitmap of the bytes of the source
+
+            for ( const std::byte value : source )
+            {
+                SetBit(present, std::to_integer<std::size_t>(value));
+            }
+
+            for ( const auto& [value, index] : m_BytePatterns )
+            {
+                if ( TestBit(present, value) )
+                {
+                    SetBit(matches, index);
+                }
+            }
+        }
+
+        if ( not m_Bigrams.empty() )
+        {
+            for ( std::size_t position = 0; position + 1 < source.size(); ++position )
+            {
+                if ( const std::size_t bigram = GetBigram(source[position], source[position + 1]); TestBit(m_Bigrams, bigram) )
+                {
+                    for ( auto entry = std::lower_bound(m_BigramIndexes.cbegin(), m_BigramIndexes.cend(), std::pair<std::size_t, std::size_t>{ bigram, 0 }); entry != m_BigramIndexes.cend() && entry->first == bigram; ++entry )
+                    {
+                        SetBit(matches, entry->second);
+                    }
+                }
+            }
+        }
+
+        if ( m_LongPatterns && MayContainLong(source) )
+        {
+            const std::size_t                       words = (m_LongIndexes.size() + 63) / 64;
+            std::array<std::uint64_t, InlineWords>  inline_matches{}; //!< Bitset of the long patterns, up to InlineWords * 64 of them
+            thread_local std::vector<std::uint64_t> scratch_matches;  //!< Bitset of a larger set; grows once per thread, then reused
+            std::span<std::uint64_t>                long_matches{ inline_matches.data(), std::min(words, InlineWords) };
+
+            if ( words > InlineWords )
+            {
+                scratch_matches.assign(words, 0);
+                long_matches = scratch_matches;
+            }
+
+            m_LongPatterns->Match(source, long_matches);
+
+            for ( std::size_t index = 0; index < m_LongIndexes.size(); ++index )
+            {
+                if ( TestBit(long_matches, index) )
+                {
+                    SetBit(matches, m_LongIndexes[index]);
+                }
+            }
+        }
+    }
+} // namespace Program::Module::Internal
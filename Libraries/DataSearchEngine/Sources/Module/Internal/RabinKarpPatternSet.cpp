@@ -0,0 +1,261 @@
+#include "Module/Internal/RabinKarpPatternSet.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <iterator>
+#include <tuple>
+
+namespace Program::Module::Internal
+{
+    namespace
+    {
+        constexpr std::uint64_t Mix            = 0x9E3779B97F4A7C15; //!< Fibonacci hashing multiplier: the indexes take the high bits
+        constexpr std::size_t   GateBitsPerKey = 64;                 //!< Bitmap bits per key: about one false pass in 64 per class
+        constexpr std::size_t   MaxGateBits    = 18;                 //!< At most 2^18 bits, 32 KiB, of bitmap per class
+
+        /**
+         * @brief Number of prefix bytes a pattern is keyed by.
+         * @return The largest of 1, 2, 4 and 8 that is at most the pattern size.
+         */
+        constexpr std::size_t GetPrefixLength(const std::size_t size) noexcept
+        {
+            return size >= 8 ? 8 : std::bit_floor(size);
+        }
+    } // namespace
+
+    /**
+     * @brief Key the patterns and build the bitmaps and the tables.
+     * @param patterns The patterns.
+     * @note Every table holds at least twice as many slots as distinct keys, so probes stay short. The patterns of one key
+     * are one run of entries, sorted by index, and the slot of the key points at the first one.
+     */
+    RabinKarpPatternSet::RabinKarpPatternSet(const std::vector<std::vector<std::byte>>& patterns) noexcept
+        : m_Patterns{}
+        , m_Classes{}
+        , m_Gates{}
+        , m_Slots{}
+        , m_Entries{}
+    {
+        std::size_t total_size = 0;
+
+        for ( const auto& pattern : patterns )
+        {
+            total_size += pattern.size();
+        }
+
+        m_Patterns.reserve(patterns.size(), total_size);
+
+        for ( std::size_t index = 0; index < patterns.size(); ++index )
+        {
+            m_Patterns.push_back(patterns[index]);
+
+            if ( not patterns[index].empty() )
+            {
+                m_Entries.push_back({ GetKey(patterns[index].data(), GetPrefixLength(patterns[index].size())), index });
+            }
+        }
+
+        const auto prefix_length = [&patterns](const Entry& entry) noexcept { return GetPrefixLength(patterns[entry.m_Pattern].size()); };
+        std::sort(m_Entries.begin(), m_Entries.end(), [&prefix_length](const Entry& left, const Entry& right) { return std::tuple{ prefix_length(left), left.m_Key, left.m_Pattern } < std::tuple{ prefix_length(right), right.m_Key, right.m_Pattern }; });
+
+        constexpr std::byte ones[8]{ std::byte{ 0xFF }, std::byte{ 0xFF }, std::byte{ 0xFF }, std::byte{ 0xFF }, std::byte{ 0xFF }, std::byte{ 0xFF }, std::byte{ 0xFF }, std::byte{ 0xFF } };
+
+        for ( auto first = m_Entries.cbegin(); first != m_Entries.cend(); )
+        {
+            const std::size_t length = prefix_length(*first);
+            const auto        last   = std::find_if(first, m_Entries.cend(), [&prefix_length, length](const Entry& entry) { return prefix_length(entry) != length; });
+            std::size_t       keys   = 0;
+
+            for ( auto entry = first; entry != last; ++entry )
+            {
+                keys += (entry == first || entry->m_Key != std::prev(entry)->m_Key) ? 1 : 0;
+            }
+
+            const auto slot_bits = static_cast<std::uint32_t>(std::bit_width(2 * keys - 1));
+            const auto gate_bits = static_cast<std::uint32_t>(std::clamp<std::size_t>(std::bit_width(GateBitsPerKey * keys - 1), 6, MaxGateBits));
+
+            PrefixClass prefix_class{ length, GetKey(ones, length), m_Gates.size(), 64 - gate_bits, m_Slots.size(), (std::size_t{ 1 } << slot_bits) - 1, 64 - slot_bits, static_cast<std::size_t>(std::distance(m_Entries.cbegin(), last)) };
+
+            m_Gates.resize(m_Gates.size() + (std::size_t{ 1 } << gate_bits) / 64, 0);
+            m_Slots.resize(m_Slots.size() + prefix_class.m_SlotMask + 1, Slot{ 0, None });
+
+            for ( auto entry = first; entry != last; ++entry )
+            {
+                if ( entry != first && entry->m_Key == std::prev(entry)->m_Key )
+                {
+                    continue; //!< Not the first entry of its key.
+                }
+
+                const std::uint64_t hash = entry->m_Key * Mix;
+                const auto          bit  = static_cast<std::size_t>(hash >> prefix_class.m_GateShift);
+                auto                slot = static_cast<std::size_t>(hash >> prefix_class.m_SlotShift);
+
+                m_Gates[prefix_class.m_Gate + bit / 64] |= std::uint64_t{ 1 } << (bit % 64);
+
+                while ( m_Slots[prefix_class.m_Slots + slot].m_First != None )
+                {
+                    slot = (slot + 1) & prefix_class.m_SlotMask; //!< Linear probing
+                }
+
+                m_Slots[prefix_class.m_Slots + slot] = Slot{ entry->m_Key, static_cast<std::size_t>(std::distance(m_Entries.cbegin(), entry)) };
+            }
+
+            m_Classes.push_back(prefix_class);
+            first = last;
+        }
+    }
+
+    /**
+     * @brief Get the number of patterns in the set.
+     * @return The number of patterns, empty patterns included.
+     */
+    std::size_t RabinKarpPatternSet::GetPatternCount() const noexcept
+    {
+        return m_Patterns.size();
+    }
+
+    /**
+     * @brief Read up to 8 bytes as a key.
+     * @param data The bytes.
+     * @param size The number of bytes, at most 8.
+     * @return The bytes in memory order, the others zero: masking an 8-byte window with the key of 0xFF bytes gives the same key.
+     */
+    std::uint64_t RabinKarpPatternSet::GetKey(const std::byte* data, const std::size_t size) noexcept
+    {
+        std::uint64_t key = 0;
+        std::memcpy(&key, data, size);
+        return key;
+    }
+
+    /**
+     * @brief Verify the patterns of a key hit at an offset.
+     * @param prefix_class The class of the key.
+     * @param first The first entry of the key.
+     * @param source The source data to search in.
+     * @param offset The offset of the key.
+     * @param verified Called with the index of every pattern that occurs at the offset, by increasing index.
+     * @note The prefix bytes are equal already: only the rest of every pattern is compared.
+     */
+    template<typename TVerified>
+    void RabinKarpPatternSet::Verify(const PrefixClass& prefix_class, const std::size_t first, const std::span<const std::byte> source, const std::size_t offset, TVerified&& verified) const noexcept
+    {
+        const std::size_t length    = prefix_class.m_Length;
+        const std::size_t remaining = source.size() - offset;
+
+        for ( std::size_t entry = first; entry < prefix_class.m_Entries && m_Entries[entry].m_Key == m_Entries[first].m_Key; ++entry )
+        {
+            const auto pattern = m_Patterns[m_Entries[entry].m_Pattern];
+
+            if ( pattern.size() <= remaining && std::memcmp(pattern.data() + length, source.data() + offset + length, pattern.size() - length) == 0 )
+            {
+                verified(m_Entries[entry].m_Pattern);
+            }
+        }
+    }
+
+    /**
+     * @brief Pass every verified match to a visitor, by increasing offset.
+     * @param source The source data to search in.
+     * @param visit Called with the offset and the index of every pattern that occurs there; returns true to stop after the offset.
+     * @note The 8 bytes at every offset are read once. Every class masks its key out of them and tests its bitmap, and
+     * only probes its table if the key passed.
+     */
+    template<typename TVisit>
+    void RabinKarpPatternSet::Scan(const std::span<const std::byte> source, TVisit&& visit) const noexcept
+    {
+        if ( m_Classes.empty() || m_Classes.front().m_Length > source.size() )
+        {
+            return;
+        }
+
+        const std::size_t end = source.size() - m_Classes.front().m_Length + 1;
+
+        for ( std::size_t offset = 0; offset < end; ++offset )
+        {
+            const std::size_t   remaining = source.size() - offset;
+            const std::uint64_t window    = GetKey(source.data() + offset, std::min<std::size_t>(remaining, 8));
+            bool                stop      = false;
+
+            for ( const PrefixClass& prefix_class : m_Classes )
+            {
+                if ( prefix_class.m_Length > remaining )
+                {
+                    break; //!< The classes are sorted by prefix length.
+                }
+
+                const std::uint64_t key  = window & prefix_class.m_Mask;
+                const std::uint64_t hash = key * Mix;
+                const auto          bit  = static_cast<std::size_t>(hash >> prefix_class.m_GateShift);
+
+                if ( ((m_Gates[prefix_class.m_Gate + bit / 64] >> (bit % 64)) & 1) == 0 )
+                {
+                    continue; //!< Almost always: no key of the class hashes there.
+                }
+
+                for ( auto slot = static_cast<std::size_t>(hash >> prefix_class.m_SlotShift); m_Slots[prefix_class.m_Slots + slot].m_First != None; slot = (slot + 1) & prefix_class.m_SlotMask )
+                {
+                    if ( m_Slots[prefix_class.m_Slots + slot].m_Key == key )
+                    {
+                        Verify(prefix_class, m_Slots[prefix_class.m_Slots + slot].m_First, source, offset, [&stop, &visit, offset](const std::size_t pattern) noexcept { stop = visit(offset, pattern) || stop; });
+                        break;
+                    }
+                }
+            }
+
+            if ( stop )
+            {
+                return;
+            }
+        }
+    }
+
+    /**
+     * @brief Search for every pattern of the set in a given source data.
+     * @param source The source data to search in.
+     * @return The leftmost match; among matches at the same offset, the one with the lowest pattern index.
+     */
+    std::optional<PatternMatch> RabinKarpPatternSet::Search(const std::span<const std::byte> source) const noexcept
+    {
+        std::optional<PatternMatch> result;
+
+        Scan(source,
+             [&result](const std::size_t offset, const std::size_t pattern) noexcept
+             {
+                 if ( not result || pattern < result->pattern )
+                 {
+                     result = PatternMatch{ pattern, offset };
+                 }
+
+                 return true;
+             });
+
+        return result;
+    }
+
+    /**
+     * @brief Check if any pattern of the set occurs in a given source data.
+     * @param source The source data to search in.
+     * @return True if Search would find a match.
+     */
+    bool RabinKarpPatternSet::Contains(const std::span<const std::byte> source) const noexcept
+    {
+        bool found = false;
+        Scan(source, [&found](const std::size_t, const std::size_t) noexcept { return found = true; });
+        return found;
+    }
+
+    /**
+     * @brief Find every pattern of the set that occurs in a given source data.
+     * @param source The source data to search in.
+     * @param matches The cleared bitset of the patterns.
+     */
+    void RabinKarpPatternSet::Match(const std::span<const std::byte> source, const std::span<std::uint64_t> matches) const noexcept
+    {
+        Scan(source,
+             [&matches](const std::size_t, const std::size_t pattern) noexcept
+             {
+                 matches[pattern / 64] |= std::uint64_t{ 1 } << (pattern % 64);
+                 return false;
+             });
+    }
+} // namespace Program::Module::Internal
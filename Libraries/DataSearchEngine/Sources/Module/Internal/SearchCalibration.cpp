@@ -0,0 +1,249 @@
+#include "Module/Internal/SearchCalibration.hpp"
+#include <algorithm>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace Program::Module::Internal
+{
+    namespace
+    {
+        constexpr std::array<std::size_t, SearchCalibration::PatternBuckets> PatternSizes  = { 1, 2, 4, 8, 16, 32, 64, 128 }; //!< Measured length of every pattern bucket
+        constexpr std::array<std::size_t, SearchCalibration::SourceBuckets>  SourceSizes   = { 100, 4096, 32768 };            //!< Measured length of every source bucket
+        constexpr std::array<std::byte, 4>                                   LowAlphabet   = { std::byte{ 'A' }, std::byte{ 'C' }, std::byte{ 'G' }, std::byte{ 'T' } };
+        constexpr std::size_t                                                BytesPerRun   = 16384; //!< Source bytes searched per measurement
+        constexpr std::size_t                                                Trials        = 2;     //!< Measurements per strategy; the fastest one counts
+        constexpr std::size_t                                                EntropySample = 256;   //!< Leading pattern bytes the entropy is estimated from
+
+        /**
+         * @brief Fill a buffer with deterministic bytes.
+         * @param buffer The buffer.
+         * @param low_entropy Whether the bytes come from a 4-letter alphabet.
+         * @param state The SplitMix64 state.
+         */
+        void FillCalibrationBytes(std::vector<std::byte>& buffer, const bool low_entropy, std::uint64_t& state) noexcept
+        {
+            for ( std::byte& value : buffer )
+            {
+                std::uint64_t z = (state += 0x9E3779B97F4A7C15);
+                z               = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+                z               = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+                z               = z ^ (z >> 31);
+                value           = low_entropy ? LowAlphabet[z & 3] : static_cast<std::byte>(z);
+            }
+        }
+
+        /**
+         * @brief Time a strategy.
+         * @param strategy The strategy.
+         * @param tier The instruction set tier.
+         * @param source The source.
+         * @param pattern The pattern.
+         * @param prepared Whether the preprocessing is left out of the measurement.
+         * @return The best time of the trials.
+         */
+        std::chrono::nanoseconds MeasureStrategy(const SearchStrategy strategy, const Helpers::cpu_tier tier, const std::span<const std::byte> source, const std::span<const std::byte> pattern, const bool prepared) noexcept
+        {
+            const std::size_t        runs   = std::max<std::size_t>(1, BytesPerRun / source.size());
+            const StrategySearcher   shared{ strategy, tier, pattern };
+            std::chrono::nanoseconds best   = std::chrono::nanoseconds::max();
+            volatile std::size_t     sink   = 0; //!< Keeps the searches from being optimized away
+
+            for ( std::size_t trial = 0; trial < Trials; ++trial )
+            {
+                const auto start = std::chrono::steady_clock::now();
+
+                for ( std::size_t run = 0; run < runs; ++run )
+                {
+                    const auto result = prepared ? shared.Search(source) : StrategySearcher{ strategy, tier, pattern }.Search(source);
+                    sink              = sink + result.value_or(0);
+                }
+
+                best = std::min(best, std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start));
+            }
+
+            return best;
+        }
+
+        /**
+         * @brief Find the fastest strategy.
+         * @return The strategy with the best time; Simd on ties.
+         */
+        SearchStrategy GetFastestStrategy(const Helpers::cpu_tier tier, const std::span<const std::byte> source, const std::span<const std::byte> pattern, const bool prepared) noexcept
+        {
+            SearchStrategy           fastest = SearchStrategy::Simd;
+            std::chrono::nanoseconds best    = std::chrono::nanoseconds::max();
+
+            for ( std::size_t index = 0; index < SearchStrategyCount; ++index )
+            {
+                const auto strategy = static_cast<SearchStrategy>(index);
+                const auto time     = MeasureStrategy(strategy, tier, source, pattern, prepared);
+
+                if ( time < best )
+                {
+                    fastest = strategy;
+                    best    = time;
+                }
+            }
+
+            return fastest;
+        }
+
+        /**
+         * @brief The calibration of a tier, run on first use.
+         */
+        template<Helpers::cpu_tier Tier>
+        const SearchCalibration& GetTierCalibration() noexcept
+        {
+            static const SearchCalibration calibration{ Tier };
+            return calibration;
+        }
+    } // namespace
+
+    /**
+     * @brief Run the calibration.
+     * @param tier The instruction set tier of the Simd strategy.
+     * @note The pattern is the tail of the source, so every strategy scans the whole source unless an earlier occurrence exists.
+     */
+    SearchCalibration::SearchCalibration(const Helpers::cpu_tier tier) noexcept
+        : m_Single{}
+        , m_Prepared{}
+    {
+        std::uint64_t          state = 0x5EA4C4CA11B4A7E5; //!< Fixed seed: the data does not depend on the run
+        std::vector<std::byte> source;
+
+        for ( const bool low_entropy : { false, true } )
+        {
+            for ( std::size_t source_bucket = 0; source_bucket < SourceBuckets; ++source_bucket )
+            {
+                source.resize(SourceSizes[source_bucket]);
+                FillCalibrationBytes(source, low_entropy, state);
+
+                for ( std::size_t pattern_bucket = 0; pattern_bucket < PatternBuckets; ++pattern_bucket )
+                {
+                    const std::size_t cell = GetCell(pattern_bucket, source_bucket, low_entropy);
+
+                    if ( PatternSizes[pattern_bucket] > source.size() )
+                    {
+                        m_Single[cell] = m_Prepared[cell] = SearchStrategy::Simd; //!< Never searched: the pattern cannot fit.
+                        continue;
+                    }
+
+                    const std::span<const std::byte> pattern{ source.data() + source.size() - PatternSizes[pattern_bucket], PatternSizes[pattern_bucket] };
+
+                    m_Single[cell]   = GetFastestStrategy(tier, source, pattern, false);
+                    m_Prepared[cell] = GetFastestStrategy(tier, source, pattern, true);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Get the calibration of a tier.
+     * @param tier The instruction set tier.
+     * @return The calibration, run on the first call for the tier.
+     */
+    const SearchCalibration& SearchCalibration::Get(const Helpers::cpu_tier tier) noexcept
+    {
+        switch ( tier )
+        {
+            case Helpers::cpu_tier::sse2:
+                return GetTierCalibration<Helpers::cpu_tier::sse2>();
+
+            case Helpers::cpu_tier::avx2:
+                return GetTierCalibration<Helpers::cpu_tier::avx2>();
+
+            case Helpers::cpu_tier::avx512:
+                return GetTierCalibration<Helpers::cpu_tier::avx512>();
+
+            case Helpers::cpu_tier::scalar:
+            default:
+                return GetTierCalibration<Helpers::cpu_tier::scalar>();
+        }
+    }
+
+    /**
+     * @brief Select the fastest strategy.
+     * @param pattern The pattern.
+     * @param source_bucket The length bucket of the source.
+     * @param prepared Whether the preprocessing is paid once for many searches.
+     * @return The strategy measured fastest for the cell.
+     */
+    SearchStrategy SearchCalibration::Select(const std::span<const std::byte> pattern, const std::size_t source_bucket, const bool prepared) const noexcept
+    {
+        const table_type&    table  = prepared ? m_Prepared : m_Single;
+        const std::size_t    bucket = GetPatternBucket(pattern.size());
+        const SearchStrategy high   = table[GetCell(bucket, source_bucket, false)];
+        const SearchStrategy low    = table[GetCell(bucket, source_bucket, true)];
+        return high == low || not IsLowEntropy(pattern) ? high : low;
+    }
+
+    /**
+     * @brief Get the length bucket of a pattern.
+     * @return 0 for 1 byte, 1 for 2 bytes, 2 for 3-4 bytes... 7 for more than 64 bytes.
+     */
+    std::size_t SearchCalibration::GetPatternBucket(const std::size_t pattern_size) noexcept
+    {
+        return pattern_size <= 1 ? 0 : std::min<std::size_t>(std::bit_width(pattern_size - 1), PatternBuckets - 1);
+    }
+
+    /**
+     * @brief Get the length bucket of a source.
+     * @return 0 up to 256 bytes, 1 up to 8 KiB, 2 for longer sources.
+     */
+    std::size_t SearchCalibration::GetSourceBucket(const std::size_t source_size) noexcept
+    {
+        return source_size <= 256 ? 0 : source_size <= 8192 ? 1 : 2;
+    }
+
+    /**
+     * @brief Check if a pattern has low byte entropy.
+     * @param pattern The pattern.
+     * @return True if the Shannon entropy of its bytes is under 3/4 of the maximum for its length.
+     */
+    bool SearchCalibration::IsLowEntropy(const std::span<const std::byte> pattern) noexcept
+    {
+        if ( pattern.size() < 4 )
+        {
+            return false;
+        }
+
+        // H = log2(n) - sum(c * log2(c)) / n over the byte counts c. The sum is kept up to date while counting, with the
+        // increments c * log2(c) - (c - 1) * log2(c - 1) read from a table, so no logarithm is taken per call.
+        static const std::array<float, EntropySample + 1> increments = []() noexcept
+        {
+            std::array<float, EntropySample + 1> table{};
+
+            for ( std::size_t count = 2; count < table.size(); ++count )
+            {
+                table[count] = static_cast<float>(count * std::log2(count) - (count - 1) * std::log2(count - 1));
+            }
+
+            return table;
+        }();
+
+        const auto                     sample = pattern.first(std::min(pattern.size(), EntropySample));
+        std::array<std::uint16_t, 256> counts{};
+        float                          sum = 0.0f;
+
+        for ( const std::byte value : sample )
+        {
+            sum += increments[++counts[std::to_integer<std::size_t>(value)]];
+        }
+
+        const float size    = static_cast<float>(sample.size());
+        const float maximum = std::log2(size);
+        return maximum - sum / size < 0.75f * maximum;
+    }
+
+    /**
+     * @brief Index of a cell.
+     * @return The index in the tables.
+     */
+    std::size_t SearchCalibration::GetCell(const std::size_t pattern_bucket, const std::size_t source_bucket, const bool low_entropy) noexcept
+    {
+        return (static_cast<std::size_t>(low_entropy) * SourceBuckets + source_bucket) * PatternBuckets + pattern_bucket;
+    }
+} // namespace Program::Module::Internal
@@ -0,0 +1,149 @@
+#include "Module/Internal/ShiftAndPattern.hpp"
+#include <algorithm>
+#include <array>
+
+namespace
+{
+    /**
+     * @brief Run the Shift-And states over a source.
+     * @tparam Words The words per state, or 0 when only known at run time.
+     * @param source The source sequence.
+     * @param masks The masks of the pattern.
+     * @param states The zeroed states, one after the other.
+     * @param words The words per state.
+     * @param levels The number of states, the maximum number of substitutions plus one.
+     * @param length The length of the pattern.
+     * @return The leftmost window within the maximum number of substitutions, or std::nullopt if there is none.
+     * @note The states are updated from the last one down, and every state from its last word down, so the previous state and
+     * the lower words still hold the values of the previous byte.
+     */
+    template<std::size_t Words>
+    std::optional<Program::Module::ApproximateMatch> SearchStates(const std::span<const std::byte> source, const std::uint64_t* masks, std::uint64_t* states, const std::size_t words, const std::size_t levels, const std::size_t length) noexcept
+    {
+        const std::size_t   count = Words > 0 ? Words : words;
+        const std::uint64_t found = std::uint64_t{ 1 } << ((length - 1) % 64);
+
+        for ( std::size_t position = 0; position < source.size(); ++position )
+        {
+            const std::uint64_t* mask = masks + std::to_integer<std::size_t>(source[position]) * count;
+
+            for ( std::size_t level = levels - 1; level > 0; --level )
+            {
+                std::uint64_t*       state    = states + level * count;
+                const std::uint64_t* previous = state - count;
+
+                for ( std::size_t word = count; word-- > 0; )
+                {
+                    const std::uint64_t match      = ((state[word] << 1) | (word > 0 ? state[word - 1] >> 63 : 1)) & mask[word];
+                    const std::uint64_t substitute = (previous[word] << 1) | (word > 0 ? previous[word - 1] >> 63 : 1);
+                    state[word]                    = match | substitute;
+                }
+            }
+
+            for ( std::size_t word = count; word-- > 0; )
+            {
+                states[word] = ((states[word] << 1) | (word > 0 ? states[word - 1] >> 63 : 1)) & mask[word];
+            }
+
+            if ( states[levels * count - 1] & found )
+            {
+                std::size_t distance = 0;
+
+                while ( not (states[distance * count + count - 1] & found) )
+                {
+                    ++distance;
+                }
+
+                return Program::Module::ApproximateMatch{ position + 1 - length, length, distance };
+            }
+        }
+
+        return std::nullopt;
+    }
+} // namespace
+
+/**
+ * @brief Compile a pattern.
+ * @param values_to_search The sequence of bytes to search for.
+ * @param max_distance The largest number of substitutions.
+ */
+Program::Module::Internal::ShiftAndPattern::ShiftAndPattern(const std::span<const std::byte> values_to_search, const std::size_t max_distance) noexcept
+    : m_Pattern{ values_to_search.begin(), values_to_search.end() }
+    , m_MaxDistance{ std::min(max_distance, values_to_search.size()) }
+    , m_Words{ (values_to_search.size() + 63) / 64 }
+    , m_Masks(256 * m_Words)
+{
+    for ( std::size_t index = 0; index < m_Pattern.size(); ++index )
+    {
+        m_Masks[std::to_integer<std::size_t>(m_Pattern[index]) * m_Words + index / 64] |= std::uint64_t{ 1 } << (index % 64);
+    }
+}
+
+/**
+ * @brief Get the pattern.
+ * @return The sequence of bytes to search for.
+ */
+const std::vector<std::byte>& Program::Module::Internal::ShiftAndPattern::GetPattern() const noexcept
+{
+    return m_Pattern;
+}
+
+/**
+ * @brief Get the metric.
+ * @return ApproximateMetric::Hamming.
+ */
+Program::Module::ApproximateMetric Program::Module::Internal::ShiftAndPattern::GetMetric() const noexcept
+{
+    return ApproximateMetric::Hamming;
+}
+
+/**
+ * @brief Get the maximum distance.
+ * @return The largest number of substitutions.
+ */
+std::size_t Program::Module::Internal::ShiftAndPattern::GetMaxDistance() const noexcept
+{
+    return m_MaxDistance;
+}
+
+/**
+ * @brief Search for the pattern in a source sequence.
+ * @param source The source sequence.
+ * @return The leftmost window within the maximum number of substitutions, or std::nullopt if there is none.
+ * @note One and two word states, the patterns of up to 128 bytes, get kernels with the word count known at compile time.
+ */
+std::optional<Program::Module::ApproximateMatch> Program::Module::Internal::ShiftAndPattern::Search(const std::span<const std::byte> source) const noexcept
+{
+    const std::size_t length = m_Pattern.size();
+
+    if ( length == 0 || source.size() < length )
+    {
+        return std::nullopt;
+    }
+
+    const std::size_t levels = m_MaxDistance + 1;
+
+    std::array<std::uint64_t, StackWords> stack_states;
+    std::vector<std::uint64_t>            heap_states;
+    std::uint64_t*                        states = stack_states.data();
+
+    if ( levels * m_Words > StackWords )
+    {
+        heap_states.resize(levels * m_Words);
+        states = heap_states.data();
+    }
+
+    std::fill_n(states, levels * m_Words, 0);
+
+    switch ( m_Words )
+    {
+        case 1:
+            return SearchStates<1>(source, m_Masks.data(), states, m_Words, levels, length);
+
+        case 2:
+            return SearchStates<2>(source, m_Masks.data(), states, m_Words, levels, length);
+
+        default:
+            return SearchStates<0>(source, m_Masks.data(), states, m_Words, levels, length);
+    }
+}
@@ -0,0 +1,43 @@
+#include "Module/Internal/SimdPattern.hpp"
+
+/**
+ * @brief Compile a pattern.
+ * @param values_to_search The sequence of bytes to search for.
+ * @param kernel The search kernel.
+ */
+Program::Module::Internal::SimdPattern::SimdPattern(const std::vector<std::byte>& values_to_search, const SimdSearchKernel kernel) noexcept
+    : m_Pattern{ values_to_search }
+    , m_Kernel{ kernel }
+{
+}
+
+/**
+ * @brief Get the pattern.
+ * @return The sequence of bytes to search for.
+ */
+const std::vector<std::byte>& Program::Module::Internal::SimdPattern::GetPattern() const noexcept
+{
+    return m_Pattern;
+}
+
+/**
+ * @brief Search for the pattern in a source sequence.
+ * @param source The source sequence.
+ * @return The index of the first occurrence of the pattern in the source sequence, or std::nullopt if the pattern is not found.
+ */
+std::optional<int32_t> Program::Module::Internal::SimdPattern::Search(const std::vector<std::byte>& source) const noexcept
+{
+    const auto result = m_Kernel(source.data(), source.size(), m_Pattern.data(), m_Pattern.size());
+    return result ? std::optional{ static_cast<int32_t>(*result) } : std::nullopt;
+}
+
+/**
+ * @brief Search for the pattern in a source sequence, without copies.
+ * @param source The source sequence.
+ * @return The 64-bit offset of the first occurrence of the pattern in the source sequence, or std::nullopt if the pattern is not found.
+ */
+std::optional<std::uint64_t> Program::Module::Internal::SimdPattern::Search(const std::span<const std::byte> source) const noexcept
+{
+    const auto result = m_Kernel(source.data(), source.size(), m_Pattern.data(), m_Pattern.size());
+    return result ? std::optional{ static_cast<std::uint64_t>(*result) } : std::nullopt;
+}
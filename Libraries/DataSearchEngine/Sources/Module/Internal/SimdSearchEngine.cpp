@@ -0,0 +1,95 @@
+#include "Module/Internal/SimdSearchEngine.hpp"
+#include "Module/Internal/SimdPattern.hpp"
+#include "Module/Internal/MaskedPattern.hpp"
+#include "Module/Internal/SpanSearch.hpp"
+
+/**
+ * @brief Construct the engine.
+ * @param tier The instruction set tier of the kernels.
+ */
+Program::Module::Internal::SimdSearchEngine::SimdSearchEngine(const Helpers::cpu_tier tier) noexcept
+    : m_Tier{ tier }
+{
+}
+
+/**
+ * @brief Search for a sequence of bytes in a source sequence.
+ * @param source The source sequence.
+ * @param values_to_search The sequence of bytes to search for.
+ * @return The index of the first occurrence of the sequence of bytes in the source sequence, or std::nullopt if the sequence of bytes is not found.
+ */
+std::optional<int32_t> Program::Module::Internal::SimdSearchEngine::Search(const std::vector<std::byte>& source, const std::vector<std::byte>& values_to_search) const noexcept
+{
+    const auto result = Search(std::span<const std::byte>{ source }, std::span<const std::byte>{ values_to_search });
+    return result ? std::optional{ static_cast<int32_t>(*result) } : std::nullopt;
+}
+
+/**
+ * @brief Compile a sequence of bytes to search for.
+ * @param values_to_search The sequence of bytes to search for.
+ * @return The compiled pattern, bound to the kernel of its length bucket.
+ */
+std::shared_ptr<const Program::Module::ICompiledPattern> Program::Module::Internal::SimdSearchEngine::Compile(const std::vector<std::byte>& values_to_search) const noexcept
+{
+    return std::make_shared<SimdPattern>(values_to_search, GetSimdSearchKernel(m_Tier, values_to_search.size()));
+}
+
+/**
+ * @brief Compile a masked sequence of bytes to search for.
+ * @param values_to_search The masked bytes to search for.
+ * @return The masked pattern, bound to the kernels of the tier.
+ */
+std::shared_ptr<const Program::Module::ICompiledPattern> Program::Module::Internal::SimdSearchEngine::Compile(const std::vector<Helpers::masked_byte>& values_to_search) const noexcept
+{
+    return std::make_shared<MaskedPattern>(values_to_search, m_Tier);
+}
+
+/**
+ * @brief Search for a compiled pattern in a source sequence.
+ * @param source The source sequence.
+ * @param pattern The compiled pattern.
+ * @return The index of the first occurrence of the pattern in the source sequence, or std::nullopt if the pattern is not found.
+ */
+std::optional<int32_t> Program::Module::Internal::SimdSearchEngine::Search(const std::vector<std::byte>& source, const ICompiledPattern& pattern) const noexcept
+{
+    return pattern.Search(source);
+}
+
+/**
+ * @brief Search for a sequence of bytes in a source sequence, without copies.
+ * @param source The source sequence.
+ * @param values_to_search The sequence of bytes to search for.
+ * @return The 64-bit offset of the first occurrence of the sequence of bytes in the source sequence, or std::nullopt if the sequence of bytes is not found.
+ */
+std::optional<std::uint64_t> Program::Module::Internal::SimdSearchEngine::Search(const std::span<const std::byte> source, const std::span<const std::byte> values_to_search) const noexcept
+{
+    const auto kernel = GetSimdSearchKernel(m_Tier, values_to_search.size()); //!< Uncompiled patterns pick their length bucket on every call.
+    const auto result = kernel(source.data(), source.size(), values_to_search.data(), values_to_search.size());
+    return result ? std::optional{ static_cast<std::uint64_t>(*result) } : std::nullopt;
+}
+
+/**
+ * @brief Find every occurrence of a sequence of bytes in a source sequence.
+ * @param source The source sequence.
+ * @param values_to_search The sequence of bytes to search for.
+ * @param offsets The buffer of the offsets.
+ * @return The number of offsets written.
+ */
+std::size_t Program::Module::Internal::SimdSearchEngine::FindAll(const std::span<const std::byte> source, const std::span<const std::byte> values_to_search, const std::span<std::uint64_t> offsets) const noexcept
+{
+    const auto kernel = GetSimdSearchKernel(m_Tier, values_to_search.size());
+    return FindAllOffsets(source, values_to_search.size(), offsets, [kernel, values_to_search](const std::span<const std::byte> suffix) { return kernel(suffix.data(), suffix.size(), values_to_search.data(), values_to_search.size()); });
+}
+
+/**
+ * @brief Count the occurrences of a sequence of bytes in a source sequence.
+ * @param source The source sequence.
+ * @param values_to_search The sequence of bytes to search for.
+ * @param overlapping Whether an occurrence may start inside the previous one.
+ * @return The number of occurrences.
+ */
+std::uint64_t Program::Module::Internal::SimdSearchEngine::Count(const std::span<const std::byte> source, const std::span<const std::byte> values_to_search, const bool overlapping) const noexcept
+{
+    const auto kernel = GetSimdSearchKernel(m_Tier, values_to_search.size());
+    return CountOffsets(source, values_to_search.size(), overlapping, [kernel, values_to_search](const std::span<const std::byte> suffix) { return kernel(suffix.data(), suffix.size(), values_to_search.data(), values_to_search.size()); });
+}
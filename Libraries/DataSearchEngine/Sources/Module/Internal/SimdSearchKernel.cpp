@@ -0,0 +1,354 @@
+#include "Module/Internal/SimdSearchKernel.hpp"
+#include <array>
+#include <bit>
+#include <cstring>
+#include <type_traits>
+
+#if defined(__HELPER_CPU_FEATURES_X86__)
+ #include <immintrin.h>
+#endif
+
+namespace Program::Module::Internal
+{
+    namespace
+    {
+        constexpr std::size_t AnyLength = SIZE_MAX; //!< Word of the kernels for patterns longer than 32 bytes
+
+        /**
+         * @brief Load a fixed-size word, any alignment.
+         */
+        template<std::size_t Size>
+        inline auto LoadWord(const std::byte* data) noexcept
+        {
+            if constexpr ( Size == 16 )
+            {
+                std::array<std::uint64_t, 2> word;
+                std::memcpy(word.data(), data, Size);
+                return word;
+            }
+            else
+            {
+                std::conditional_t<Size == 2, std::uint16_t, std::conditional_t<Size == 4, std::uint32_t, std::uint64_t>> word;
+                std::memcpy(&word, data, Size);
+                return word;
+            }
+        }
+
+        /**
+         * @brief Whether the pattern occurs at a candidate position.
+         * @details The first and last bytes already matched. The length buckets compare the pattern as two overlapping words
+         * of Word bytes, the first and the last ones, which covers any length from Word + 1 to 2 * Word with two fixed-size compares.
+         * @tparam Word 0 for patterns of 2 bytes; 2, 4, 8 or 16 for the buckets up to 4, 8, 16 and 32 bytes; AnyLength otherwise.
+         */
+        template<std::size_t Word>
+        inline bool IsMatch(const std::byte* candidate, const std::byte* pattern, const std::size_t pattern_size) noexcept
+        {
+            if constexpr ( Word == 0 )
+            {
+                return true;
+            }
+            else if constexpr ( Word == AnyLength )
+            {
+                return std::memcmp(candidate + 1, pattern + 1, pattern_size - 2) == 0;
+            }
+            else
+            {
+                const std::size_t tail = pattern_size - Word;
+                return LoadWord<Word>(candidate) == LoadWord<Word>(pattern) && LoadWord<Word>(candidate + tail) == LoadWord<Word>(pattern + tail);
+            }
+        }
+
+        /**
+         * @brief Verify the candidates of one vector step, lowest position first.
+         * @param mask Bit i is set if position + i is a candidate.
+         */
+        template<std::size_t Word, typename TMask>
+        inline std::optional<std::size_t> VerifyCandidates(TMask mask, const std::byte* source, const std::size_t position, const std::byte* pattern, const std::size_t pattern_size) noexcept
+        {
+            while ( mask != 0 )
+            {
+                const auto offset = position + static_cast<std::size_t>(std::countr_zero(mask));
+
+                if ( IsMatch<Word>(source + offset, pattern, pattern_size) )
+                {
+                    return offset;
+                }
+
+                mask &= mask - 1; //!< Clear the lowest candidate.
+            }
+
+            return std::nullopt;
+        }
+
+        /**
+         * @brief Search the positions from position to the last one, one at a time.
+         * @details The scalar kernel, and the tail of the vector kernels.
+         */
+        template<std::size_t Word>
+        inline std::optional<std::size_t> SearchTail(const std::byte* source, const std::size_t source_size, const std::byte* pattern, const std::size_t pattern_size, std::size_t position) noexcept
+        {
+            const std::size_t last = pattern_size - 1;
+
+            for ( ; position + pattern_size <= source_size; ++position )
+            {
+                if ( source[position] == pattern[0] && source[position + last] == pattern[last] && IsMatch<Word>(source + position, pattern, pattern_size) )
+                {
+                    return position;
+                }
+            }
+
+            return std::nullopt;
+        }
+
+        /**
+         * @brief Whether the answer needs no scan: empty pattern, or pattern longer than the source.
+         */
+        inline bool IsTrivial(const std::size_t source_size, const std::size_t pattern_size) noexcept
+        {
+            return pattern_size == 0 || pattern_size > source_size;
+        }
+
+        /**
+         * @brief Single byte patterns, every tier: memchr is already vectorized by the C library.
+         */
+        std::optional<std::size_t> SearchByte(const std::byte* source, const std::size_t source_size, const std::byte* pattern, const std::size_t pattern_size) noexcept
+        {
+            if ( IsTrivial(source_size, pattern_size) )
+            {
+                return std::nullopt;
+            }
+
+            const void* found = std::memchr(source, std::to_integer<int32_t>(pattern[0]), source_size);
+            return found ? std::optional{ static_cast<std::size_t>(static_cast<const std::byte*>(found) - source) } : std::nullopt;
+        }
+
+        template<std::size_t Word>
+        std::optional<std::size_t> SearchScalar(const std::byte* source, const std::size_t source_size, const std::byte* pattern, const std::size_t pattern_size) noexcept
+        {
+            return IsTrivial(source_size, pattern_size) ? std::nullopt : SearchTail<Word>(source, source_size, pattern, pattern_size, 0);
+        }
+
+#if defined(__HELPER_CPU_FEATURES_X86__)
+        /**
+         * @brief 16 positions per step.
+         * @param position First position to search; advanced past the positions searched.
+         */
+        template<std::size_t Word>
+        HELPERS_TARGET_SSE2 inline std::optional<std::size_t> SearchSse2Steps(const std::byte* source, const std::size_t source_size, const std::byte* pattern, const std::size_t pattern_size, std::size_t& position) noexcept
+        {
+            const std::size_t last       = pattern_size - 1;
+            const __m128i     first_byte = _mm_set1_epi8(std::to_integer<char>(pattern[0]));
+            const __m128i     last_byte  = _mm_set1_epi8(std::to_integer<char>(pattern[last]));
+
+            for ( ; position + 16 + last <= source_size; position += 16 )
+            {
+                const __m128i block_first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + position));
+                const __m128i block_last  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + position + last));
+                const __m128i matches     = _mm_and_si128(_mm_cmpeq_epi8(block_first, first_byte), _mm_cmpeq_epi8(block_last, last_byte));
+                const auto    mask        = static_cast<std::uint32_t>(_mm_movemask_epi8(matches));
+
+                if ( const auto result = VerifyCandidates<Word>(mask, source, position, pattern, pattern_size) )
+                {
+                    return result;
+                }
+            }
+
+            return std::nullopt;
+        }
+
+        /**
+         * @brief 32 positions per step.
+         * @param position First position to search; advanced past the positions searched.
+         */
+        template<std::size_t Word>
+        HELPERS_TARGET_AVX2 inline std::optional<std::size_t> SearchAvx2Steps(const std::byte* source, const std::size_t source_size, const std::byte* pattern, const std::size_t pattern_size, std::size_t& position) noexcept
+        {
+            const std::size_t last       = pattern_size - 1;
+            const __m256i     first_byte = _mm256_set1_epi8(std::to_integer<char>(pattern[0]));
+            const __m256i     last_byte  = _mm256_set1_epi8(std::to_integer<char>(pattern[last]));
+
+            for ( ; position + 32 + last <= source_size; position += 32 )
+            {
+                const __m256i block_first = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + position));
+                const __m256i block_last  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + position + last));
+                const __m256i matches     = _mm256_and_si256(_mm256_cmpeq_epi8(block_first, first_byte), _mm256_cmpeq_epi8(block_last, last_byte));
+                const auto    mask        = static_cast<std::uint32_t>(_mm256_movemask_epi8(matches));
+
+                if ( const auto result = VerifyCandidates<Word>(mask, source, position, pattern, pattern_size) )
+                {
+                    return result;
+                }
+            }
+
+            return std::nullopt;
+        }
+
+        /**
+         * @brief 64 positions per step.
+         * @param position First position to search; advanced past the positions searched.
+         */
+        template<std::size_t Word>
+        HELPERS_TARGET_AVX512 inline std::optional<std::size_t> SearchAvx512Steps(const std::byte* source, const std::size_t source_size, const std::byte* pattern, const std::size_t pattern_size, std::size_t& position) noexcept
+        {
+            const std::size_t last       = pattern_size - 1;
+            const __m512i     first_byte = _mm512_set1_epi8(std::to_integer<char>(pattern[0]));
+            const __m512i     last_byte  = _mm512_set1_epi8(std::to_integer<char>(pattern[last]));
+
+            for ( ; position + 64 + last <= source_size; position += 64 )
+            {
+                const __m512i   block_first = _mm512_loadu_si512(source + position);
+                const __m512i   block_last  = _mm512_loadu_si512(source + position + last);
+                const __mmask64 mask        = _mm512_cmpeq_epi8_mask(block_first, first_byte) & _mm512_cmpeq_epi8_mask(block_last, last_byte);
+
+                if ( const auto result = VerifyCandidates<Word>(static_cast<std::uint64_t>(mask), source, position, pattern, pattern_size) )
+                {
+                    return result;
+                }
+            }
+
+            return std::nullopt;
+        }
+
+        template<std::size_t Word>
+        HELPERS_TARGET_SSE2 std::optional<std::size_t> SearchSse2(const std::byte* source, const std::size_t source_size, const std::byte* pattern, const std::size_t pattern_size) noexcept
+        {
+            std::optional<std::size_t> result;
+            std::size_t                position = 0;
+
+            if ( IsTrivial(source_size, pattern_size) || (result = SearchSse2Steps<Word>(source, source_size, pattern, pattern_size, position)) )
+            {
+                return result;
+            }
+
+            return SearchTail<Word>(source, source_size, pattern, pattern_size, position);
+        }
+
+        template<std::size_t Word>
+        HELPERS_TARGET_AVX2 std::optional<std::size_t> SearchAvx2(const std::byte* source, const std::size_t source_size, const std::byte* pattern, const std::size_t pattern_size) noexcept
+        {
+            std::optional<std::size_t> result;
+            std::size_t                position = 0;
+
+            if ( IsTrivial(source_size, pattern_size) || (result = SearchAvx2Steps<Word>(source, source_size, pattern, pattern_size, position)) || (result = SearchSse2Steps<Word>(source, source_size, pattern, pattern_size, position)) )
+            {
+                return result;
+            }
+
+            return SearchTail<Word>(source, source_size, pattern, pattern_size, position);
+        }
+
+        template<std::size_t Word>
+        HELPERS_TARGET_AVX512 std::optional<std::size_t> SearchAvx512(const std::byte* source, const std::size_t source_size, const std::byte* pattern, const std::size_t pattern_size) noexcept
+        {
+            std::optional<std::size_t> result;
+            std::size_t                position = 0;
+
+            if ( IsTrivial(source_size, pattern_size) || (result = SearchAvx512Steps<Word>(source, source_size, pattern, pattern_size, position)) || (result = SearchAvx2Steps<Word>(source, source_size, pattern, pattern_size, position)) || (result = SearchSse2Steps<Word>(source, source_size, pattern, pattern_size, position)) )
+            {
+                return result;
+            }
+
+            return SearchTail<Word>(source, source_size, pattern, pattern_size, position);
+        }
+#endif
+
+        /**
+         * @brief Kernels of one tier: one per length bucket (1, 2, 3-4, 5-8, 9-16, 17-32, longer), then the any-length kernel.
+         */
+        using KernelTable = std::array<SimdSearchKernel, 8>;
+
+        /**
+         * @brief Build the kernel table of a tier.
+         * @tparam TKernel The kernel of the tier, instantiated once per bucket.
+         */
+        template<template<std::size_t> typename TKernel>
+        constexpr KernelTable MakeKernelTable() noexcept
+        {
+            // The any-length kernel cannot know the length in advance: single bytes are sent to memchr on every call.
+            constexpr SimdSearchKernel any_length = [](const std::byte* source, const std::size_t source_size, const std::byte* pattern, const std::size_t pattern_size) noexcept
+            {
+                return pattern_size == 1 ? SearchByte(source, source_size, pattern, pattern_size) : TKernel<AnyLength>::Search(source, source_size, pattern, pattern_size);
+            };
+
+            return { &SearchByte, TKernel<0>::Search, TKernel<2>::Search, TKernel<4>::Search, TKernel<8>::Search, TKernel<16>::Search, TKernel<AnyLength>::Search, any_length };
+        }
+
+        template<std::size_t Word>
+        struct ScalarKernel
+        {
+            static constexpr SimdSearchKernel Search = &SearchScalar<Word>;
+        };
+
+#if defined(__HELPER_CPU_FEATURES_X86__)
+        template<std::size_t Word>
+        struct Sse2Kernel
+        {
+            static constexpr SimdSearchKernel Search = &SearchSse2<Word>;
+        };
+
+        template<std::size_t Word>
+        struct Avx2Kernel
+        {
+            static constexpr SimdSearchKernel Search = &SearchAvx2<Word>;
+        };
+
+        template<std::size_t Word>
+        struct Avx512Kernel
+        {
+            static constexpr SimdSearchKernel Search = &SearchAvx512<Word>;
+        };
+#endif
+
+        /**
+         * @brief Get the kernel table of a tier.
+         */
+        const KernelTable& GetKernelTable(const Helpers::cpu_tier tier) noexcept
+        {
+            static constexpr KernelTable scalar_kernels = MakeKernelTable<ScalarKernel>();
+#if defined(__HELPER_CPU_FEATURES_X86__)
+            static constexpr KernelTable sse2_kernels   = MakeKernelTable<Sse2Kernel>();
+            static constexpr KernelTable avx2_kernels   = MakeKernelTable<Avx2Kernel>();
+            static constexpr KernelTable avx512_kernels = MakeKernelTable<Avx512Kernel>();
+#endif
+
+            switch ( tier )
+            {
+#if defined(__HELPER_CPU_FEATURES_X86__)
+                case Helpers::cpu_tier::avx512:
+                    return avx512_kernels;
+
+                case Helpers::cpu_tier::avx2:
+                    return avx2_kernels;
+
+                case Helpers::cpu_tier::sse2:
+                    return sse2_kernels;
+#endif
+
+                case Helpers::cpu_tier::scalar:
+                default:
+                    return scalar_kernels;
+            }
+        }
+    } // namespace
+
+    SimdSearchKernel GetSimdSearchKernel(const Helpers::cpu_tier tier) noexcept
+    {
+        return GetKernelTable(tier).back();
+    }
+
+    SimdSearchKernel GetSimdSearchKernel(const Helpers::cpu_tier tier, const std::size_t pattern_size) noexcept
+    {
+        std::size_t bucket = 6; //!< Longer than 32 bytes.
+
+        if ( pattern_size <= 1 )
+        {
+            bucket = 0; //!< The empty pattern never matches, memchr answers it as well as any other kernel.
+        }
+        else if ( pattern_size <= 32 )
+        {
+            bucket = static_cast<std::size_t>(std::bit_width(pattern_size - 1)); //!< 2 -> 1, 3-4 -> 2, 5-8 -> 3, 9-16 -> 4, 17-32 -> 5
+        }
+
+        return GetKernelTable(tier)[bucket];
+    }
+} // namespace Program::Module::Internal
@@ -0,0 +1,95 @@
+#include "Module/Internal/StrategySearcher.hpp"
+#include <algorithm>
+
+namespace Program::Module::Internal
+{
+    namespace
+    {
+        /**
+         * @brief Offset of the first match of a standard searcher.
+         * @param source The source data to search in.
+         * @param searcher The standard searcher.
+         * @return The offset, or an empty optional if not found.
+         */
+        template<typename TSearcher>
+        inline std::optional<std::size_t> SearchWith(const std::span<const std::byte> source, const TSearcher& searcher) noexcept
+        {
+            const auto iterator_result = std::search(source.begin(), source.end(), searcher);
+
+            if ( iterator_result == source.end() )
+            {
+                return std::nullopt;
+            }
+
+            return static_cast<std::size_t>(std::distance(source.begin(), iterator_result));
+        }
+    } // namespace
+
+    /**
+     * @brief Build the preprocessing of a strategy.
+     * @param strategy The search algorithm.
+     * @param tier The instruction set tier of the Simd strategy.
+     * @param pattern The data to search for.
+     */
+    StrategySearcher::StrategySearcher(const SearchStrategy strategy, const Helpers::cpu_tier tier, const std::span<const std::byte> pattern) noexcept
+        : m_Pattern{ pattern }
+        , m_Searcher{ MakeSearcher(strategy, tier, pattern) }
+    {
+    }
+
+    /**
+     * @brief Build the searcher of a strategy.
+     * @param strategy The search algorithm.
+     * @param tier The instruction set tier of the Simd strategy.
+     * @param pattern The data to search for.
+     * @return The searcher.
+     */
+    StrategySearcher::searcher_type StrategySearcher::MakeSearcher(const SearchStrategy strategy, const Helpers::cpu_tier tier, const std::span<const std::byte> pattern) noexcept
+    {
+        switch ( strategy )
+        {
+            case SearchStrategy::Horspool:
+                return horspool_type{ pattern.begin(), pattern.end() };
+
+            case SearchStrategy::BoyerMoore:
+                return boyer_moore_type{ pattern.begin(), pattern.end() };
+
+            case SearchStrategy::TwoWay:
+                return TwoWaySearcher{ pattern };
+
+            case SearchStrategy::Simd:
+            default:
+                return GetSimdSearchKernel(tier, pattern.size());
+        }
+    }
+
+    /**
+     * @brief Search for the pattern in a given source data.
+     * @param source The source data to search in.
+     * @return The offset of the first occurrence of the pattern, or an empty optional if not found or if the pattern is empty.
+     */
+    std::optional<std::size_t> StrategySearcher::Search(const std::span<const std::byte> source) const noexcept
+    {
+        if ( m_Pattern.empty() || m_Pattern.size() > source.size() )
+        {
+            return std::nullopt;
+        }
+
+        if ( const auto* kernel = std::get_if<SimdSearchKernel>(&m_Searcher) )
+        {
+            return (*kernel)(source.data(), source.size(), m_Pattern.data(), m_Pattern.size());
+        }
+
+        if ( const auto* searcher = std::get_if<horspool_type>(&m_Searcher) )
+        {
+            return SearchWith(source, *searcher);
+        }
+
+        if ( const auto* searcher = std::get_if<boyer_moore_type>(&m_Searcher) )
+        {
+            return SearchWith(source, *searcher);
+        }
+
+        return std::get<TwoWaySearcher>(m_Searcher).Search(source);
+    }
+} // namespace Program::Module::Internal
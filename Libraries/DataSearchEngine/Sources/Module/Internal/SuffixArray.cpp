@@ -0,0 +1,259 @@
+#include "Module/Internal/SuffixArray.hpp"
+#include <algorithm>
+#include <utility>
+
+namespace Program::Module::Internal
+{
+    namespace
+    {
+        /**
+         * @brief Get the end of the source of every position.
+         * @param offsets The source boundaries.
+         * @param size The number of positions.
+         * @return One end per position.
+         */
+        std::vector<std::uint64_t> GetSourceEnds(const std::span<const std::size_t> offsets, const std::size_t size) noexcept
+        {
+            std::vector<std::uint64_t> ends(size);
+
+            for ( std::size_t source = 0; source + 1 < offsets.size(); ++source )
+            {
+                std::fill(ends.begin() + static_cast<std::ptrdiff_t>(offsets[source]), ends.begin() + static_cast<std::ptrdiff_t>(offsets[source + 1]), offsets[source + 1]);
+            }
+
+            return ends;
+        }
+
+        /**
+         * @brief Stable counting sort of positions by key.
+         * @param input The positions to sort.
+         * @param output Receives the sorted positions.
+         * @param counts Scratch, one entry per key.
+         * @param key_of The key of a position, smaller than counts.size().
+         */
+        template<typename TKey>
+        void CountingSort(const std::vector<std::uint64_t>& input, std::vector<std::uint64_t>& output, std::vector<std::uint64_t>& counts, TKey&& key_of) noexcept
+        {
+            std::fill(counts.begin(), counts.end(), 0);
+
+            for ( const std::uint64_t position : input )
+            {
+                ++counts[key_of(position)];
+            }
+
+            std::uint64_t total = 0;
+
+            for ( std::uint64_t& count : counts )
+            {
+                total += std::exchange(count, total);
+            }
+
+            for ( const std::uint64_t position : input )
+            {
+                output[counts[key_of(position)]++] = position;
+            }
+        }
+    } // namespace
+
+    /**
+     * @brief Get a suffix, cut at the end of its source.
+     * @param values The sources.
+     * @param offsets The source boundaries.
+     * @param position The start of the suffix.
+     * @return The suffix.
+     */
+    std::span<const std::byte> GetSuffix(const std::span<const std::byte> values, const std::span<const std::size_t> offsets, const std::uint64_t position) noexcept
+    {
+        const std::size_t end = *std::upper_bound(offsets.begin(), offsets.end(), position);
+        return values.subspan(position, end - position);
+    }
+
+    /**
+     * @brief Build the suffix array and the LCP array of a set of sources.
+     * @param values The sources.
+     * @param offsets The source boundaries.
+     * @return The arrays.
+     * @note Round k sorts the suffixes by their first 2k bytes, as pairs of the ranks of their first k bytes and of the k bytes
+     * after; the second rank is 0, below every byte, past the end of the source. The input of every round is in position order
+     * and both sorts are stable, so equal suffixes stay sorted by position. The rounds stop once the suffixes that still tie
+     * are shorter than 2k, so equal as a whole: with short sources, the many equal tails would otherwise keep every suffix
+     * in the rounds up to the longest source.
+     */
+    SuffixArray BuildSuffixArray(const std::span<const std::byte> values, const std::span<const std::size_t> offsets) noexcept
+    {
+        const std::size_t size = values.size();
+        SuffixArray       result{ std::vector<std::uint64_t>(size), std::vector<std::uint64_t>(size, 0) };
+
+        if ( size == 0 )
+        {
+            return result;
+        }
+
+        const std::vector<std::uint64_t> ends = GetSourceEnds(offsets, size);
+        std::vector<std::uint64_t>       rank(size);
+        std::vector<std::uint64_t>       next_rank(size);
+        std::vector<std::uint64_t>       identity(size);
+        std::vector<std::uint64_t>       order(size);
+        std::vector<std::uint64_t>       counts(std::max<std::size_t>(257, size + 1));
+        std::vector<std::uint64_t>&      positions = result.m_Positions;
+        std::size_t                      longest   = 0;
+
+        for ( std::size_t source = 0; source + 1 < offsets.size(); ++source )
+        {
+            longest = std::max(longest, offsets[source + 1] - offsets[source]);
+        }
+
+        for ( std::size_t position = 0; position < size; ++position )
+        {
+            rank[position]     = std::to_integer<std::uint64_t>(values[position]) + 1;
+            identity[position] = position;
+        }
+
+        for ( std::size_t length = 1;; length *= 2 )
+        {
+            const auto first  = [&rank](const std::uint64_t position) noexcept { return rank[position]; };
+            const auto second = [&rank, &ends, length](const std::uint64_t position) noexcept { return position + length < ends[position] ? rank[position + length] : 0; };
+
+            CountingSort(identity, order, counts, second);
+            CountingSort(order, positions, counts, first);
+
+            std::uint64_t distinct = 0;
+            bool          sorted   = true; //!< Whether every tie is between whole, equal suffixes
+
+            for ( std::size_t index = 0; index < size; ++index )
+            {
+                const std::uint64_t position = positions[index];
+                const std::uint64_t previous = positions[index > 0 ? index - 1 : 0];
+
+                if ( index == 0 || first(position) != first(previous) || second(position) != second(previous) )
+                {
+                    ++distinct;
+                }
+                else if ( ends[position] - position >= 2 * length )
+                {
+                    sorted = false;
+                }
+
+                next_rank[position] = distinct;
+            }
+
+            rank.swap(next_rank);
+
+            if ( sorted || 2 * length >= longest )
+            {
+                break;
+            }
+        }
+
+        for ( std::size_t index = 0; index < size; ++index )
+        {
+            rank[positions[index]] = index; //!< Reused as the inverse suffix array.
+        }
+
+        std::uint64_t common = 0;
+
+        for ( std::uint64_t position = 0; position < size; ++position )
+        {
+            if ( rank[position] == 0 )
+            {
+                common = 0;
+                continue;
+            }
+
+            const std::uint64_t previous = positions[rank[position] - 1];
+
+            while ( position + common < ends[position] && previous + common < ends[previous] && values[position + common] == values[previous + common] )
+            {
+                ++common;
+            }
+
+            result.m_Lcp[rank[position]] = common;
+            common                       = common > 0 ? common - 1 : 0; //!< Kasai: the next suffix shares at least one byte less with its predecessor.
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Merge two suffix arrays of disjoint sources into one.
+     * @param values The sources of both arrays.
+     * @param offsets The source boundaries of both arrays.
+     * @param first The first array.
+     * @param second The second array.
+     * @return The merged arrays.
+     * @note Both heads are at least the last merged suffix. The one that shares the longer prefix with it is the smaller, and the
+     * other shares as much with it as with the last merged suffix. On a tie, the heads are compared from the shared prefix on.
+     */
+    SuffixArray MergeSuffixArrays(const std::span<const std::byte> values, const std::span<const std::size_t> offsets, const SuffixArray& first, const SuffixArray& second) noexcept
+    {
+        const std::size_t first_size  = first.m_Positions.size();
+        const std::size_t second_size = second.m_Positions.size();
+        SuffixArray       result;
+
+        result.m_Positions.reserve(first_size + second_size);
+        result.m_Lcp.reserve(first_size + second_size);
+
+        const std::vector<std::uint64_t> ends = GetSourceEnds(offsets, values.size()); //!< O(1) suffix ends for the comparisons
+        const auto                       suffix = [&values, &ends](const std::uint64_t position) noexcept { return values.subspan(position, ends[position] - position); };
+
+        std::size_t   first_index   = 0;
+        std::size_t   second_index  = 0;
+        std::uint64_t first_common  = 0; //!< Common prefix of the first head and the last merged suffix
+        std::uint64_t second_common = 0; //!< Common prefix of the second head and the last merged suffix
+
+        while ( first_index < first_size && second_index < second_size )
+        {
+            bool take_first = first_common > second_common;
+
+            if ( first_common == second_common )
+            {
+                const auto    first_suffix  = suffix(first.m_Positions[first_index]);
+                const auto    second_suffix = suffix(second.m_Positions[second_index]);
+                std::uint64_t common        = first_common;
+
+                while ( common < first_suffix.size() && common < second_suffix.size() && first_suffix[common] == second_suffix[common] )
+                {
+                    ++common;
+                }
+
+                take_first = common >= first_suffix.size() || (common < second_suffix.size() && first_suffix[common] < second_suffix[common]);
+
+                if ( take_first )
+                {
+                    second_common = common;
+                }
+                else
+                {
+                    first_common = common;
+                }
+            }
+
+            if ( take_first )
+            {
+                result.m_Positions.push_back(first.m_Positions[first_index]);
+                result.m_Lcp.push_back(result.m_Lcp.empty() ? 0 : first_common);
+                first_common = ++first_index < first_size ? first.m_Lcp[first_index] : 0;
+            }
+            else
+            {
+                result.m_Positions.push_back(second.m_Positions[second_index]);
+                result.m_Lcp.push_back(result.m_Lcp.empty() ? 0 : second_common);
+                second_common = ++second_index < second_size ? second.m_Lcp[second_index] : 0;
+            }
+        }
+
+        for ( ; first_index < first_size; first_common = ++first_index < first_size ? first.m_Lcp[first_index] : 0 )
+        {
+            result.m_Positions.push_back(first.m_Positions[first_index]);
+            result.m_Lcp.push_back(result.m_Lcp.empty() ? 0 : first_common);
+        }
+
+        for ( ; second_index < second_size; second_common = ++second_index < second_size ? second.m_Lcp[second_index] : 0 )
+        {
+            result.m_Positions.push_back(second.m_Positions[second_index]);
+            result.m_Lcp.push_back(result.m_Lcp.empty() ? 0 : second_common);
+        }
+
+        return result;
+    }
+} // namespace Program::Module::Internal
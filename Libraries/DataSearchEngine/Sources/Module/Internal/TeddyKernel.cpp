@@ -0,0 +1,333 @@
+#include "Module/Internal/TeddyKernel.hpp"
+#include <algorithm>
+#include <bit>
+
+#if defined(__HELPER_CPU_FEATURES_X86__)
+ #include <immintrin.h>
+#endif
+
+namespace Program::Module::Internal
+{
+    namespace
+    {
+        /**
+         * @brief Buckets of one position in the byte tables.
+         */
+        template<std::size_t Length>
+        inline std::uint8_t GetBuckets(const TeddyMasks& masks, const std::byte* source, const std::size_t position) noexcept
+        {
+            std::uint8_t buckets = masks.m_Bytes[0][std::to_integer<std::uint8_t>(source[position])];
+
+            for ( std::size_t index = 1; index < Length; ++index )
+            {
+                buckets &= masks.m_Bytes[index][std::to_integer<std::uint8_t>(source[position + index])];
+            }
+
+            return buckets;
+        }
+
+        /**
+         * @brief Filter the positions from position to end, up to 64 at a time, with the byte tables.
+         * @details The scalar kernel, and the tail of the vector kernels.
+         */
+        template<std::size_t Length>
+        inline bool NextScalarSteps(const TeddyMasks& masks, const std::byte* source, const std::size_t end, std::size_t& position, TeddyBlock& block) noexcept
+        {
+            while ( position < end )
+            {
+                const std::size_t first = position;
+                const std::size_t last  = std::min(end, first + 64);
+                std::uint64_t     lanes = 0;
+
+                for ( ; position < last; ++position )
+                {
+                    const std::uint8_t buckets = GetBuckets<Length>(masks, source, position);
+
+                    block.m_Buckets[position - first] = buckets;
+                    lanes |= std::uint64_t{ buckets != 0 } << (position - first);
+                }
+
+                if ( lanes != 0 )
+                {
+                    block.m_Position = first;
+                    block.m_Lanes    = lanes;
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        template<std::size_t Length>
+        bool NextScalar(const TeddyMasks& masks, const std::byte* source, const std::size_t, const std::size_t end, std::size_t& position, TeddyBlock& block) noexcept
+        {
+            return NextScalarSteps<Length>(masks, source, end, position, block);
+        }
+
+#if defined(__HELPER_CPU_FEATURES_X86__)
+        /**
+         * @brief Keep the lanes of the positions before end.
+         */
+        inline std::uint64_t ClipLanes(std::uint64_t lanes, const std::size_t position, const std::size_t end, const std::size_t width) noexcept
+        {
+            return end - position < width ? lanes & ((std::uint64_t{ 1 } << (end - position)) - 1) : lanes;
+        }
+
+        /**
+         * @brief Narrow the candidates of a vector step to the buckets of the byte tables.
+         * @details The two nibbles of a byte are looked up apart, so a bucket passes a byte whose low nibble comes from one of
+         * its patterns and high nibble from another: the larger the buckets, the more such false candidates. The few lanes
+         * left are checked against the exact tables before they cost a verification.
+         * @param lanes The candidate lanes of the step; the block holds their nibble buckets.
+         * @return The lanes left.
+         */
+        template<std::size_t Length>
+        inline std::uint64_t RefineLanes(const TeddyMasks& masks, const std::byte* source, std::uint64_t lanes, TeddyBlock& block) noexcept
+        {
+            for ( std::uint64_t remaining = lanes; remaining != 0; remaining &= remaining - 1 )
+            {
+                const auto lane = static_cast<std::size_t>(std::countr_zero(remaining));
+
+                if ( (block.m_Buckets[lane] &= GetBuckets<Length>(masks, source, block.m_Position + lane)) == 0 )
+                {
+                    lanes &= ~(std::uint64_t{ 1 } << lane);
+                }
+            }
+
+            return lanes;
+        }
+
+        /**
+         * @brief 16 positions per step.
+         * @details Compiled for AVX2, which implies the SSSE3 byte shuffle; only the wider tiers run it, on the positions their
+         * own steps leave.
+         * @param position First position to filter; advanced past the block returned.
+         */
+        template<std::size_t Length>
+        HELPERS_TARGET_AVX2 inline bool NextSsse3Steps(const TeddyMasks& masks, const std::byte* source, const std::size_t source_size, const std::size_t end, std::size_t& position, TeddyBlock& block) noexcept
+        {
+            const __m128i nibble = _mm_set1_epi8(0x0F);
+            __m128i       low[Length];
+            __m128i       high[Length];
+
+            for ( std::size_t index = 0; index < Length; ++index )
+            {
+                low[index]  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(masks.m_Low[index].data()));
+                high[index] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(masks.m_High[index].data()));
+            }
+
+            for ( ; position < end && position + 16 + Length - 1 <= source_size; position += 16 )
+            {
+                __m128i buckets = _mm_set1_epi8(-1);
+
+                for ( std::size_t index = 0; index < Length; ++index )
+                {
+                    const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + position + index));
+                    const __m128i lows  = _mm_shuffle_epi8(low[index], _mm_and_si128(bytes, nibble));
+                    const __m128i highs = _mm_shuffle_epi8(high[index], _mm_and_si128(_mm_srli_epi16(bytes, 4), nibble));
+                    buckets             = _mm_and_si128(buckets, _mm_and_si128(lows, highs));
+                }
+
+                const auto lanes = ClipLanes(~static_cast<std::uint64_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(buckets, _mm_setzero_si128()))) & 0xFFFF, position, end, 16);
+
+                if ( lanes == 0 )
+                {
+                    continue;
+                }
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(block.m_Buckets.data()), buckets);
+                block.m_Position = position;
+                block.m_Lanes    = RefineLanes<Length>(masks, source, lanes, block);
+
+                if ( block.m_Lanes != 0 )
+                {
+                    position += 16;
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        /**
+         * @brief 32 positions per step.
+         * @param position First position to filter; advanced past the block returned.
+         */
+        template<std::size_t Length>
+        HELPERS_TARGET_AVX2 inline bool NextAvx2Steps(const TeddyMasks& masks, const std::byte* source, const std::size_t source_size, const std::size_t end, std::size_t& position, TeddyBlock& block) noexcept
+        {
+            const __m256i nibble = _mm256_set1_epi8(0x0F);
+            __m256i       low[Length];
+            __m256i       high[Length];
+
+            for ( std::size_t index = 0; index < Length; ++index )
+            {
+                low[index]  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(masks.m_Low[index].data()));
+                high[index] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(masks.m_High[index].data()));
+            }
+
+            for ( ; position < end && position + 32 + Length - 1 <= source_size; position += 32 )
+            {
+                __m256i buckets = _mm256_set1_epi8(-1);
+
+                for ( std::size_t index = 0; index < Length; ++index )
+                {
+                    const __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + position + index));
+                    const __m256i lows  = _mm256_shuffle_epi8(low[index], _mm256_and_si256(bytes, nibble));
+                    const __m256i highs = _mm256_shuffle_epi8(high[index], _mm256_and_si256(_mm256_srli_epi16(bytes, 4), nibble));
+                    buckets             = _mm256_and_si256(buckets, _mm256_and_si256(lows, highs));
+                }
+
+                const auto lanes = ClipLanes(~static_cast<std::uint64_t>(static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(buckets, _mm256_setzero_si256())))) & 0xFFFFFFFF, position, end, 32);
+
+                if ( lanes == 0 )
+                {
+                    continue;
+                }
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(block.m_Buckets.data()), buckets);
+                block.m_Position = position;
+                block.m_Lanes    = RefineLanes<Length>(masks, source, lanes, block);
+
+                if ( block.m_Lanes != 0 )
+                {
+                    position += 32;
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        /**
+         * @brief 64 positions per step.
+         * @param position First position to filter; advanced past the block returned.
+         */
+        template<std::size_t Length>
+        HELPERS_TARGET_AVX512 inline bool NextAvx512Steps(const TeddyMasks& masks, const std::byte* source, const std::size_t source_size, const std::size_t end, std::size_t& position, TeddyBlock& block) noexcept
+        {
+            const __m512i nibble = _mm512_set1_epi8(0x0F);
+            __m512i       low[Length];
+            __m512i       high[Length];
+
+            for ( std::size_t index = 0; index < Length; ++index )
+            {
+                low[index]  = _mm512_loadu_si512(masks.m_Low[index].data());
+                high[index] = _mm512_loadu_si512(masks.m_High[index].data());
+            }
+
+            for ( ; position < end && position + 64 + Length - 1 <= source_size; position += 64 )
+            {
+                __m512i buckets = _mm512_set1_epi8(-1);
+
+                for ( std::size_t index = 0; index < Length; ++index )
+                {
+                    const __m512i bytes = _mm512_loadu_si512(source + position + index);
+                    const __m512i lows  = _mm512_shuffle_epi8(low[index], _mm512_and_si512(bytes, nibble));
+                    const __m512i highs = _mm512_shuffle_epi8(high[index], _mm512_and_si512(_mm512_srli_epi16(bytes, 4), nibble));
+                    buckets             = _mm512_and_si512(buckets, _mm512_and_si512(lows, highs));
+                }
+
+                const auto lanes = ClipLanes(static_cast<std::uint64_t>(_mm512_test_epi8_mask(buckets, buckets)), position, end, 64);
+
+                if ( lanes == 0 )
+                {
+                    continue;
+                }
+
+                _mm512_storeu_si512(block.m_Buckets.data(), buckets);
+                block.m_Position = position;
+                block.m_Lanes    = RefineLanes<Length>(masks, source, lanes, block);
+
+                if ( block.m_Lanes != 0 )
+                {
+                    position += 64;
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        template<std::size_t Length>
+        HELPERS_TARGET_AVX2 bool NextAvx2(const TeddyMasks& masks, const std::byte* source, const std::size_t source_size, const std::size_t end, std::size_t& position, TeddyBlock& block) noexcept
+        {
+            return NextAvx2Steps<Length>(masks, source, source_size, end, position, block) || NextSsse3Steps<Length>(masks, source, source_size, end, position, block) || NextScalarSteps<Length>(masks, source, end, position, block);
+        }
+
+        template<std::size_t Length>
+        HELPERS_TARGET_AVX512 bool NextAvx512(const TeddyMasks& masks, const std::byte* source, const std::size_t source_size, const std::size_t end, std::size_t& position, TeddyBlock& block) noexcept
+        {
+            return NextAvx512Steps<Length>(masks, source, source_size, end, position, block) || NextAvx2Steps<Length>(masks, source, source_size, end, position, block) || NextSsse3Steps<Length>(masks, source, source_size, end, position, block) || NextScalarSteps<Length>(masks, source, end, position, block);
+        }
+#endif
+
+        /**
+         * @brief Kernels of one tier, one per fingerprint length.
+         */
+        using KernelTable = std::array<TeddyKernel, 4>;
+
+        /**
+         * @brief Build the kernel table of a tier.
+         * @tparam TKernel The kernel of the tier, instantiated once per fingerprint length.
+         */
+        template<template<std::size_t> typename TKernel>
+        constexpr KernelTable MakeKernelTable() noexcept
+        {
+            return { TKernel<1>::Next, TKernel<2>::Next, TKernel<3>::Next, TKernel<4>::Next };
+        }
+
+        template<std::size_t Length>
+        struct ScalarKernel
+        {
+            static constexpr TeddyKernel Next = &NextScalar<Length>;
+        };
+
+#if defined(__HELPER_CPU_FEATURES_X86__)
+        template<std::size_t Length>
+        struct Avx2Kernel
+        {
+            static constexpr TeddyKernel Next = &NextAvx2<Length>;
+        };
+
+        template<std::size_t Length>
+        struct Avx512Kernel
+        {
+            static constexpr TeddyKernel Next = &NextAvx512<Length>;
+        };
+#endif
+
+        /**
+         * @brief Get the kernel table of a tier.
+         */
+        const KernelTable& GetKernelTable(const Helpers::cpu_tier tier) noexcept
+        {
+            static constexpr KernelTable scalar_kernels = MakeKernelTable<ScalarKernel>();
+#if defined(__HELPER_CPU_FEATURES_X86__)
+            static constexpr KernelTable avx2_kernels   = MakeKernelTable<Avx2Kernel>();
+            static constexpr KernelTable avx512_kernels = MakeKernelTable<Avx512Kernel>();
+#endif
+
+            switch ( tier )
+            {
+#if defined(__HELPER_CPU_FEATURES_X86__)
+                case Helpers::cpu_tier::avx512:
+                    return avx512_kernels;
+
+                case Helpers::cpu_tier::avx2:
+                    return avx2_kernels;
+#endif
+
+                case Helpers::cpu_tier::sse2:
+                case Helpers::cpu_tier::scalar:
+                default:
+                    return scalar_kernels;
+            }
+        }
+    } // namespace
+
+    TeddyKernel GetTeddyKernel(const Helpers::cpu_tier tier, const std::size_t length) noexcept
+    {
+        return GetKernelTable(tier)[std::clamp<std::size_t>(length, 1, 4) - 1];
+    }
+} // namespace Program::Module::Internal
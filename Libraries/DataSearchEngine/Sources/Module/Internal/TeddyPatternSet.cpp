@@ -0,0 +1,233 @@
+#include "Module/Internal/TeddyPatternSet.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+namespace Program::Module::Internal
+{
+    /**
+     * @brief Bucket the patterns and build the filter tables.
+     * @param patterns The patterns.
+     * @param tier The instruction set tier of the filter kernel.
+     * @note The fingerprint is as long as the shortest non-empty pattern, up to 4 bytes, so every pattern fills every
+     * fingerprint byte. The buckets take consecutive runs of the patterns sorted by fingerprint: a bucket sees few distinct
+     * first bytes, and duplicate patterns land in the same one.
+     */
+    TeddyPatternSet::TeddyPatternSet(const std::vector<std::vector<std::byte>>& patterns, const Helpers::cpu_tier tier) noexcept
+        : m_Patterns{}
+        , m_Shortest{ 0 }
+        , m_Masks{}
+        , m_Kernel{ nullptr }
+        , m_Entries{}
+        , m_Buckets{}
+    {
+        std::size_t              total_size = 0;
+        std::vector<std::size_t> order; //!< Indexes of the non-empty patterns
+
+        for ( std::size_t index = 0; index < patterns.size(); ++index )
+        {
+            total_size += patterns[index].size();
+
+            if ( not patterns[index].empty() )
+            {
+                m_Shortest = order.empty() ? patterns[index].size() : std::min(m_Shortest, patterns[index].size());
+                order.push_back(index);
+            }
+        }
+
+        m_Patterns.reserve(patterns.size(), total_size);
+
+        for ( const auto& pattern : patterns )
+        {
+            m_Patterns.push_back(pattern);
+        }
+
+        m_Masks.m_Length = std::clamp<std::size_t>(m_Shortest, 1, 4);
+        m_Kernel         = GetTeddyKernel(tier, m_Masks.m_Length);
+
+        const std::size_t length = m_Masks.m_Length;
+        std::stable_sort(order.begin(), order.end(), [&patterns, length](const std::size_t left, const std::size_t right) { return std::lexicographical_compare(patterns[left].begin(), patterns[left].begin() + static_cast<std::ptrdiff_t>(length), patterns[right].begin(), patterns[right].begin() + static_cast<std::ptrdiff_t>(length)); });
+
+        m_Entries.reserve(order.size());
+
+        for ( std::size_t bucket = 0; bucket < BucketCount; ++bucket )
+        {
+            const std::size_t  first = bucket * order.size() / BucketCount;
+            const std::size_t  last  = (bucket + 1) * order.size() / BucketCount;
+            const std::uint8_t bit   = static_cast<std::uint8_t>(1 << bucket);
+
+            m_Buckets[bucket] = m_Entries.size();
+
+            for ( std::size_t index = first; index < last; ++index )
+            {
+                const auto& pattern = patterns[order[index]];
+
+                for ( std::size_t position = 0; position < length; ++position )
+                {
+                    const auto value = std::to_integer<std::uint8_t>(pattern[position]);
+
+                    m_Masks.m_Bytes[position][value] |= bit;
+
+                    for ( std::size_t lane = 0; lane < 64; lane += 16 )
+                    {
+                        m_Masks.m_Low[position][lane + (value & 0x0F)] |= bit;
+                        m_Masks.m_High[position][lane + (value >> 4)] |= bit;
+                    }
+                }
+
+                m_Entries.push_back({ GetKey(pattern.data()), order[index] });
+            }
+
+            std::sort(m_Entries.begin() + static_cast<std::ptrdiff_t>(m_Buckets[bucket]), m_Entries.end(), [](const Entry& left, const Entry& right) { return left.m_Key < right.m_Key || (left.m_Key == right.m_Key && left.m_Pattern < right.m_Pattern); });
+        }
+
+        m_Buckets[BucketCount] = m_Entries.size();
+    }
+
+    /**
+     * @brief Get the number of patterns in the set.
+     * @return The number of patterns, empty patterns included.
+     */
+    std::size_t TeddyPatternSet::GetPatternCount() const noexcept
+    {
+        return m_Patterns.size();
+    }
+
+    /**
+     * @brief The fingerprint bytes at some data, as one word.
+     * @param data At least m_Length bytes.
+     * @return The bytes, the unused high ones zero.
+     */
+    std::uint32_t TeddyPatternSet::GetKey(const std::byte* data) const noexcept
+    {
+        std::uint32_t key = 0;
+        std::memcpy(&key, data, m_Masks.m_Length);
+        return key;
+    }
+
+    /**
+     * @brief Filter the source and pass every candidate position to a visitor, in increasing order.
+     * @param source The source data to search in.
+     * @param visit Called with the position and its buckets; returns true to stop.
+     * @note Only the positions a pattern as long as the shortest one fits at are filtered.
+     */
+    template<typename TVisit>
+    void TeddyPatternSet::Scan(const std::span<const std::byte> source, TVisit&& visit) const noexcept
+    {
+        if ( m_Entries.empty() || m_Shortest > source.size() )
+        {
+            return;
+        }
+
+        const std::size_t end      = source.size() - m_Shortest + 1;
+        std::size_t       position = 0;
+        TeddyBlock        block;
+
+        while ( m_Kernel(m_Masks, source.data(), source.size(), end, position, block) )
+        {
+            for ( std::uint64_t lanes = block.m_Lanes; lanes != 0; lanes &= lanes - 1 )
+            {
+                const auto lane = static_cast<std::size_t>(std::countr_zero(lanes));
+
+                if ( visit(block.m_Position + lane, block.m_Buckets[lane]) )
+                {
+                    return;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Verify a candidate position against the patterns of its buckets.
+     * @param source The source data to search in.
+     * @param position The candidate position.
+     * @param buckets The buckets the position passed.
+     * @param verified Called with the index of every pattern that occurs at the position.
+     * @note The fingerprint bytes are compared as one word to select the patterns; only the rest of them is compared byte by byte.
+     */
+    template<typename TVerified>
+    void TeddyPatternSet::Verify(const std::span<const std::byte> source, const std::size_t position, const std::uint8_t buckets, TVerified&& verified) const noexcept
+    {
+        const std::uint32_t key       = GetKey(source.data() + position);
+        const std::size_t   remaining = source.size() - position;
+        const std::size_t   length    = m_Masks.m_Length;
+
+        for ( std::uint32_t bits = buckets; bits != 0; bits &= bits - 1 )
+        {
+            const auto bucket = static_cast<std::size_t>(std::countr_zero(bits));
+            const auto first  = m_Entries.begin() + static_cast<std::ptrdiff_t>(m_Buckets[bucket]);
+            const auto last   = m_Entries.begin() + static_cast<std::ptrdiff_t>(m_Buckets[bucket + 1]);
+
+            for ( auto entry = std::lower_bound(first, last, key, [](const Entry& left, const std::uint32_t right) { return left.m_Key < right; }); entry != last && entry->m_Key == key; ++entry )
+            {
+                const auto pattern = m_Patterns[entry->m_Pattern];
+
+                if ( pattern.size() <= remaining && std::memcmp(pattern.data() + length, source.data() + position + length, pattern.size() - length) == 0 )
+                {
+                    verified(entry->m_Pattern);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Search for every pattern of the set in a given source data.
+     * @param source The source data to search in.
+     * @return The leftmost match; among matches at the same offset, the one with the lowest pattern index.
+     */
+    std::optional<PatternMatch> TeddyPatternSet::Search(const std::span<const std::byte> source) const noexcept
+    {
+        std::optional<PatternMatch> result;
+
+        Scan(source,
+             [this, &source, &result](const std::size_t position, const std::uint8_t buckets) noexcept
+             {
+                 Verify(source, position, buckets,
+                        [&result, position](const std::size_t pattern) noexcept
+                        {
+                            if ( not result || pattern < result->pattern )
+                            {
+                                result = PatternMatch{ pattern, position };
+                            }
+                        });
+
+                 return result.has_value();
+             });
+
+        return result;
+    }
+
+    /**
+     * @brief Check if any pattern of the set occurs in a given source data.
+     * @param source The source data to search in.
+     * @return True if Search would find a match.
+     */
+    bool TeddyPatternSet::Contains(const std::span<const std::byte> source) const noexcept
+    {
+        return Search(source).has_value();
+    }
+
+    /**
+     * @brief Find every pattern of the set that occurs in a given source data.
+     * @param source The source data to search in.
+     * @param matches The cleared bitset of the patterns.
+     */
+    void TeddyPatternSet::Match(const std::span<const std::byte> source, const std::span<std::uint64_t> matches) const noexcept
+    {
+        Scan(source,
+             [this, &source, &matches](const std::size_t position, const std::uint8_t buckets) noexcept
+             {
+                 Verify(source, position, buckets, [&matches](const std::size_t pattern) noexcept { matches[pattern / 64] |= std::uint64_t{ 1 } << (pattern % 64); });
+                 return false;
+             });
+    }
+
+    /**
+     * @brief Check if the set rejects the sources without a match itself, before any per-pattern work.
+     * @return True: the SIMD nibble filter rejects a source faster than byte fingerprints would.
+     */
+    bool TeddyPatternSet::HasOwnPrefilter() const noexcept
+    {
+        return true;
+    }
+} // namespace Program::Module::Internal
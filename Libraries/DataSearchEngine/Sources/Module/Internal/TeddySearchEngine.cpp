@@ -0,0 +1,41 @@
+#include "Module/Internal/TeddySearchEngine.hpp"
+#include "Module/Internal/TeddyPatternSet.hpp"
+#include "Module/Internal/AhoCorasickPatternSet.hpp"
+#include <algorithm>
+
+/**
+ * @brief Construct the engine.
+ * @param tier The instruction set tier of the single pattern searches and of the pattern set filter.
+ */
+Program::Module::Internal::TeddySearchEngine::TeddySearchEngine(const Helpers::cpu_tier tier) noexcept
+    : DelegatingSearchEngine{ tier }
+    , m_Tier{ tier }
+{
+}
+
+/**
+ * @brief Compile a set of patterns.
+ * @param patterns The patterns.
+ * @return The Teddy filter of the patterns, or their Aho-Corasick automaton for a large set.
+ */
+std::shared_ptr<const Program::Module::IPatternSet> Program::Module::Internal::TeddySearchEngine::Compile(const std::vector<std::vector<std::byte>>& patterns) const noexcept
+{
+    std::size_t count    = 0;
+    std::size_t shortest = 4; //!< Fingerprint length: the shortest non-empty pattern, up to 4 bytes
+
+    for ( const auto& pattern : patterns )
+    {
+        if ( not pattern.empty() )
+        {
+            ++count;
+            shortest = std::min(shortest, pattern.size());
+        }
+    }
+
+    if ( count > MaxPatternsPerByte * shortest )
+    {
+        return std::make_shared<AhoCorasickPatternSet>(patterns);
+    }
+
+    return std::make_shared<TeddyPatternSet>(patterns, m_Tier);
+}
@@ -0,0 +1,141 @@
+#include "Module/Internal/TwoWaySearcher.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace Program::Module::Internal
+{
+    namespace
+    {
+        /**
+         * @brief Maximal suffix of a pattern for one byte ordering.
+         * @param pattern The pattern, at least one byte long.
+         * @param reverse Whether the ordering of the bytes is reversed.
+         * @param period Receives the period of the suffix.
+         * @return The start of the suffix, minus one: SIZE_MAX for the whole pattern.
+         */
+        std::size_t GetMaximalSuffix(const std::span<const std::byte> pattern, const bool reverse, std::size_t& period) noexcept
+        {
+            std::size_t suffix = SIZE_MAX; //!< Start of the best suffix so far, minus one
+            std::size_t j      = 0;        //!< Start of the candidate suffix, minus one
+            std::size_t k      = 1;        //!< Offset of the compared bytes in both suffixes
+            period             = 1;
+
+            while ( j + k < pattern.size() )
+            {
+                const std::byte a = pattern[j + k];
+                const std::byte b = pattern[suffix + k]; //!< suffix + k wraps around to k - 1 while suffix is SIZE_MAX
+
+                if ( reverse ? b < a : a < b )
+                {
+                    j      += k; //!< The candidate is smaller: skip it, the best suffix grows.
+                    k       = 1;
+                    period  = j - suffix;
+                }
+                else if ( a == b )
+                {
+                    if ( k != period )
+                    {
+                        ++k;
+                    }
+                    else
+                    {
+                        j += period;
+                        k  = 1;
+                    }
+                }
+                else
+                {
+                    suffix = j++; //!< The candidate is larger: it becomes the best suffix.
+                    k      = 1;
+                    period = 1;
+                }
+            }
+
+            return suffix;
+        }
+    } // namespace
+
+    /**
+     * @brief Compute the critical factorization and the period of a pattern.
+     * @param pattern The data to search for.
+     * @note The larger of the two maximal suffixes gives a critical factorization.
+     */
+    TwoWaySearcher::TwoWaySearcher(const std::span<const std::byte> pattern) noexcept
+        : m_Pattern{ pattern }
+        , m_Suffix{ 0 }
+        , m_Period{ 1 }
+        , m_Periodic{ false }
+    {
+        if ( pattern.empty() )
+        {
+            return;
+        }
+
+        std::size_t       period         = 1;
+        std::size_t       reverse_period = 1;
+        const std::size_t suffix         = GetMaximalSuffix(pattern, false, period) + 1;
+        const std::size_t reverse_suffix = GetMaximalSuffix(pattern, true, reverse_period) + 1;
+
+        m_Suffix = std::max(suffix, reverse_suffix);
+        m_Period = reverse_suffix < suffix ? period : reverse_period;
+
+        // The left part repeats with the period: only then the matched bytes carry over to the next window.
+        m_Periodic = m_Period + m_Suffix <= pattern.size() && std::memcmp(pattern.data(), pattern.data() + m_Period, m_Suffix) == 0;
+
+        if ( not m_Periodic )
+        {
+            m_Period = std::max(m_Suffix, pattern.size() - m_Suffix) + 1;
+        }
+    }
+
+    /**
+     * @brief Search for the pattern in a given source data.
+     * @param source The source data to search in.
+     * @return The offset of the first occurrence of the pattern, or an empty optional if not found or if the pattern is empty.
+     */
+    std::optional<std::size_t> TwoWaySearcher::Search(const std::span<const std::byte> source) const noexcept
+    {
+        const std::size_t size = m_Pattern.size();
+
+        if ( size == 0 || size > source.size() )
+        {
+            return std::nullopt;
+        }
+
+        std::size_t memory = 0; //!< Bytes of the left part already known to match, periodic patterns only
+
+        for ( std::size_t position = 0; position <= source.size() - size; )
+        {
+            std::size_t index = std::max(m_Suffix, memory);
+
+            while ( index < size && m_Pattern[index] == source[position + index] )
+            {
+                ++index; //!< Right part, forwards.
+            }
+
+            if ( index < size )
+            {
+                position += index - m_Suffix + 1;
+                memory    = 0;
+                continue;
+            }
+
+            index = m_Suffix;
+
+            while ( index > memory && m_Pattern[index - 1] == source[position + index - 1] )
+            {
+                --index; //!< Left part, backwards, down to the remembered bytes.
+            }
+
+            if ( index <= memory )
+            {
+                return position;
+            }
+
+            position += m_Period;
+            memory    = m_Periodic ? size - m_Period : 0;
+        }
+
+        return std::nullopt;
+    }
+} // namespace Program::Module::Internal
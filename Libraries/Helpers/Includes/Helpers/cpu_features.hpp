@@ -0,0 +1,213 @@
+#ifndef __HELPER_CPU_FEATURES_HPP__ // clang-format off
+#define __HELPER_CPU_FEATURES_HPP__ // clang-format on
+
+#include <atomic>
+#include <cinttypes>
+#include <cstdlib>
+#include <optional>
+#include <string_view>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+ #define __HELPER_CPU_FEATURES_X86__
+ #if defined(_MSC_VER) && !defined(__clang__)
+  #include <intrin.h>
+  #include <immintrin.h>
+ #endif
+#endif
+
+/**
+ * @brief Compile one function for an instruction set the rest of the target does not enable.
+ * @details The function may only be called after get_cpu_tier() reported the matching tier.
+ * MSVC emits every intrinsic without flags, so the attribute is empty there.
+ */
+#if defined(__HELPER_CPU_FEATURES_X86__) && (defined(__GNUC__) || defined(__clang__))
+ #define HELPERS_TARGET_SSE2   __attribute__((target("sse2")))
+ #define HELPERS_TARGET_AVX2   __attribute__((target("avx2")))
+ #define HELPERS_TARGET_AVX512 __attribute__((target("avx512f,avx512bw")))
+#else
+ #define HELPERS_TARGET_SSE2
+ #define HELPERS_TARGET_AVX2
+ #define HELPERS_TARGET_AVX512
+#endif
+
+namespace Program::Helpers
+{
+    /**
+     * @brief cpu_tier
+     * @details Instruction set tiers of the dispatched kernels, each one a superset of the previous.
+     */
+    enum class cpu_tier : std::uint8_t
+    {
+        scalar, //!< Portable code only
+        sse2,   //!< 16-byte vectors
+        avx2,   //!< 32-byte vectors
+        avx512  //!< 64-byte vectors, AVX-512F and AVX-512BW
+    };
+
+    /**
+     * @brief Name of the environment variable that caps the tier: "scalar", "sse2", "avx2" or "avx512".
+     */
+    inline constexpr const char* cpu_tier_environment_variable = "TESTSENIOR_CPU_TIER";
+
+    /**
+     * @brief Name of a tier.
+     */
+    constexpr std::string_view to_string(const cpu_tier tier) noexcept
+    {
+        switch ( tier )
+        {
+            case cpu_tier::sse2:
+                return "sse2";
+
+            case cpu_tier::avx2:
+                return "avx2";
+
+            case cpu_tier::avx512:
+                return "avx512";
+
+            case cpu_tier::scalar:
+            default:
+                return "scalar";
+        }
+    }
+
+    /**
+     * @brief Parse the name of a tier.
+     * @return The tier, or an empty optional if the name is unknown.
+     */
+    constexpr std::optional<cpu_tier> parse_cpu_tier(const std::string_view name) noexcept
+    {
+        for ( const cpu_tier tier : { cpu_tier::scalar, cpu_tier::sse2, cpu_tier::avx2, cpu_tier::avx512 } )
+        {
+            if ( name == to_string(tier) )
+            {
+                return tier;
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Detect the best tier the processor and the operating system support.
+     * @details AVX2 and AVX-512 also need the operating system to save the wide registers, which is checked through XGETBV.
+     */
+    inline cpu_tier detect_cpu_tier() noexcept
+    {
+#if defined(__HELPER_CPU_FEATURES_X86__) && (defined(__GNUC__) || defined(__clang__))
+        __builtin_cpu_init();
+
+        if ( __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") )
+        {
+            return cpu_tier::avx512;
+        }
+
+        if ( __builtin_cpu_supports("avx2") )
+        {
+            return cpu_tier::avx2;
+        }
+
+        if ( __builtin_cpu_supports("sse2") )
+        {
+            return cpu_tier::sse2;
+        }
+#elif defined(__HELPER_CPU_FEATURES_X86__)
+        int32_t registers[4]{};
+        __cpuid(registers, 0);
+        const int32_t max_leaf = registers[0];
+
+        __cpuid(registers, 1);
+        const bool sse2    = (registers[3] & (1 << 26)) != 0;
+        const bool osxsave = (registers[2] & (1 << 27)) != 0;
+
+        if ( osxsave && max_leaf >= 7 )
+        {
+            const std::uint64_t xcr0 = _xgetbv(0);
+            __cpuidex(registers, 7, 0);
+
+            const bool ymm_state = (xcr0 & 0x06) == 0x06; //!< XMM and YMM state
+            const bool zmm_state = (xcr0 & 0xE6) == 0xE6; //!< XMM, YMM, opmask and ZMM state
+
+            if ( zmm_state && (registers[1] & (1 << 16)) && (registers[1] & (1 << 30)) )
+            {
+                return cpu_tier::avx512;
+            }
+
+            if ( ymm_state && (registers[1] & (1 << 5)) )
+            {
+                return cpu_tier::avx2;
+            }
+        }
+
+        if ( sse2 )
+        {
+            return cpu_tier::sse2;
+        }
+#endif
+        return cpu_tier::scalar;
+    }
+
+    namespace Details
+    {
+        /**
+         * @brief Detected tier. Computed once, on first use.
+         */
+        inline cpu_tier detected_cpu_tier() noexcept
+        {
+            static const cpu_tier tier = detect_cpu_tier();
+            return tier;
+        }
+
+        /**
+         * @brief Detected tier, capped by the environment variable. Computed once, on first use.
+         */
+        inline cpu_tier startup_cpu_tier() noexcept
+        {
+            static const cpu_tier tier = []() noexcept
+            {
+                const char* value  = std::getenv(cpu_tier_environment_variable);
+                const auto  forced = value ? parse_cpu_tier(value) : std::nullopt;
+                return forced && *forced < detected_cpu_tier() ? *forced : detected_cpu_tier();
+            }();
+            return tier;
+        }
+
+        inline std::atomic<std::optional<cpu_tier>> forced_cpu_tier{}; //!< Tier forced by set_cpu_tier
+    } // namespace Details
+
+    /**
+     * @brief Get the tier the kernels bind to.
+     * @details The detected tier, capped by TESTSENIOR_CPU_TIER, unless set_cpu_tier forced another one.
+     */
+    inline cpu_tier get_cpu_tier() noexcept
+    {
+        const auto forced = Details::forced_cpu_tier.load(std::memory_order_acquire);
+        return forced ? *forced : Details::startup_cpu_tier();
+    }
+
+    /**
+     * @brief Force the tier of the kernels bound from now on, e.g. for benchmarking.
+     * @param tier The tier. It is capped by the detected one: a tier the processor lacks is never selected.
+     */
+    inline void set_cpu_tier(const cpu_tier tier) noexcept
+    {
+        const cpu_tier detected = Details::detected_cpu_tier();
+        Details::forced_cpu_tier.store(tier < detected ? tier : detected, std::memory_order_release);
+    }
+
+    /**
+     * @brief Resolve a requested tier: the current one if empty, capped by the detected one.
+     */
+    inline cpu_tier resolve_cpu_tier(const std::optional<cpu_tier> tier) noexcept
+    {
+        if ( not tier )
+        {
+            return get_cpu_tier();
+        }
+
+        const cpu_tier detected = Details::detected_cpu_tier();
+        return *tier < detected ? *tier : detected;
+    }
+} // namespace Program::Helpers
+
+#endif // __HELPER_CPU_FEATURES_HPP__
@@ -0,0 +1,101 @@
+#ifndef __HELPER_MASKED_BYTE_HPP__ // clang-format off
+#define __HELPER_MASKED_BYTE_HPP__ // clang-format on
+
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace Program::Helpers
+{
+    /**
+     * @brief masked_byte
+     * @details One byte of a masked pattern: only the bits set in mask are compared, so 0x4? is { 0x40, 0xF0 } and ?? is { 0x00, 0x00 }.
+     */
+    struct masked_byte
+    {
+        std::byte value; //!< Expected bits; the bits outside mask are ignored
+        std::byte mask;  //!< Compared bits
+
+        /**
+         * @brief Whether a byte matches.
+         */
+        constexpr bool matches(const std::byte data) const noexcept
+        {
+            return ((data ^ value) & mask) == std::byte{ 0 };
+        }
+
+        constexpr bool operator==(const masked_byte& other) const noexcept
+        {
+            return (value & mask) == (other.value & other.mask) && mask == other.mask;
+        }
+    };
+
+    /**
+     * @brief Parse a masked pattern.
+     * @details Bytes are two characters, each an hexadecimal digit or '?' for a wildcard nibble, with an optional 0x prefix, separated
+     * by spaces or commas: "0x4? ?? 0xFF", "4?,??,FF" and "[0x4?, 0x??, 0xFF]" are the same pattern.
+     * @param text The pattern.
+     * @return The bytes, or an empty optional if the text is malformed.
+     */
+    inline std::optional<std::vector<masked_byte>> parse_masked_bytes(std::string_view text)
+    {
+        const auto parse_nibble = [](const char digit) noexcept -> std::optional<masked_byte>
+        {
+            if ( digit == '?' )
+            {
+                return masked_byte{ std::byte{ 0x0 }, std::byte{ 0x0 } };
+            }
+
+            if ( digit >= '0' && digit <= '9' )
+            {
+                return masked_byte{ static_cast<std::byte>(digit - '0'), std::byte{ 0xF } };
+            }
+
+            if ( (digit | 0x20) >= 'a' && (digit | 0x20) <= 'f' )
+            {
+                return masked_byte{ static_cast<std::byte>((digit | 0x20) - 'a' + 10), std::byte{ 0xF } };
+            }
+
+            return std::nullopt;
+        };
+
+        const auto is_separator = [](const char character) noexcept
+        {
+            return character == ' ' || character == ',' || character == '\t' || character == '[' || character == ']';
+        };
+
+        std::vector<masked_byte> bytes;
+
+        while ( true )
+        {
+            while ( not text.empty() && is_separator(text.front()) )
+            {
+                text.remove_prefix(1);
+            }
+
+            if ( text.empty() )
+            {
+                return bytes;
+            }
+
+            if ( text.size() >= 2 && text[0] == '0' && (text[1] == 'x' || text[1] == 'X') )
+            {
+                text.remove_prefix(2);
+            }
+
+            const auto high = text.size() >= 2 ? parse_nibble(text[0]) : std::nullopt;
+            const auto low  = text.size() >= 2 ? parse_nibble(text[1]) : std::nullopt;
+
+            if ( not high || not low || (text.size() > 2 && not is_separator(text[2])) )
+            {
+                return std::nullopt;
+            }
+
+            bytes.push_back({ (high->value << 4) | low->value, (high->mask << 4) | low->mask });
+            text.remove_prefix(2);
+        }
+    }
+} // namespace Program::Helpers
+
+#endif // __HELPER_MASKED_BYTE_HPP__
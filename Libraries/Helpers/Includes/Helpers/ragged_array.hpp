@@ -0,0 +1,219 @@
+#ifndef __HELPER_RAGGED_ARRAY_HPP__ // clang-format off
+#define __HELPER_RAGGED_ARRAY_HPP__ // clang-format on
+
+#include <cstddef>
+#include <iterator>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+namespace Program::Helpers
+{
+    /**
+     * @brief ragged_array
+     * @details Sequence of variable-length sequences stored in one contiguous arena.
+     * Sequence i is the range [offsets()[i], offsets()[i + 1]) of values(), so the whole set costs two allocations
+     * (the arena and the offsets) instead of one allocation per sequence.
+     *
+     * @tparam T Value type
+     */
+    template<typename T>
+    class ragged_array
+    {
+    public:
+        using value_type      = std::span<T>;       //!< Sequence type
+        using const_reference = std::span<const T>; //!< Read-only sequence type
+        using size_type       = std::size_t;        //!< Size type
+
+        /**
+         * @brief Iterator over the sequences.
+         * @tparam IsConst Whether the iterator yields read-only sequences.
+         */
+        template<bool IsConst>
+        class basic_iterator
+        {
+        public:
+            using owner_type        = std::conditional_t<IsConst, const ragged_array, ragged_array>; //!< Owner type
+            using iterator_category = std::forward_iterator_tag;                                       //!< Iterator category
+            using value_type        = std::conditional_t<IsConst, std::span<const T>, std::span<T>>;  //!< Value type
+            using difference_type   = std::ptrdiff_t;                                                  //!< Difference type
+            using pointer           = void;                                                            //!< Pointer type
+            using reference         = value_type;                                                      //!< Reference type
+
+            basic_iterator() noexcept = default;
+
+            basic_iterator(owner_type* owner, const size_type index) noexcept
+                : m_Owner{ owner }
+                , m_Index{ index }
+            {
+            }
+
+            reference operator*() const noexcept
+            {
+                return (*m_Owner)[m_Index];
+            }
+
+            basic_iterator& operator++() noexcept
+            {
+                ++m_Index;
+                return *this;
+            }
+
+            basic_iterator operator++(int) noexcept
+            {
+                basic_iterator copy = *this;
+                ++m_Index;
+                return copy;
+            }
+
+            bool operator==(const basic_iterator& other) const noexcept
+            {
+                return m_Index == other.m_Index;
+            }
+
+        private:
+            owner_type* m_Owner{ nullptr }; //!< Owner
+            size_type   m_Index{ 0 };       //!< Sequence index
+        };
+
+        using iterator       = basic_iterator<false>; //!< Iterator
+        using const_iterator = basic_iterator<true>;  //!< Read-only iterator
+
+        /**
+         * @brief Construct an empty ragged_array.
+         */
+        ragged_array()
+            : m_Values{}
+            , m_Offsets{ 0 }
+        {
+        }
+
+        /**
+         * @brief Number of sequences.
+         */
+        size_type size() const noexcept
+        {
+            return m_Offsets.size() - 1;
+        }
+
+        /**
+         * @brief Whether there are no sequences.
+         */
+        bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+        /**
+         * @brief Get a sequence.
+         * @param index Sequence index.
+         * @return The sequence.
+         */
+        std::span<T> operator[](const size_type index) noexcept
+        {
+            return { m_Values.data() + m_Offsets[index], m_Offsets[index + 1] - m_Offsets[index] };
+        }
+
+        /**
+         * @brief Get a sequence.
+         * @param index Sequence index.
+         * @return The read-only sequence.
+         */
+        std::span<const T> operator[](const size_type index) const noexcept
+        {
+            return { m_Values.data() + m_Offsets[index], m_Offsets[index + 1] - m_Offsets[index] };
+        }
+
+        /**
+         * @brief The whole arena, every sequence back to back.
+         */
+        std::span<T> values() noexcept
+        {
+            return m_Values;
+        }
+
+        /**
+         * @brief The whole arena, every sequence back to back.
+         */
+        std::span<const T> values() const noexcept
+        {
+            return m_Values;
+        }
+
+        /**
+         * @brief The sequence boundaries: size() + 1 offsets into values(), starting at 0.
+         */
+        const std::vector<size_type>& offsets() const noexcept
+        {
+            return m_Offsets;
+        }
+
+        /**
+         * @brief Reserve room for the sequences and the values.
+         * @param sequence_count Number of sequences.
+         * @param value_count Total number of values.
+         */
+        void reserve(const size_type sequence_count, const size_type value_count)
+        {
+            m_Offsets.reserve(sequence_count + 1);
+            m_Values.reserve(value_count);
+        }
+
+        /**
+         * @brief Remove every sequence, keeping the capacity.
+         */
+        void clear() noexcept
+        {
+            m_Values.clear();
+            m_Offsets.resize(1);
+        }
+
+        /**
+         * @brief Append a value-initialized sequence.
+         * @param length Sequence length.
+         * @return The new sequence.
+         */
+        std::span<T> emplace_back(const size_type length)
+        {
+            m_Values.resize(m_Values.size() + length);
+            m_Offsets.push_back(m_Values.size());
+            return (*this)[size() - 1];
+        }
+
+        /**
+         * @brief Append a copy of a sequence.
+         * @param values The sequence.
+         */
+        void push_back(const std::span<const T> values)
+        {
+            m_Values.insert(m_Values.end(), values.begin(), values.end());
+            m_Offsets.push_back(m_Values.size());
+        }
+
+        iterator begin() noexcept
+        {
+            return { this, 0 };
+        }
+
+        iterator end() noexcept
+        {
+            return { this, size() };
+        }
+
+        const_iterator begin() const noexcept
+        {
+            return { this, 0 };
+        }
+
+        const_iterator end() const noexcept
+        {
+            return { this, size() };
+        }
+
+    private:
+        std::vector<T>         m_Values;  //!< Arena
+        std::vector<size_type> m_Offsets; //!< Sequence boundaries
+    };
+} // namespace Program::Helpers
+
+#endif // __HELPER_RAGGED_ARRAY_HPP__
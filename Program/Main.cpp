@@ -1,18 +1,155 @@
 #include "Main.hpp"
 
+namespace
+{
+    /**
+     * @brief Parse a whole argument as an unsigned decimal number.
+     * @param argument The argument.
+     * @return The number, or nothing if the argument is empty, has other characters than digits or is out of range.
+     */
+    std::optional<std::uint64_t> ParseNumber(const std::string_view argument) noexcept
+    {
+        std::uint64_t value    = 0;
+        const auto    last     = argument.data() + argument.size();
+        const auto [end, code] = std::from_chars(argument.data(), last, value);
+
+        if ( code != std::errc{} || end != last )
+        {
+            return std::nullopt;
+        }
+
+        return value;
+    }
+
+    /**
+     * @brief Print the command line usage.
+     * @param program The program name.
+     * @return EXIT_FAILURE, to return from main.
+     */
+    int32_t PrintUsage(const char* program) noexcept
+    {
+        printf("Usage: %s [seed]\n", program);
+        printf("       %s --corpus <file>\n", program);
+        printf("       %s --self-check\n", program);
+        printf("       %s --write-corpus <file> [records]\n", program);
+        printf("       %s --benchmark-search [patterns] [sources]\n", program);
+        printf("       %s --search-file <file> <pattern>\n", program);
+        return EXIT_FAILURE;
+    }
+} // namespace
+
 int32_t main([[maybe_unused]] const int32_t argc, [[maybe_unused]] const char* argv[])
 {
     printf("C++ Version: %lu\n", __cplusplus);
 
+    if ( argc > 1 && std::string_view{ argv[1] } == "--self-check" )
+    {
+        bool passed = true;
+
+        for ( const std::string_view name : { "reference", "thread-local", "simd", "seeded" } )
+        {
+            const bool result = Program::Module::DataGeneratorSelfCheck::CheckBoundedNumbers(*Program::Module::DataGeneratorFactory::Create(name));
+            printf("Bounded numbers (%s): %s\n", name.data(), result ? "uniform" : "BIASED");
+            passed = passed && result;
+        }
+
+        return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    if ( argc > 2 && std::string_view{ argv[1] } == "--write-corpus" )
+    {
+        const auto count = argc > 3 ? ParseNumber(argv[3]) : std::optional<std::uint64_t>{ 100000 };
+
+        if ( not count )
+        {
+            return PrintUsage(argv[0]);
+        }
+
+        const bool written = Program::Module::DataGeneratorCorpus::Write(argv[2], *Program::Module::DataGeneratorFactory::Create(Program::Module::DataGeneratorType::ThreadLocal), *count, 1, 100);
+        printf("Corpus (%llu records): %s\n", static_cast<unsigned long long>(*count), written ? "written" : "FAILED");
+        return written ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    if ( argc > 1 && std::string_view{ argv[1] } == "--benchmark-search" )
+    {
+        const auto pattern_count = argc > 2 ? ParseNumber(argv[2]) : std::optional<std::uint64_t>{ 100 };
+        const auto source_count  = argc > 3 ? ParseNumber(argv[3]) : std::optional<std::uint64_t>{ 100000 };
+
+        if ( not pattern_count || not source_count )
+        {
+            return PrintUsage(argv[0]);
+        }
+
+        for ( const auto& result : Program::Module::DataSearchBenchmark::Run(*pattern_count, *source_count, 1) )
+        {
+            printf("%-26s %10.1f ms %10llu matches\n", result.m_Name.data(), result.m_Time.count(), static_cast<unsigned long long>(result.m_Matches));
+        }
+
+        return EXIT_SUCCESS;
+    }
+
+    if ( argc > 3 && std::string_view{ argv[1] } == "--search-file" )
+    {
+        const auto file    = Program::Module::DataFileSearcher::Open(argv[2]);
+        const auto pattern = Program::Helpers::parse_masked_bytes(argv[3]);
+
+        if ( not file || not pattern )
+        {
+            printf("Search: %s\n", file ? "INVALID PATTERN" : "CANNOT MAP FILE");
+            return EXIT_FAILURE;
+        }
+
+        const auto compiled = Program::Module::DataSearchEngineFactory::Create()->Compile(*pattern);
+        const auto first    = file->Search(*compiled);
+        const auto offsets  = file->FindAll(*compiled);
+
+        printf("File size: %zu bytes\n", file->GetData().size());
+        printf("First match: %lld\n", first ? static_cast<long long>(*first) : -1LL);
+        printf("Matches: %zu\n", offsets.size());
+        return EXIT_SUCCESS;
+    }
+
     auto module = Program::Module::ModuleFactory::Create();
 
-    module->SetGenerator(Program::Module::DataGeneratorFactory::Create());
+    if ( argc > 2 && std::string_view{ argv[1] } == "--corpus" )
+    {
+        auto corpus = Program::Module::DataGeneratorFactory::CreateCorpus(argv[2], Program::Module::CorpusReplayMode::Sequential); //!< Replay recorded sequences
+
+        if ( corpus == nullptr )
+        {
+            printf("Corpus: CANNOT MAP FILE\n");
+            return EXIT_FAILURE;
+        }
+
+        module->SetGenerator(std::move(corpus));
+    }
+    else if ( argc > 1 )
+    {
+        const auto seed = ParseNumber(argv[1]);
+
+        if ( not seed )
+        {
+            return PrintUsage(argv[0]);
+        }
+
+        module->SetGenerator(Program::Module::DataGeneratorFactory::CreateSeeded(*seed)); //!< Replay a previous run from its seed.
+    }
+    else
+    {
+        module->SetGenerator(Program::Module::DataGeneratorFactory::Create(Program::Module::DataGeneratorType::Seeded));
+    }
+
     module->SetSearchEngine(Program::Module::DataSearchEngineFactory::Create());
     module->SetPrintingEngine(Program::Module::DataPrintingEngineFactory::Create());
 
     printf("Running...\n");
     module->RunAsync();
 
+    if ( const auto seed = module->GetSeed() )
+    {
+        printf("Seed: %llu\n", static_cast<unsigned long long>(*seed));
+    }
+
     printf("Waiting for 100 seconds...\n");
     module->WaitForAsync(std::chrono::seconds{ 100 });
 
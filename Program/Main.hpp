@@ -2,9 +2,15 @@
 
 #include "Module/ModuleFactory.hpp"
 #include "Module/DataGeneratorFactory.hpp"
+#include "Module/DataGeneratorSelfCheck.hpp"
 #include "Module/DataSearchEngineFactory.hpp"
+#include "Module/DataSearchBenchmark.hpp"
+#include "Module/DataFileSearcher.hpp"
 #include "Module/DataPrintingEngineFactory.hpp"
 
+#include <charconv>
 #include <iostream>
 #include <iomanip>
+#include <optional>
 #include <string>
+#include <string_view>
@@ -0,0 +1,42 @@
+#include "TestSupport.hpp"
+#include "Module/DataSearchEngineFactory.hpp"
+#include "Module/IMultiPatternSearchEngine.hpp"
+
+/**
+ * @brief Check the Aho-Corasick pattern sets against a naive search of every pattern
+ * @note Small alphabets make patterns that are prefixes and suffixes of each other, which is what the failure and output
+ * links handle. Sets of up to 150 patterns span several words of the Match bitset.
+ */
+int32_t main()
+{
+    Program::Tests::TestContext context{ "AhoCorasickSearch", 9 };
+    const auto                  engine               = Program::Module::DataSearchEngineFactory::Create(Program::Module::DataSearchEngineType::AhoCorasick);
+    const auto&                 multi_pattern_engine = dynamic_cast<const Program::Module::IMultiPatternSearchEngine&>(*engine);
+
+    for ( std::size_t iteration = 0; iteration < 3000; ++iteration )
+    {
+        const std::size_t                  alphabet = context.GetRandomNumber(1, iteration % 2 == 0 ? 256 : 3);
+        std::vector<Program::Tests::Bytes> patterns(context.GetRandomNumber(0, iteration % 5 == 0 ? 150 : 20));
+
+        for ( auto& pattern : patterns )
+        {
+            pattern = context.GetRandomBytes(context.GetRandomNumber(0, iteration % 3 == 0 ? 40 : 6), alphabet); //!< Empty patterns included: they never match
+        }
+
+        const auto set = multi_pattern_engine.Compile(patterns);
+
+        for ( std::size_t source_index = 0; source_index < 5; ++source_index )
+        {
+            Program::Tests::Bytes source = context.GetRandomBytes(context.GetRandomNumber(0, 300), alphabet);
+
+            if ( not patterns.empty() && source_index % 2 == 0 )
+            {
+                context.Plant(source, patterns[context.GetRandomNumber(0, patterns.size() - 1)]);
+            }
+
+            Program::Tests::ExpectPatternSet(context, *set, patterns, source, iteration);
+        }
+    }
+
+    return context.Finish();
+}
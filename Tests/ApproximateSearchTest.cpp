@@ -0,0 +1,181 @@
+#include "TestSupport.hpp"
+#include "Module/DataSearchEngineFactory.hpp"
+#include "Module/IApproximateSearchEngine.hpp"
+
+namespace
+{
+    /**
+     * @brief Edit distances of a pattern against every substring that ends at one place, by dynamic programming
+     * @param pattern The pattern
+     * @param source The source data
+     * @param end The end of the substrings, exclusive
+     * @return Element t is the Levenshtein distance between the pattern and the t bytes that end at end
+     */
+    std::vector<std::size_t> GetDistancesEndingAt(const Program::Tests::Bytes& pattern, const Program::Tests::Bytes& source, const std::size_t end) noexcept
+    {
+        // Both strings are read backwards from their ends: row i of column t compares the last i pattern bytes to the last t bytes.
+        std::vector<std::size_t> column(pattern.size() + 1);
+        std::vector<std::size_t> distances(end + 1);
+
+        for ( std::size_t row = 0; row <= pattern.size(); ++row )
+        {
+            column[row] = row;
+        }
+
+        distances[0] = column.back();
+
+        for ( std::size_t length = 1; length <= end; ++length )
+        {
+            std::size_t diagonal = column[0];
+            column[0]            = length;
+
+            for ( std::size_t row = 1; row <= pattern.size(); ++row )
+            {
+                const std::size_t above = column[row];
+                column[row]             = std::min({ above + 1, column[row - 1] + 1, diagonal + (pattern[pattern.size() - row] != source[end - length] ? 1 : 0) });
+                diagonal                = above;
+            }
+
+            distances[length] = column.back();
+        }
+
+        return distances;
+    }
+
+    /**
+     * @brief Best edit distance of a pattern against a substring ending at every place, by dynamic programming
+     * @param pattern The pattern
+     * @param source The source data
+     * @return Element j is the smallest Levenshtein distance between the pattern and a substring that ends at j, exclusive
+     */
+    std::vector<std::size_t> GetBestDistances(const Program::Tests::Bytes& pattern, const Program::Tests::Bytes& source) noexcept
+    {
+        // Sellers' algorithm: row 0 is all zeros, so a match may start anywhere.
+        std::vector<std::size_t> column(pattern.size() + 1);
+        std::vector<std::size_t> distances(source.size() + 1);
+
+        for ( std::size_t row = 0; row <= pattern.size(); ++row )
+        {
+            column[row] = row;
+        }
+
+        distances[0] = column.back();
+
+        for ( std::size_t end = 1; end <= source.size(); ++end )
+        {
+            std::size_t diagonal = column[0];
+
+            for ( std::size_t row = 1; row <= pattern.size(); ++row )
+            {
+                const std::size_t above = column[row];
+                column[row]             = std::min({ above + 1, column[row - 1] + 1, diagonal + (pattern[row - 1] != source[end - 1] ? 1 : 0) });
+                diagonal                = above;
+            }
+
+            distances[end] = column.back();
+        }
+
+        return distances;
+    }
+
+    /**
+     * @brief Expected Levenshtein match, see IApproximateSearchEngine::Search
+     * @return The match that ends first, moved forward while the distance decreases, on the shortest substring at that distance
+     */
+    std::optional<Program::Module::ApproximateMatch> SearchLevenshtein(const Program::Tests::Bytes& pattern, const Program::Tests::Bytes& source, const std::size_t max_distance) noexcept
+    {
+        const auto  distances = GetBestDistances(pattern, source);
+        std::size_t end       = 1;
+
+        while ( end <= source.size() && distances[end] > max_distance )
+        {
+            ++end;
+        }
+
+        if ( pattern.empty() || end > source.size() )
+        {
+            return std::nullopt;
+        }
+
+        while ( end < source.size() && distances[end + 1] < distances[end] )
+        {
+            ++end;
+        }
+
+        const auto  lengths = GetDistancesEndingAt(pattern, source, end);
+        std::size_t length  = 0;
+
+        while ( lengths[length] != distances[end] )
+        {
+            ++length;
+        }
+
+        return Program::Module::ApproximateMatch{ end - length, length, distances[end] };
+    }
+
+    /**
+     * @brief Expected Hamming match, by brute force
+     * @return The leftmost substring of the pattern length within the maximum distance
+     */
+    std::optional<Program::Module::ApproximateMatch> SearchHamming(const Program::Tests::Bytes& pattern, const Program::Tests::Bytes& source, const std::size_t max_distance) noexcept
+    {
+        for ( std::size_t offset = 0; not pattern.empty() && offset + pattern.size() <= source.size(); ++offset )
+        {
+            std::size_t distance = 0;
+
+            for ( std::size_t index = 0; index < pattern.size(); ++index )
+            {
+                distance += pattern[index] != source[offset + index] ? 1 : 0;
+            }
+
+            if ( distance <= max_distance )
+            {
+                return Program::Module::ApproximateMatch{ offset, pattern.size(), distance };
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Whether two optional matches are equal
+     */
+    bool IsSameMatch(const std::optional<Program::Module::ApproximateMatch>& left, const std::optional<Program::Module::ApproximateMatch>& right) noexcept
+    {
+        return left.has_value() == right.has_value() && (not left || (left->offset == right->offset && left->length == right->length && left->distance == right->distance));
+    }
+} // namespace
+
+/**
+ * @brief Check the Shift-And (Hamming) and Myers (Levenshtein) searches against dynamic programming
+ * @note Patterns up to 200 bytes span several machine words. Both the engine searches and the compiled patterns are checked.
+ */
+int32_t main()
+{
+    Program::Tests::TestContext context{ "ApproximateSearch", 19 };
+    const auto                  engine             = Program::Module::DataSearchEngineFactory::Create(Program::Module::DataSearchEngineType::Approximate);
+    const auto&                 approximate_engine = dynamic_cast<const Program::Module::IApproximateSearchEngine&>(*engine);
+
+    for ( std::size_t iteration = 0; iteration < 10000; ++iteration )
+    {
+        const std::size_t           alphabet     = context.GetRandomNumber(2, 4);
+        const Program::Tests::Bytes pattern      = context.GetRandomBytes(context.GetRandomNumber(0, iteration % 5 == 0 ? 200 : 70), alphabet);
+        Program::Tests::Bytes       source       = context.GetRandomBytes(context.GetRandomNumber(0, 260), alphabet);
+        const std::size_t           max_distance = context.GetRandomNumber(0, 5);
+
+        if ( iteration % 3 == 0 )
+        {
+            context.Plant(source, pattern);
+        }
+
+        const auto hamming     = SearchHamming(pattern, source, std::min(max_distance, pattern.size()));
+        const auto levenshtein = SearchLevenshtein(pattern, source, std::min(max_distance, pattern.empty() ? 0 : pattern.size() - 1));
+
+        context.Expect(IsSameMatch(approximate_engine.Search(source, pattern, max_distance, Program::Module::ApproximateMetric::Hamming), hamming), "Shift-And search", iteration);
+        context.Expect(IsSameMatch(approximate_engine.Compile(pattern, max_distance, Program::Module::ApproximateMetric::Hamming)->Search(source), hamming), "compiled Shift-And search", iteration);
+        context.Expect(IsSameMatch(approximate_engine.Search(source, pattern, max_distance, Program::Module::ApproximateMetric::Levenshtein), levenshtein), "Myers search", iteration);
+        context.Expect(IsSameMatch(approximate_engine.Compile(pattern, max_distance, Program::Module::ApproximateMetric::Levenshtein)->Search(source), levenshtein), "compiled Myers search", iteration);
+    }
+
+    return context.Finish();
+}
@@ -0,0 +1,71 @@
+#include "TestSupport.hpp"
+#include "Module/DataSearchEngineFactory.hpp"
+#include "Module/DataSearchPlanner.hpp"
+#include "Module/DataSearchBatch.hpp"
+
+/**
+ * @brief Check the batched searches against a naive search of every source
+ * @note Every set is checked on its own against the naive search first, then the batch answers must be the ones of the set
+ * on every source. Batches of up to 1000 sources span several blocks of the workers.
+ */
+int32_t main()
+{
+    Program::Tests::TestContext context{ "BatchSearch", 24 };
+
+    for ( const auto type : { Program::Module::DataSearchEngineType::AhoCorasick, Program::Module::DataSearchEngineType::RabinKarp, Program::Module::DataSearchEngineType::Teddy } )
+    {
+        const auto engine = Program::Module::DataSearchEngineFactory::Create(type);
+
+        for ( std::size_t iteration = 0; iteration < 40; ++iteration )
+        {
+            const std::size_t                  alphabet = context.GetRandomNumber(2, iteration % 2 == 0 ? 256 : 4);
+            std::vector<Program::Tests::Bytes> patterns(context.GetRandomNumber(1, iteration % 4 == 0 ? 100 : 20));
+
+            for ( auto& pattern : patterns )
+            {
+                pattern = context.GetRandomBytes(context.GetRandomNumber(1, 8), alphabet);
+            }
+
+            const auto                                set = Program::Module::DataSearchPlanner::Compile(*engine, patterns);
+            Program::Helpers::ragged_array<std::byte> sources;
+
+            for ( std::size_t count = context.GetRandomNumber(0, 1000); count > 0; --count )
+            {
+                Program::Tests::Bytes source = context.GetRandomBytes(context.GetRandomNumber(0, 100), alphabet);
+
+                if ( count % 3 == 0 )
+                {
+                    context.Plant(source, patterns[context.GetRandomNumber(0, patterns.size() - 1)]);
+                }
+
+                Program::Tests::ExpectPatternSet(context, *set, patterns, source, iteration);
+                sources.push_back(source);
+            }
+
+            const std::size_t words = Program::Module::DataSearchBatch::GetWordCount(*set);
+
+            context.Expect(words == (patterns.size() + 63) / 64, "GetWordCount", iteration);
+
+            for ( const std::size_t thread_count : { 1, 2, 3, 0 } )
+            {
+                const auto results = Program::Module::DataSearchBatch::Search(*set, sources, thread_count);
+                const auto matches = Program::Module::DataSearchBatch::Match(*set, sources, thread_count);
+                bool       same    = results.size() == sources.size() && matches.size() == sources.size() * words;
+
+                for ( std::size_t index = 0; same && index < sources.size(); ++index )
+                {
+                    const auto                 expected = set->Search(sources[index]);
+                    std::vector<std::uint64_t> expected_matches(words, 0);
+
+                    set->Match(sources[index], expected_matches);
+                    same = results[index].has_value() == expected.has_value() && (not expected || (results[index]->offset == expected->offset && results[index]->pattern == expected->pattern))
+                           && std::ranges::equal(std::span<const std::uint64_t>{ matches }.subspan(index * words, words), expected_matches);
+                }
+
+                context.Expect(same, "batch answers", iteration);
+            }
+        }
+    }
+
+    return context.Finish();
+}
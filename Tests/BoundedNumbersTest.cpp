@@ -0,0 +1,81 @@
+#include "TestSupport.hpp"
+#include "Module/DataGeneratorFactory.hpp"
+#include "Module/DataGeneratorSelfCheck.hpp"
+#include "Module/Internal/BoundedNumber.hpp"
+
+namespace
+{
+    /**
+     * @brief Bounded number by the definition of Lemire's method, see GetBoundedNumber
+     * @param width Range width, 0 for the full 32-bit range
+     * @param values The 32-bit random values to draw from
+     * @param used Set to the number of values drawn
+     * @return The high half of the first product whose low half is not below 2^32 mod width
+     */
+    std::uint32_t GetBoundedNumberReference(const std::uint32_t width, const std::vector<std::uint32_t>& values, std::size_t& used) noexcept
+    {
+        const std::uint64_t threshold = width == 0 ? 0 : (std::uint64_t{ 1 } << 32) % width;
+
+        for ( used = 1; used <= values.size(); ++used )
+        {
+            const std::uint64_t product = static_cast<std::uint64_t>(values[used - 1]) * (width == 0 ? std::uint64_t{ 1 } << 32 : width);
+
+            if ( (product & UINT32_MAX) >= threshold )
+            {
+                return static_cast<std::uint32_t>(product >> 32);
+            }
+        }
+
+        return 0;
+    }
+} // namespace
+
+/**
+ * @brief Check the unbiased bounded numbers against the definition of Lemire's method and the bounds of every engine generator
+ * @note The scripted values hold zeros and small values, which are the rejected ones for most widths. Every generator must
+ * stay in range on the extreme ranges and pass the chi-square self-check.
+ */
+int32_t main()
+{
+    Program::Tests::TestContext context{ "BoundedNumbers", 6 };
+
+    for ( std::size_t iteration = 0; iteration < 100000; ++iteration )
+    {
+        const auto                 width = static_cast<std::uint32_t>(iteration % 3 == 0 ? context.GetRandomNumber(0, 1000) : context.GetRandomNumber(0, UINT32_MAX));
+        std::vector<std::uint32_t> values(context.GetRandomNumber(1, 4));
+
+        for ( std::uint32_t& value : values )
+        {
+            value = static_cast<std::uint32_t>(context.GetRandomNumber(0, 3) == 0 ? context.GetRandomNumber(0, 3) : context.GetRandomNumber(0, UINT32_MAX));
+        }
+
+        values.push_back(UINT32_MAX); //!< Never rejected: its low half is 2^32 - width
+
+        std::size_t         used     = 0;
+        std::size_t         drawn    = 0;
+        const std::uint32_t expected = GetBoundedNumberReference(width, values, used);
+        const std::uint32_t found    = Program::Module::Internal::GetBoundedNumber(width, [&values, &drawn]() noexcept { return values[drawn++]; });
+
+        context.Expect(found == expected && drawn == used, "bounded number", iteration);
+    }
+
+    for ( const auto type : { Program::Module::DataGeneratorType::ThreadLocal, Program::Module::DataGeneratorType::Simd, Program::Module::DataGeneratorType::Seeded } )
+    {
+        const auto                                     generator = Program::Module::DataGeneratorFactory::Create(type);
+        const std::vector<std::pair<int32_t, int32_t>> ranges{ { INT32_MIN, INT32_MAX }, { INT32_MIN, INT32_MIN }, { INT32_MAX, INT32_MAX }, { INT32_MIN, 0 }, { -1, INT32_MAX }, { -1, 0 } };
+        std::vector<std::int32_t>                      numbers(100);
+
+        for ( std::size_t index = 0; index < ranges.size(); ++index )
+        {
+            const auto [min, max] = ranges[index];
+            const auto number     = generator->GetRandomNumber(min, max);
+
+            generator->FillRandomNumbers(numbers, min, max);
+            context.Expect(number >= min && number <= max && std::ranges::all_of(numbers, [min, max](const std::int32_t value) { return value >= min && value <= max; }), "extreme range", index);
+        }
+
+        context.Expect(Program::Module::DataGeneratorSelfCheck::CheckBoundedNumbers(*generator), "chi-square self-check", static_cast<std::size_t>(type));
+    }
+
+    return context.Finish();
+}
@@ -0,0 +1,66 @@
+#include "TestSupport.hpp"
+#include "Module/DataSearchEngineFactory.hpp"
+#include "Module/DataSearchPlanner.hpp"
+#include "Module/Internal/ByteFingerprint.hpp"
+#include <bitset>
+
+/**
+ * @brief Check the byte fingerprints against the byte sets of the data, and the fingerprinted pattern sets against a naive search
+ * @note A fingerprint may only reject a pattern that is longer than the data or has a byte the data lacks. The planned sets
+ * hold many long patterns, so the fingerprints of every one of them screen the sources before the engine set.
+ */
+int32_t main()
+{
+    Program::Tests::TestContext context{ "ByteFingerprint", 15 };
+
+    for ( std::size_t iteration = 0; iteration < 100000; ++iteration )
+    {
+        const std::size_t           alphabet = context.GetRandomNumber(1, iteration % 2 == 0 ? 256 : 20);
+        const Program::Tests::Bytes data     = context.GetRandomBytes(context.GetRandomNumber(0, 100), alphabet);
+        const Program::Tests::Bytes pattern  = context.GetRandomBytes(context.GetRandomNumber(0, 12), alphabet);
+        std::bitset<256>            present;
+
+        for ( const std::byte value : data )
+        {
+            present.set(std::to_integer<std::size_t>(value));
+        }
+
+        const bool                                       expected = pattern.size() <= data.size() && std::ranges::all_of(pattern, [&present](const std::byte value) { return present.test(std::to_integer<std::size_t>(value)); });
+        const Program::Module::Internal::ByteFingerprint fingerprint{ data };
+
+        context.Expect(fingerprint.MayContain(Program::Module::Internal::ByteFingerprint{ pattern }) == expected, "MayContain", iteration);
+        context.Expect(fingerprint.GetSize() == data.size(), "GetSize", iteration);
+    }
+
+    for ( const auto type : { Program::Module::DataSearchEngineType::AhoCorasick, Program::Module::DataSearchEngineType::RabinKarp } )
+    {
+        const auto engine = Program::Module::DataSearchEngineFactory::Create(type);
+
+        for ( std::size_t iteration = 0; iteration < 500; ++iteration )
+        {
+            const std::size_t                  alphabet = context.GetRandomNumber(2, iteration % 2 == 0 ? 256 : 16);
+            std::vector<Program::Tests::Bytes> patterns(context.GetRandomNumber(1, 100));
+
+            for ( auto& pattern : patterns )
+            {
+                pattern = context.GetRandomBytes(context.GetRandomNumber(3, 40), alphabet);
+            }
+
+            const auto set = Program::Module::DataSearchPlanner::Compile(*engine, patterns);
+
+            for ( std::size_t source_index = 0; source_index < 10; ++source_index )
+            {
+                Program::Tests::Bytes source = context.GetRandomBytes(context.GetRandomNumber(0, 120), context.GetRandomNumber(1, alphabet));
+
+                if ( source_index % 3 == 0 )
+                {
+                    context.Plant(source, patterns[context.GetRandomNumber(0, patterns.size() - 1)]);
+                }
+
+                Program::Tests::ExpectPatternSet(context, *set, patterns, source, iteration);
+            }
+        }
+    }
+
+    return context.Finish();
+}
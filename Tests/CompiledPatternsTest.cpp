@@ -0,0 +1,47 @@
+#include "TestSupport.hpp"
+#include "Module/DataSearchEngineFactory.hpp"
+
+/**
+ * @brief Check the compiled patterns of every engine against a naive search
+ * @note A compiled pattern is searched on its own, through its engine, and against the one-shot search of the same pattern,
+ * on the vector and span APIs. One pattern is searched in several sources, as the tables are built once for all of them.
+ */
+int32_t main()
+{
+    Program::Tests::TestContext context{ "CompiledPatterns", 10 };
+
+    for ( const auto type : { Program::Module::DataSearchEngineType::BoyerMoore, Program::Module::DataSearchEngineType::AhoCorasick, Program::Module::DataSearchEngineType::Simd, Program::Module::DataSearchEngineType::Adaptive,
+                              Program::Module::DataSearchEngineType::RabinKarp, Program::Module::DataSearchEngineType::Approximate, Program::Module::DataSearchEngineType::Teddy } )
+    {
+        const auto engine = Program::Module::DataSearchEngineFactory::Create(type);
+
+        for ( std::size_t iteration = 0; iteration < 2000; ++iteration )
+        {
+            const std::size_t           alphabet = context.GetRandomNumber(1, iteration % 2 == 0 ? 256 : 3);
+            const Program::Tests::Bytes pattern  = context.GetRandomBytes(context.GetRandomNumber(0, iteration % 4 == 0 ? 300 : 20), alphabet);
+            const auto                  compiled = engine->Compile(pattern);
+
+            context.Expect(compiled->GetPattern() == pattern, "compiled pattern", iteration);
+
+            for ( std::size_t source_index = 0; source_index < 4; ++source_index )
+            {
+                Program::Tests::Bytes source = context.GetRandomBytes(context.GetRandomNumber(0, 400), alphabet);
+
+                if ( source_index % 2 == 0 )
+                {
+                    context.Plant(source, pattern);
+                }
+
+                const auto offsets  = Program::Tests::FindAllNaive(source, pattern);
+                const auto expected = offsets.empty() ? std::nullopt : std::optional{ static_cast<int32_t>(offsets.front()) };
+
+                context.Expect(compiled->Search(source) == expected, "compiled search", iteration);
+                context.Expect(compiled->Search(std::span<const std::byte>{ source }) == (offsets.empty() ? std::nullopt : std::optional{ offsets.front() }), "compiled span search", iteration);
+                context.Expect(engine->Search(source, *compiled) == expected, "engine search of the compiled pattern", iteration);
+                context.Expect(engine->Search(source, pattern) == expected, "one-shot search", iteration);
+            }
+        }
+    }
+
+    return context.Finish();
+}
@@ -0,0 +1,138 @@
+#include "TestSupport.hpp"
+#include "Module/DataGeneratorFactory.hpp"
+#include <filesystem>
+#include <fstream>
+
+namespace
+{
+    /**
+     * @brief Sequential replay of the records of a corpus, by the definition of the corpus generator
+     */
+    class CorpusReplay final
+    {
+    public:
+        /**
+         * @brief Constructor
+         * @param records The records, at least one of them not empty
+         */
+        explicit CorpusReplay(const std::vector<Program::Tests::Bytes>& records) noexcept
+            : m_Records{ records }
+            , m_Cursor{ 0 }
+        {
+        }
+
+        /**
+         * @brief The next record, wrapping around
+         */
+        const Program::Tests::Bytes& GetNextRecord() noexcept
+        {
+            return m_Records[m_Cursor++ % m_Records.size()];
+        }
+
+        /**
+         * @brief Bytes of a span fill: the next records, empty ones skipped, concatenated and cut at size bytes
+         */
+        Program::Tests::Bytes GetBytes(const std::size_t size) noexcept
+        {
+            Program::Tests::Bytes bytes;
+
+            while ( bytes.size() < size )
+            {
+                const auto& record = GetNextRecord();
+                bytes.insert(bytes.end(), record.cbegin(), record.cbegin() + static_cast<std::ptrdiff_t>(std::min(record.size(), size - bytes.size())));
+            }
+
+            return bytes;
+        }
+
+        /**
+         * @brief Bytes of a ranged fill: the next record, completed with the following ones up to min_count, cut at max_count
+         */
+        Program::Tests::Bytes GetBytes(const std::size_t min_count, const std::size_t max_count) noexcept
+        {
+            const auto&           record = GetNextRecord();
+            const std::size_t     size   = std::clamp(record.size(), min_count, max_count);
+            Program::Tests::Bytes bytes{ record.cbegin(), record.cbegin() + static_cast<std::ptrdiff_t>(std::min(size, record.size())) };
+            const auto            tail   = GetBytes(size - bytes.size());
+
+            bytes.insert(bytes.end(), tail.cbegin(), tail.cend());
+            return bytes;
+        }
+
+    private:
+        const std::vector<Program::Tests::Bytes>& m_Records; //!< The records
+        std::size_t                               m_Cursor;  //!< Index of the next record, before wrapping
+    };
+} // namespace
+
+/**
+ * @brief Check the corpus replay generator against the records written with DataGeneratorCorpus::Write
+ * @note Sequential replay must follow a model of the records through random span, ranged and arena fills; random replay
+ * must only yield records. Files that are missing or not corpus files must be refused.
+ */
+int32_t main()
+{
+    const auto                  path = std::filesystem::temp_directory_path() / "CorpusReplayTest.corpus";
+    Program::Tests::TestContext context{ "CorpusReplay", 7 };
+
+    for ( std::size_t iteration = 0; iteration < 200; ++iteration )
+    {
+        std::vector<Program::Tests::Bytes>        records(context.GetRandomNumber(1, 40));
+        Program::Helpers::ragged_array<std::byte> sequences;
+
+        for ( auto& record : records )
+        {
+            record = context.GetRandomBytes(context.GetRandomNumber(0, 3) == 0 ? 0 : context.GetRandomNumber(1, 100), 256);
+        }
+
+        records[context.GetRandomNumber(0, records.size() - 1)].push_back(std::byte{ 1 }); //!< Not only empty records: those fall back to the random source
+
+        for ( const auto& record : records )
+        {
+            sequences.push_back(record);
+        }
+
+        context.Expect(Program::Module::DataGeneratorCorpus::Write(path, sequences), "write", iteration);
+
+        const auto   generator = Program::Module::DataGeneratorFactory::CreateCorpus(path, Program::Module::CorpusReplayMode::Sequential, Program::Module::DataGeneratorFactory::CreateSeeded(iteration));
+        const auto   stream    = generator->CreateStream(1);
+        CorpusReplay replay{ records };
+
+        generator->FillRandomSequences(sequences, records.size(), 0, 128);
+        context.Expect(std::ranges::equal(sequences, records, [](const auto& left, const auto& right) { return std::ranges::equal(left, right); }), "records in file order", iteration);
+
+        for ( std::size_t step = 0; step < 20; ++step )
+        {
+            const std::size_t     min_count = context.GetRandomNumber(0, 150);
+            const std::size_t     max_count = context.GetRandomNumber(min_count, 150);
+            Program::Tests::Bytes buffer;
+
+            switch ( context.GetRandomNumber(0, 2) )
+            {
+                case 0:
+                    context.Expect(generator->GetRandomBytes(max_count) == replay.GetBytes(max_count), "span fill", iteration);
+                    break;
+
+                case 1:
+                    context.Expect(std::ranges::equal(stream->FillRandomBytes(buffer, min_count, max_count), replay.GetBytes(min_count, max_count)), "ranged fill of a stream", iteration);
+                    break;
+
+                default:
+                    generator->FillRandomSequences(sequences, 1, min_count, max_count);
+                    context.Expect(std::ranges::equal(sequences[0], replay.GetBytes(min_count, max_count)), "arena fill", iteration);
+                    break;
+            }
+        }
+
+        const auto random = Program::Module::DataGeneratorFactory::CreateCorpus(path, Program::Module::CorpusReplayMode::Random);
+        random->FillRandomSequences(sequences, 50, 0, 128);
+        context.Expect(std::ranges::all_of(sequences, [&records](const auto& sequence) { return std::ranges::any_of(records, [sequence](const auto& record) { return std::ranges::equal(sequence, record); }); }), "random records", iteration);
+    }
+
+    std::ofstream{ path, std::ios::binary | std::ios::trunc } << "NOTACORPUS AT ALL";
+    context.Expect(Program::Module::DataGeneratorFactory::CreateCorpus(path, Program::Module::CorpusReplayMode::Sequential) == nullptr, "not a corpus file", 0);
+    std::filesystem::remove(path);
+    context.Expect(Program::Module::DataGeneratorFactory::CreateCorpus(path, Program::Module::CorpusReplayMode::Sequential) == nullptr, "missing file", 0);
+
+    return context.Finish();
+}
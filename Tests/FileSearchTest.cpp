@@ -0,0 +1,70 @@
+#include "TestSupport.hpp"
+#include "Module/DataSearchEngineFactory.hpp"
+#include "Module/DataFileSearcher.hpp"
+#include <filesystem>
+#include <fstream>
+
+/**
+ * @brief Check the multithreaded file search against a naive search
+ * @note The sources span several 1 MiB chunks, and occurrences are planted across the chunk boundaries, where a chunk only
+ * completes a match with its overlap. Some buffers are written to a file and searched through its mapping; missing and empty
+ * files are checked too.
+ */
+int32_t main()
+{
+    constexpr std::size_t       ChunkSize = std::size_t{ 1 } << 20; //!< The smallest chunk of the searcher
+    const auto                  path      = std::filesystem::temp_directory_path() / "FileSearchTest.bin";
+    Program::Tests::TestContext context{ "FileSearch", 22 };
+
+    for ( const auto type : { Program::Module::DataSearchEngineType::BoyerMoore, Program::Module::DataSearchEngineType::Simd, Program::Module::DataSearchEngineType::Adaptive, Program::Module::DataSearchEngineType::Teddy } )
+    {
+        const auto engine = Program::Module::DataSearchEngineFactory::Create(type);
+
+        for ( std::size_t iteration = 0; iteration < 8; ++iteration )
+        {
+            const std::size_t           alphabet = iteration % 2 == 0 ? 256 : 2;
+            const Program::Tests::Bytes pattern  = context.GetRandomBytes(context.GetRandomNumber(1, iteration % 2 == 0 ? 40 : 16), alphabet);
+            Program::Tests::Bytes       source   = context.GetRandomBytes(context.GetRandomNumber(0, 4 * ChunkSize), alphabet);
+
+            for ( std::size_t boundary = ChunkSize; boundary < source.size(); boundary += ChunkSize )
+            {
+                const std::size_t begin = boundary - context.GetRandomNumber(0, std::min(boundary, pattern.size()));
+
+                if ( begin + pattern.size() <= source.size() )
+                {
+                    std::copy(pattern.cbegin(), pattern.cend(), source.begin() + static_cast<std::ptrdiff_t>(begin));
+                }
+            }
+
+            const auto expected = Program::Tests::FindAllNaive(source, pattern);
+            const auto compiled = engine->Compile(pattern);
+
+            for ( const std::size_t thread_count : { 1, 2, 3, 0 } )
+            {
+                const auto found = Program::Module::DataFileSearcher::Search(source, *compiled, thread_count);
+
+                context.Expect(found.has_value() != expected.empty() && (not found || *found == expected.front()), "Search", iteration);
+                context.Expect(Program::Module::DataFileSearcher::FindAll(source, *compiled, thread_count) == expected, "FindAll", iteration);
+            }
+
+            if ( iteration % 4 == 0 )
+            {
+                std::ofstream{ path, std::ios::binary | std::ios::trunc }.write(reinterpret_cast<const char*>(source.data()), static_cast<std::streamsize>(source.size()));
+
+                const auto file = Program::Module::DataFileSearcher::Open(path);
+
+                context.Expect(file != nullptr && std::ranges::equal(file->GetData(), source), "mapped file", iteration);
+                context.Expect(file != nullptr && file->FindAll(*compiled, 0) == expected, "file FindAll", iteration);
+            }
+        }
+    }
+
+    std::ofstream{ path, std::ios::binary | std::ios::trunc }.flush();
+    const auto empty    = Program::Module::DataFileSearcher::Open(path);
+    const auto compiled = Program::Module::DataSearchEngineFactory::Create()->Compile(Program::Tests::Bytes{ std::byte{ 0 } });
+    context.Expect(empty != nullptr && empty->GetData().empty() && not empty->Search(*compiled, 0), "empty file", 0);
+    std::filesystem::remove(path);
+    context.Expect(Program::Module::DataFileSearcher::Open(path) == nullptr, "missing file", 0);
+
+    return context.Finish();
+}
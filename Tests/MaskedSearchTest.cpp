@@ -0,0 +1,65 @@
+#include "TestSupport.hpp"
+#include "Module/DataSearchEngineFactory.hpp"
+
+/**
+ * @brief Check the masked searches of every engine and instruction set tier against brute force
+ * @note The masks mix wildcards, partial masks and exact bytes; some sources get a planted occurrence with random ignored bits.
+ */
+int32_t main()
+{
+    Program::Tests::TestContext context{ "MaskedSearch", 20 };
+
+    for ( const auto tier : { Program::Helpers::cpu_tier::scalar, Program::Helpers::cpu_tier::sse2, Program::Helpers::cpu_tier::avx2, Program::Helpers::cpu_tier::avx512 } )
+    {
+        for ( const auto type : { Program::Module::DataSearchEngineType::BoyerMoore, Program::Module::DataSearchEngineType::Simd, Program::Module::DataSearchEngineType::Adaptive, Program::Module::DataSearchEngineType::AhoCorasick, Program::Module::DataSearchEngineType::Teddy } )
+        {
+            const auto engine = Program::Module::DataSearchEngineFactory::Create(type, tier);
+
+            for ( std::size_t iteration = 0; iteration < 2000; ++iteration )
+            {
+                const std::size_t                         alphabet = context.GetRandomNumber(1, iteration % 2 == 0 ? 256 : 4);
+                std::vector<Program::Helpers::masked_byte> pattern(context.GetRandomNumber(0, iteration % 7 == 0 ? 120 : 20));
+                Program::Tests::Bytes                      source = context.GetRandomBytes(context.GetRandomNumber(0, 300), alphabet);
+
+                for ( auto& element : pattern )
+                {
+                    const std::size_t kind = context.GetRandomNumber(0, 3);
+                    element.value          = static_cast<std::byte>(context.GetRandomNumber(0, alphabet - 1));
+                    element.mask           = kind == 0 ? std::byte{ 0x00 } : kind == 1 ? static_cast<std::byte>(context.GetRandomNumber(0, 255)) : std::byte{ 0xFF };
+                }
+
+                if ( not pattern.empty() && pattern.size() <= source.size() && iteration % 2 == 0 )
+                {
+                    const std::size_t offset = context.GetRandomNumber(0, source.size() - pattern.size());
+
+                    for ( std::size_t index = 0; index < pattern.size(); ++index )
+                    {
+                        source[offset + index] = (pattern[index].value & pattern[index].mask) | (static_cast<std::byte>(context.GetRandomNumber(0, 255)) & ~pattern[index].mask);
+                    }
+                }
+
+                const auto offsets = Program::Tests::FindAllNaive(source, pattern.size(),
+                                                                  [&source, &pattern](const std::size_t offset) noexcept
+                                                                  {
+                                                                      for ( std::size_t index = 0; index < pattern.size(); ++index )
+                                                                      {
+                                                                          if ( not pattern[index].matches(source[offset + index]) )
+                                                                          {
+                                                                              return false;
+                                                                          }
+                                                                      }
+
+                                                                      return true;
+                                                                  });
+                const auto compiled = engine->Compile(pattern);
+                const auto found    = compiled->Search(std::span<const std::byte>{ source });
+                const auto found32  = compiled->Search(source);
+
+                context.Expect(found.has_value() != offsets.empty() && (not found || *found == offsets.front()), "Search", iteration);
+                context.Expect(found32.has_value() != offsets.empty() && (not found32 || static_cast<std::uint64_t>(*found32) == offsets.front()), "Search (32-bit)", iteration);
+            }
+        }
+    }
+
+    return context.Finish();
+}
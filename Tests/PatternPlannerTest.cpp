@@ -0,0 +1,45 @@
+#include "TestSupport.hpp"
+#include "Module/DataSearchEngineFactory.hpp"
+#include "Module/DataSearchPlanner.hpp"
+
+/**
+ * @brief Check the planned pattern sets of every engine against a naive search of every pattern
+ * @note The sets mix the 1-byte and 2-byte patterns of the bitmap tiers with longer ones, so every query merges the tiers
+ * with the engine set; a single-pattern engine gets a list of compiled patterns instead.
+ */
+int32_t main()
+{
+    Program::Tests::TestContext context{ "PatternPlanner", 14 };
+
+    for ( const auto type : { Program::Module::DataSearchEngineType::BoyerMoore, Program::Module::DataSearchEngineType::AhoCorasick, Program::Module::DataSearchEngineType::RabinKarp, Program::Module::DataSearchEngineType::Teddy } )
+    {
+        const auto engine = Program::Module::DataSearchEngineFactory::Create(type);
+
+        for ( std::size_t iteration = 0; iteration < 1000; ++iteration )
+        {
+            const std::size_t                  alphabet = context.GetRandomNumber(1, iteration % 2 == 0 ? 256 : 4);
+            std::vector<Program::Tests::Bytes> patterns(context.GetRandomNumber(0, iteration % 5 == 0 ? 120 : 20));
+
+            for ( auto& pattern : patterns )
+            {
+                pattern = context.GetRandomBytes(context.GetRandomNumber(0, 2) == 0 ? context.GetRandomNumber(0, 30) : context.GetRandomNumber(1, 2), alphabet);
+            }
+
+            const auto set = Program::Module::DataSearchPlanner::Compile(*engine, patterns);
+
+            for ( std::size_t source_index = 0; source_index < 5; ++source_index )
+            {
+                Program::Tests::Bytes source = context.GetRandomBytes(context.GetRandomNumber(0, 300), alphabet == 256 ? 256 : alphabet + 1); //!< One more byte value than the patterns use: not every short pattern matches
+
+                if ( not patterns.empty() && source_index % 2 == 0 )
+                {
+                    context.Plant(source, patterns[context.GetRandomNumber(0, patterns.size() - 1)]);
+                }
+
+                Program::Tests::ExpectPatternSet(context, *set, patterns, source, iteration);
+            }
+        }
+    }
+
+    return context.Finish();
+}
@@ -0,0 +1,42 @@
+#include "TestSupport.hpp"
+#include "Module/DataSearchEngineFactory.hpp"
+#include "Module/IMultiPatternSearchEngine.hpp"
+
+/**
+ * @brief Check the Rabin-Karp pattern sets against a naive search of every pattern
+ * @note Pattern lengths span every prefix class, 1, 2, 4 and 8 bytes and the lengths in between. Small alphabets give many
+ * patterns the same key, so a key hit must still compare the rest of every pattern of its run.
+ */
+int32_t main()
+{
+    Program::Tests::TestContext context{ "RabinKarpSearch", 18 };
+    const auto                  engine               = Program::Module::DataSearchEngineFactory::Create(Program::Module::DataSearchEngineType::RabinKarp);
+    const auto&                 multi_pattern_engine = dynamic_cast<const Program::Module::IMultiPatternSearchEngine&>(*engine);
+
+    for ( std::size_t iteration = 0; iteration < 3000; ++iteration )
+    {
+        const std::size_t                  alphabet = context.GetRandomNumber(1, iteration % 2 == 0 ? 256 : 3);
+        std::vector<Program::Tests::Bytes> patterns(context.GetRandomNumber(0, iteration % 5 == 0 ? 150 : 20));
+
+        for ( auto& pattern : patterns )
+        {
+            pattern = context.GetRandomBytes(context.GetRandomNumber(0, iteration % 3 == 0 ? 40 : 12), alphabet); //!< Empty patterns included: they never match
+        }
+
+        const auto set = multi_pattern_engine.Compile(patterns);
+
+        for ( std::size_t source_index = 0; source_index < 5; ++source_index )
+        {
+            Program::Tests::Bytes source = context.GetRandomBytes(context.GetRandomNumber(0, 300), alphabet);
+
+            if ( not patterns.empty() && source_index % 2 == 0 )
+            {
+                context.Plant(source, patterns[context.GetRandomNumber(0, patterns.size() - 1)]);
+            }
+
+            Program::Tests::ExpectPatternSet(context, *set, patterns, source, iteration);
+        }
+    }
+
+    return context.Finish();
+}
@@ -0,0 +1,73 @@
+#include "TestSupport.hpp"
+#include "Module/DataGeneratorFactory.hpp"
+
+/**
+ * @brief Check the ragged batch generation of every generator type
+ * @note Every refill must leave count contiguous sequences of lengths in range, each one viewing its slice of the arena, and
+ * must reuse the arena. On a seeded generator the arena must hold what a twin draws the documented way: all the lengths,
+ * then all the bytes.
+ */
+int32_t main()
+{
+    Program::Tests::TestContext context{ "RaggedSequences", 5 };
+
+    for ( const auto type : { Program::Module::DataGeneratorType::Reference, Program::Module::DataGeneratorType::ThreadLocal, Program::Module::DataGeneratorType::Simd, Program::Module::DataGeneratorType::Seeded } )
+    {
+        const bool                                seeded    = type == Program::Module::DataGeneratorType::Seeded;
+        const auto                                generator = seeded ? Program::Module::DataGeneratorFactory::CreateSeeded(5) : Program::Module::DataGeneratorFactory::Create(type);
+        const auto                                twin      = Program::Module::DataGeneratorFactory::CreateSeeded(5);
+        const std::size_t                         cases     = type == Program::Module::DataGeneratorType::Reference ? 50 : 1000; //!< The reference generator reseeds on every call
+        Program::Helpers::ragged_array<std::byte> sequences;
+        Program::Helpers::ragged_array<std::byte> twin_sequences;
+
+        generator->FillRandomSequences(sequences, 64, 200, 200); //!< The largest arena of the cases: the next fills must not allocate
+        twin->FillRandomSequences(twin_sequences, 64, 200, 200);
+        const std::byte* const data = sequences.values().data();
+
+        for ( std::size_t iteration = 0; iteration < cases; ++iteration )
+        {
+            const std::size_t count      = context.GetRandomNumber(0, 64);
+            const std::size_t min_length = context.GetRandomNumber(0, 200);
+            const std::size_t max_length = context.GetRandomNumber(min_length, 200);
+
+            generator->FillRandomSequences(sequences, count, min_length, max_length);
+
+            const auto& offsets    = sequences.offsets();
+            bool        contiguous = sequences.size() == count && offsets.size() == count + 1 && offsets.front() == 0 && offsets.back() == sequences.values().size();
+            bool        in_range   = true;
+
+            for ( std::size_t index = 0; contiguous && index < count; ++index )
+            {
+                contiguous = sequences[index].data() == sequences.values().data() + offsets[index] && sequences[index].size() == offsets[index + 1] - offsets[index];
+                in_range   = in_range && sequences[index].size() >= min_length && sequences[index].size() <= max_length;
+            }
+
+            context.Expect(contiguous, "contiguous sequences", iteration);
+            context.Expect(in_range, "sequence lengths", iteration);
+            context.Expect(sequences.values().data() == data, "arena reuse", iteration);
+
+            if ( seeded )
+            {
+                std::vector<std::size_t> lengths(count);
+                std::size_t              total = 0;
+
+                for ( std::size_t& length : lengths )
+                {
+                    length  = static_cast<std::size_t>(twin->GetRandomNumber(static_cast<int32_t>(min_length), static_cast<int32_t>(max_length)));
+                    total  += length;
+                }
+
+                bool same_lengths = true;
+
+                for ( std::size_t index = 0; contiguous && index < count; ++index )
+                {
+                    same_lengths = same_lengths && sequences[index].size() == lengths[index];
+                }
+
+                context.Expect(same_lengths && std::ranges::equal(sequences.values(), twin->GetRandomBytes(total)), "seeded arena", iteration);
+            }
+        }
+    }
+
+    return context.Finish();
+}
@@ -0,0 +1,103 @@
+#include "TestSupport.hpp"
+#include "Module/DataGeneratorFactory.hpp"
+#include "Module/Internal/Xoshiro256StarStar.hpp"
+#include <cstring>
+#include <thread>
+
+namespace
+{
+    using Engine = Program::Module::Internal::Xoshiro256StarStar;
+
+    /**
+     * @brief Bytes of the stream of an engine, as the seeded generator lays them out
+     * @param engine The engine, advanced past the bytes
+     * @param size The number of bytes
+     * @return Every word yields eight bytes in native order, the tail the leading bytes of one more word
+     */
+    Program::Tests::Bytes GetEngineBytes(Engine& engine, const std::size_t size) noexcept
+    {
+        Program::Tests::Bytes bytes(size);
+
+        for ( std::size_t offset = 0; offset < size; offset += sizeof(std::uint64_t) )
+        {
+            const std::uint64_t word = engine();
+            std::memcpy(bytes.data() + offset, &word, std::min(sizeof(word), size - offset));
+        }
+
+        return bytes;
+    }
+} // namespace
+
+/**
+ * @brief Check the seeded generator against the xoshiro256** reference
+ * @note The engine is checked against the published outputs of the reference implementation, its jump against the
+ * commutation of the jump with the steps, then every stream of a seed against the engine jumped as many times.
+ */
+int32_t main()
+{
+    Program::Tests::TestContext context{ "SeededGenerator", 3 };
+
+    Engine reference{ Engine::state_type{ 1, 2, 3, 4 } };
+    context.Expect(reference() == 11520 && reference() == 0 && reference() == 1509978240 && reference() == 1215971899390074240, "xoshiro256** outputs", 0);
+    context.Expect(Engine{ std::uint64_t{ 0 } }.GetState()[0] == 0xE220A8397B1DCDAF && Engine{ std::uint64_t{ 0 } }.GetState()[2] == 0x06C45D188009454F, "SplitMix64 seeding", 0);
+
+    for ( std::size_t iteration = 0; iteration < 200; ++iteration )
+    {
+        const std::uint64_t seed  = (static_cast<std::uint64_t>(context.GetRandomNumber(0, UINT32_MAX)) << 32) | context.GetRandomNumber(0, UINT32_MAX);
+        const std::size_t   steps = context.GetRandomNumber(0, 100);
+        Engine              jumped_first{ seed };
+        Engine              stepped_first{ seed };
+
+        jumped_first.Jump();
+
+        for ( std::size_t step = 0; step < steps; ++step )
+        {
+            jumped_first();
+            stepped_first();
+        }
+
+        stepped_first.Jump();
+        context.Expect(jumped_first.GetState() == stepped_first.GetState(), "jump commutes with the steps", iteration);
+
+        const auto generator = Program::Module::DataGeneratorFactory::CreateSeeded(seed);
+        const auto twin      = Program::Module::DataGeneratorFactory::CreateSeeded(seed);
+        const auto size      = context.GetRandomNumber(0, 100);
+        Engine     engine{ seed };
+        Engine     twin_engine{ seed };
+
+        context.Expect(generator->GetSeed() == seed, "master seed", iteration);
+        context.Expect(generator->GetRandomBytes(size) == GetEngineBytes(engine, size), "stream 0 bytes", iteration);
+        context.Expect(twin->GetRandomBytes(size) == GetEngineBytes(twin_engine, size), "replayed bytes", iteration);
+        context.Expect(generator->GetRandomNumber(-1000, 1000) == twin->GetRandomNumber(-1000, 1000), "replayed numbers", iteration);
+
+        // Every stream is checked from its own thread: the streams of a seed do not depend on the thread that draws them.
+        const std::size_t         stream_count = context.GetRandomNumber(1, 4);
+        std::vector<std::thread>  threads;
+        std::vector<std::uint8_t> matched(stream_count, 0);
+
+        for ( std::size_t stream = 0; stream < stream_count; ++stream )
+        {
+            threads.emplace_back(
+                [&generator, &matched, seed, stream, size]() noexcept
+                {
+                    Engine stream_engine{ seed };
+
+                    for ( std::size_t jump = 0; jump < stream; ++jump )
+                    {
+                        stream_engine.Jump();
+                    }
+
+                    const auto stream_generator = generator->CreateStream(stream);
+                    matched[stream]             = stream_generator->GetRandomBytes(size) == GetEngineBytes(stream_engine, size) && stream_generator->GetSeed() == seed ? 1 : 0;
+                });
+        }
+
+        for ( std::size_t stream = 0; stream < stream_count; ++stream )
+        {
+            threads[stream].join();
+            context.Expect(matched[stream] == 1, "stream bytes", iteration);
+        }
+    }
+
+    return context.Finish();
+}
@@ -0,0 +1,56 @@
+#include "TestSupport.hpp"
+#include "Module/DataGeneratorFactory.hpp"
+#include "Module/Internal/SimdDataGenerator.hpp"
+#include <array>
+
+/**
+ * @brief Check the SIMD generator of every instruction set tier
+ * @note Buffers of every length up to a few vectors, at every alignment, must be filled without touching the bytes around them,
+ * and the bytes must look uniform. The tiers the processor does not support fall back to the best one it does.
+ */
+int32_t main()
+{
+    constexpr std::byte         Guard{ 0xA5 };
+    Program::Tests::TestContext context{ "SimdGenerator", 2 };
+
+    context.Expect(Program::Module::DataGeneratorFactory::Create("simd") != nullptr, "factory name", 0);
+
+    for ( const auto tier : { Program::Helpers::cpu_tier::scalar, Program::Helpers::cpu_tier::sse2, Program::Helpers::cpu_tier::avx2, Program::Helpers::cpu_tier::avx512 } )
+    {
+        const Program::Module::Internal::SimdDataGenerator generator{ tier };
+        std::array<std::size_t, 256>                       counts{};
+        Program::Tests::Bytes                              buffer(512);
+
+        for ( std::size_t iteration = 0; iteration < 4000; ++iteration )
+        {
+            const std::size_t offset = context.GetRandomNumber(0, 63);
+            const std::size_t length = context.GetRandomNumber(0, iteration % 4 == 0 ? 448 : 70);
+
+            std::fill(buffer.begin(), buffer.end(), Guard);
+            generator.FillRandomBytes(std::span{ buffer }.subspan(offset, length));
+
+            const bool guarded = std::all_of(buffer.cbegin(), buffer.cbegin() + static_cast<std::ptrdiff_t>(offset), [](const std::byte value) { return value == Guard; })
+                              && std::all_of(buffer.cbegin() + static_cast<std::ptrdiff_t>(offset + length), buffer.cend(), [](const std::byte value) { return value == Guard; });
+
+            context.Expect(guarded, "buffer bounds", iteration);
+
+            for ( std::size_t index = offset; index < offset + length; ++index )
+            {
+                ++counts[std::to_integer<std::size_t>(buffer[index])];
+            }
+
+            const auto min    = static_cast<int32_t>(context.GetRandomNumber(0, 255));
+            const auto max    = static_cast<int32_t>(context.GetRandomNumber(min, 255));
+            const auto value  = std::to_integer<int32_t>(generator.GetRandomByte(static_cast<std::byte>(min), static_cast<std::byte>(max)));
+            const auto number = generator.GetRandomNumber(-min, max * 1000);
+
+            context.Expect(value >= min && value <= max, "ranged byte", iteration);
+            context.Expect(number >= -min && number <= max * 1000, "ranged number", iteration);
+            context.Expect(generator.GetRandomBytes(length).size() == length, "byte count", iteration);
+        }
+
+        context.Expect(Program::Tests::IsUniform(counts), "byte uniformity", static_cast<std::size_t>(tier));
+    }
+
+    return context.Finish();
+}
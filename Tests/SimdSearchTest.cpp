@@ -0,0 +1,46 @@
+#include "TestSupport.hpp"
+#include "Module/DataSearchEngineFactory.hpp"
+
+/**
+ * @brief Check the SIMD first/last byte filter of every instruction set tier against a naive search
+ * @note Every source is a window of a larger buffer whose next bytes complete the pattern, so a kernel that reads or
+ * matches past the end of the window finds a match that is not there. The tiers the processor does not support fall back
+ * to the best one it does.
+ */
+int32_t main()
+{
+    Program::Tests::TestContext context{ "SimdSearch", 11 };
+
+    for ( const auto tier : { Program::Helpers::cpu_tier::scalar, Program::Helpers::cpu_tier::sse2, Program::Helpers::cpu_tier::avx2, Program::Helpers::cpu_tier::avx512 } )
+    {
+        const auto engine = Program::Module::DataSearchEngineFactory::Create(Program::Module::DataSearchEngineType::Simd, tier);
+
+        for ( std::size_t iteration = 0; iteration < 20000; ++iteration )
+        {
+            const std::size_t           alphabet = context.GetRandomNumber(1, iteration % 2 == 0 ? 256 : 3);
+            const Program::Tests::Bytes pattern  = context.GetRandomBytes(context.GetRandomNumber(1, iteration % 8 == 0 ? 200 : 40), alphabet);
+            const std::size_t           length   = context.GetRandomNumber(0, 300);
+            const std::size_t           begin    = context.GetRandomNumber(0, 63);
+            Program::Tests::Bytes       buffer   = context.GetRandomBytes(64 + length + pattern.size(), alphabet);
+
+            if ( iteration % 3 == 0 && pattern.size() <= length )
+            {
+                std::copy(pattern.cbegin(), pattern.cend(), buffer.begin() + static_cast<std::ptrdiff_t>(context.GetRandomNumber(begin, begin + length - pattern.size())));
+            }
+
+            if ( length > 0 )
+            {
+                const std::size_t inside = context.GetRandomNumber(1, std::min(pattern.size(), length)); //!< Bytes of the pattern inside the window
+                std::copy(pattern.cbegin(), pattern.cend(), buffer.begin() + static_cast<std::ptrdiff_t>(begin + length - inside));
+            }
+
+            const auto source  = std::span<const std::byte>{ buffer }.subspan(begin, length);
+            const auto offsets = Program::Tests::FindAllNaive(source, pattern);
+            const auto found   = engine->Search(source, pattern);
+
+            context.Expect(found.has_value() != offsets.empty() && (not found || *found == offsets.front()), "first occurrence", iteration);
+        }
+    }
+
+    return context.Finish();
+}
@@ -0,0 +1,54 @@
+#include "TestSupport.hpp"
+#include "Module/DataGeneratorFactory.hpp"
+
+/**
+ * @brief Check the span fill API of every generator type
+ * @note A span fill must stay inside its span; a reusable buffer must get a length in range without reallocating once it
+ * holds the maximum length. On a seeded generator, the span fill must yield the bytes GetRandomBytes yields on a twin.
+ */
+int32_t main()
+{
+    constexpr std::byte         Guard{ 0x5A };
+    Program::Tests::TestContext context{ "SpanFill", 4 };
+
+    for ( const auto type : { Program::Module::DataGeneratorType::Reference, Program::Module::DataGeneratorType::ThreadLocal, Program::Module::DataGeneratorType::Simd, Program::Module::DataGeneratorType::Seeded } )
+    {
+        const bool            seeded    = type == Program::Module::DataGeneratorType::Seeded;
+        const auto            generator = seeded ? Program::Module::DataGeneratorFactory::CreateSeeded(4) : Program::Module::DataGeneratorFactory::Create(type);
+        const auto            twin      = Program::Module::DataGeneratorFactory::CreateSeeded(4);
+        const std::size_t     max_count = context.GetRandomNumber(1, 300);
+        const std::size_t     cases     = type == Program::Module::DataGeneratorType::Reference ? 200 : 2000; //!< The reference generator reseeds on every call
+        Program::Tests::Bytes reusable;
+        Program::Tests::Bytes twin_reusable;
+
+        generator->FillRandomBytes(reusable, max_count, max_count);
+        twin->FillRandomBytes(twin_reusable, max_count, max_count);
+        const std::byte* const data = reusable.data();
+
+        for ( std::size_t iteration = 0; iteration < cases; ++iteration )
+        {
+            Program::Tests::Bytes buffer(400, Guard);
+            const std::size_t     offset = context.GetRandomNumber(0, 40);
+            const std::size_t     length = context.GetRandomNumber(0, buffer.size() - offset);
+            const auto            span   = std::span{ buffer }.subspan(offset, length);
+
+            generator->FillRandomBytes(span);
+
+            const bool guarded = std::all_of(buffer.cbegin(), buffer.cbegin() + static_cast<std::ptrdiff_t>(offset), [](const std::byte value) { return value == Guard; })
+                              && std::all_of(buffer.cbegin() + static_cast<std::ptrdiff_t>(offset + length), buffer.cend(), [](const std::byte value) { return value == Guard; });
+
+            context.Expect(guarded, "span bounds", iteration);
+            context.Expect(not seeded || std::equal(span.begin(), span.end(), twin->GetRandomBytes(length).cbegin()), "seeded span bytes", iteration);
+
+            const std::size_t min_count = context.GetRandomNumber(0, max_count);
+            const auto        filled    = generator->FillRandomBytes(reusable, min_count, max_count);
+
+            context.Expect(filled.data() == reusable.data() && filled.size() == reusable.size(), "filled view", iteration);
+            context.Expect(filled.size() >= min_count && filled.size() <= max_count, "filled length", iteration);
+            context.Expect(reusable.data() == data, "no reallocation", iteration);
+            context.Expect(not seeded || std::ranges::equal(filled, twin->FillRandomBytes(twin_reusable, min_count, max_count)), "seeded buffer bytes", iteration);
+        }
+    }
+
+    return context.Finish();
+}
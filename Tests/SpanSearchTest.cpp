@@ -0,0 +1,81 @@
+#include "TestSupport.hpp"
+#include "Module/DataSearchEngineFactory.hpp"
+
+namespace
+{
+    /**
+     * @brief Number of occurrences that do not overlap, by brute force
+     * @param offsets Every occurrence, in increasing order
+     * @param pattern_size The pattern length
+     * @return The occurrences left by taking the leftmost one and skipping past its end, repeatedly
+     */
+    std::uint64_t CountDisjoint(const std::vector<std::uint64_t>& offsets, const std::size_t pattern_size) noexcept
+    {
+        std::uint64_t count = 0;
+        std::uint64_t next  = 0;
+
+        for ( const std::uint64_t offset : offsets )
+        {
+            if ( offset >= next )
+            {
+                ++count;
+                next = offset + pattern_size;
+            }
+        }
+
+        return count;
+    }
+} // namespace
+
+/**
+ * @brief Check the span Search, FindAll and Count of every engine against a naive search
+ * @note FindAll is also called with buffers too small for every offset, then resumed from the last offset + 1 as documented,
+ * and must still list every occurrence once.
+ */
+int32_t main()
+{
+    Program::Tests::TestContext context{ "SpanSearch", 16 };
+
+    for ( const auto type : { Program::Module::DataSearchEngineType::BoyerMoore, Program::Module::DataSearchEngineType::AhoCorasick, Program::Module::DataSearchEngineType::Simd, Program::Module::DataSearchEngineType::Adaptive,
+                              Program::Module::DataSearchEngineType::RabinKarp, Program::Module::DataSearchEngineType::Approximate, Program::Module::DataSearchEngineType::Teddy } )
+    {
+        const auto engine = Program::Module::DataSearchEngineFactory::Create(type);
+
+        for ( std::size_t iteration = 0; iteration < 3000; ++iteration )
+        {
+            const std::size_t           alphabet = context.GetRandomNumber(1, iteration % 2 == 0 ? 256 : 2);
+            const Program::Tests::Bytes pattern  = context.GetRandomBytes(context.GetRandomNumber(0, iteration % 4 == 0 ? 100 : 8), alphabet);
+            Program::Tests::Bytes       source   = context.GetRandomBytes(context.GetRandomNumber(0, 400), alphabet);
+
+            context.Plant(source, pattern);
+
+            const auto                 expected = Program::Tests::FindAllNaive(source, pattern);
+            const auto                 found    = engine->Search(std::span<const std::byte>{ source }, std::span<const std::byte>{ pattern });
+            std::vector<std::uint64_t> offsets(source.size());
+            std::vector<std::uint64_t> resumed;
+            std::vector<std::uint64_t> window(context.GetRandomNumber(1, 4));
+
+            offsets.resize(engine->FindAll(source, pattern, offsets));
+
+            for ( std::uint64_t start = 0; start < source.size(); )
+            {
+                const std::size_t written = engine->FindAll(std::span<const std::byte>{ source }.subspan(start), pattern, window);
+
+                for ( std::size_t index = 0; index < written; ++index )
+                {
+                    resumed.push_back(start + window[index]);
+                }
+
+                start = written < window.size() ? source.size() : resumed.back() + 1;
+            }
+
+            context.Expect(found.has_value() != expected.empty() && (not found || *found == expected.front()), "Search", iteration);
+            context.Expect(offsets == expected, "FindAll", iteration);
+            context.Expect(resumed == expected, "resumed FindAll", iteration);
+            context.Expect(engine->Count(source, pattern, true) == expected.size(), "overlapping Count", iteration);
+            context.Expect(engine->Count(source, pattern, false) == CountDisjoint(expected, pattern.size()), "disjoint Count", iteration);
+        }
+    }
+
+    return context.Finish();
+}
@@ -0,0 +1,54 @@
+#include "TestSupport.hpp"
+#include "Module/DataSearchEngineFactory.hpp"
+#include "Module/DataStreamSearcher.hpp"
+
+/**
+ * @brief Check the stream searcher against a naive search of the whole stream, across arbitrary chunk splits
+ * @note Chunks are drawn from empty to longer than the pattern, so occurrences straddle one or several chunk boundaries.
+ * Every stream is pushed twice, with a Reset in between.
+ */
+int32_t main()
+{
+    Program::Tests::TestContext context{ "StreamSearch", 21 };
+
+    for ( const auto type : { Program::Module::DataSearchEngineType::BoyerMoore, Program::Module::DataSearchEngineType::Simd, Program::Module::DataSearchEngineType::Adaptive, Program::Module::DataSearchEngineType::Teddy } )
+    {
+        const auto engine = Program::Module::DataSearchEngineFactory::Create(type);
+
+        for ( std::size_t iteration = 0; iteration < 4000; ++iteration )
+        {
+            const std::size_t           alphabet = context.GetRandomNumber(1, 3);
+            const Program::Tests::Bytes pattern  = context.GetRandomBytes(context.GetRandomNumber(0, 12), alphabet);
+            Program::Tests::Bytes       source   = context.GetRandomBytes(context.GetRandomNumber(0, 400), alphabet);
+
+            context.Plant(source, pattern);
+
+            const auto                          expected  = Program::Tests::FindAllNaive(source, pattern);
+            const std::size_t                   max_chunk = iteration % 2 == 0 ? 3 : 40;
+            Program::Module::DataStreamSearcher stream{ engine->Compile(pattern) };
+            std::vector<std::uint64_t>          offsets;
+
+            for ( std::size_t pass = 0; pass < 2; ++pass )
+            {
+                std::size_t position = 0;
+                std::size_t pushed   = 0;
+
+                offsets.clear();
+                stream.Reset();
+
+                while ( position < source.size() )
+                {
+                    const std::size_t length = std::min(source.size() - position, context.GetRandomNumber(0, max_chunk));
+                    pushed                  += stream.Push(std::span<const std::byte>{ source }.subspan(position, length), offsets);
+                    position                += length;
+                }
+
+                context.Expect(offsets == expected, "stream offsets", iteration);
+                context.Expect(pushed == offsets.size(), "pushed count", iteration);
+                context.Expect(stream.GetPosition() == source.size(), "stream position", iteration);
+            }
+        }
+    }
+
+    return context.Finish();
+}
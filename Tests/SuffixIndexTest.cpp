@@ -0,0 +1,81 @@
+#include "TestSupport.hpp"
+#include "Module/DataSearchIndex.hpp"
+
+/**
+ * @brief Check the suffix array index against a linear scan of every source
+ * @note The sources are added over several batches and single Adds, so the merges of the suffix arrays are checked too.
+ */
+int32_t main()
+{
+    Program::Tests::TestContext context{ "SuffixIndex", 23 };
+
+    for ( std::size_t iteration = 0; iteration < 3000; ++iteration )
+    {
+        const std::size_t                  alphabet = context.GetRandomNumber(1, iteration % 4 == 0 ? 256 : 3);
+        std::vector<Program::Tests::Bytes> sources;
+        Program::Module::DataSearchIndex   index;
+
+        for ( std::size_t batch = context.GetRandomNumber(1, 4); batch > 0; --batch )
+        {
+            if ( context.GetRandomNumber(0, 1) == 0 )
+            {
+                sources.push_back(context.GetRandomBytes(context.GetRandomNumber(0, 30), alphabet));
+                index.Add(sources.back());
+                continue;
+            }
+
+            Program::Helpers::ragged_array<std::byte> added;
+
+            for ( std::size_t count = context.GetRandomNumber(0, 5); count > 0; --count )
+            {
+                sources.push_back(context.GetRandomBytes(context.GetRandomNumber(0, 30), alphabet));
+                added.push_back(sources.back());
+            }
+
+            if ( not added.empty() )
+            {
+                index.Add(added);
+            }
+        }
+
+        std::uint64_t size = 0;
+
+        for ( std::size_t source = 0; source < sources.size(); ++source )
+        {
+            const auto stored = index.GetSource(source);
+            size             += sources[source].size();
+            context.Expect(std::equal(stored.begin(), stored.end(), sources[source].cbegin(), sources[source].cend()), "GetSource", iteration);
+        }
+
+        context.Expect(index.GetSourceCount() == sources.size(), "GetSourceCount", iteration);
+        context.Expect(index.GetSize() == size, "GetSize", iteration);
+
+        for ( std::size_t query = 0; query < 20; ++query )
+        {
+            Program::Tests::Bytes pattern = context.GetRandomBytes(context.GetRandomNumber(0, 6), alphabet);
+
+            if ( not sources.empty() && query % 2 == 0 )
+            {
+                const auto& source = sources[context.GetRandomNumber(0, sources.size() - 1)];
+                const auto  offset = context.GetRandomNumber(0, source.size());
+                pattern.assign(source.cbegin() + static_cast<std::ptrdiff_t>(offset), source.cbegin() + static_cast<std::ptrdiff_t>(std::min(source.size(), offset + pattern.size())));
+            }
+
+            std::vector<Program::Module::DataIndexMatch> expected;
+
+            for ( std::size_t source = 0; source < sources.size(); ++source )
+            {
+                for ( const std::uint64_t offset : Program::Tests::FindAllNaive(sources[source], pattern) )
+                {
+                    expected.push_back({ source, offset });
+                }
+            }
+
+            context.Expect(index.Locate(pattern) == expected, "Locate", iteration);
+            context.Expect(index.Count(pattern) == expected.size(), "Count", iteration);
+            context.Expect(index.Contains(pattern) == not expected.empty(), "Contains", iteration);
+        }
+    }
+
+    return context.Finish();
+}
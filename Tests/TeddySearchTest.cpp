@@ -0,0 +1,48 @@
+#include "TestSupport.hpp"
+#include "Module/DataSearchEngineFactory.hpp"
+#include "Module/DataSearchPlanner.hpp"
+#include "Module/IMultiPatternSearchEngine.hpp"
+
+/**
+ * @brief Check the Teddy pattern sets of every instruction set tier against brute force
+ * @note Both the raw sets and the planned ones are checked, on Search, Contains and Match. The tiers the processor does not
+ * support fall back to the best one it does.
+ */
+int32_t main()
+{
+    Program::Tests::TestContext context{ "TeddySearch", 25 };
+
+    for ( const auto tier : { Program::Helpers::cpu_tier::scalar, Program::Helpers::cpu_tier::sse2, Program::Helpers::cpu_tier::avx2, Program::Helpers::cpu_tier::avx512 } )
+    {
+        const auto  engine               = Program::Module::DataSearchEngineFactory::Create(Program::Module::DataSearchEngineType::Teddy, tier);
+        const auto& multi_pattern_engine = dynamic_cast<const Program::Module::IMultiPatternSearchEngine&>(*engine);
+
+        for ( std::size_t iteration = 0; iteration < 1000; ++iteration )
+        {
+            const std::size_t                  alphabet = context.GetRandomNumber(1, iteration % 2 == 0 ? 256 : 4);
+            std::vector<Program::Tests::Bytes> patterns(context.GetRandomNumber(0, iteration % 5 == 0 ? 90 : 20));
+
+            for ( auto& pattern : patterns )
+            {
+                pattern = context.GetRandomBytes(context.GetRandomNumber(0, iteration % 3 == 0 ? 40 : 6), alphabet); //!< Empty patterns included: they never match
+            }
+
+            for ( const auto& set : { multi_pattern_engine.Compile(patterns), Program::Module::DataSearchPlanner::Compile(*engine, patterns) } )
+            {
+                for ( std::size_t source_index = 0; source_index < 10; ++source_index )
+                {
+                    Program::Tests::Bytes source = context.GetRandomBytes(context.GetRandomNumber(0, 300), alphabet);
+
+                    if ( not patterns.empty() && source_index % 2 == 0 )
+                    {
+                        context.Plant(source, patterns[context.GetRandomNumber(0, patterns.size() - 1)]);
+                    }
+
+                    Program::Tests::ExpectPatternSet(context, *set, patterns, source, iteration);
+                }
+            }
+        }
+    }
+
+    return context.Finish();
+}
@@ -0,0 +1,233 @@
+#pragma once
+#ifndef __TESTS_TEST_SUPPORT_HPP__ // clang-format off
+#define __TESTS_TEST_SUPPORT_HPP__ // clang-format on
+
+ #include "Module/IPatternSet.hpp"
+ #include <algorithm>
+ #include <cinttypes>
+ #include <cmath>
+ #include <cstddef>
+ #include <cstdio>
+ #include <cstdlib>
+ #include <optional>
+ #include <random>
+ #include <span>
+ #include <string_view>
+ #include <vector>
+
+namespace Program::Tests
+{
+    using Bytes = std::vector<std::byte>;
+
+    /**
+     * @brief State of a randomized test
+     * @details Draws reproducible random cases from a fixed seed and counts the failed checks.
+     * @note Only the first failures are printed, the count is reported by Finish.
+     */
+    class TestContext final
+    {
+    public:
+        /**
+         * @brief Constructor
+         * @param name The test name, printed with the failures
+         * @param seed The seed of the cases: a failure replays with the same seed
+         */
+        TestContext(const std::string_view name, const std::uint64_t seed) noexcept
+            : m_Name{ name }
+            , m_Engine{ seed }
+            , m_Checks{ 0 }
+            , m_Failures{ 0 }
+        {
+        }
+
+        /**
+         * @brief Draw a random number
+         * @param min The minimum value of the number
+         * @param max The maximum value of the number
+         * @return A number in the range of min to max
+         */
+        std::size_t GetRandomNumber(const std::size_t min, const std::size_t max) noexcept
+        {
+            return std::uniform_int_distribution<std::size_t>{ min, max }(m_Engine);
+        }
+
+        /**
+         * @brief Draw random bytes from a small alphabet
+         * @param size The number of bytes
+         * @param alphabet The number of distinct byte values, 1 to 256: the smaller, the more repeats and overlaps
+         * @return The bytes, each in the range of 0 to alphabet - 1
+         */
+        Bytes GetRandomBytes(const std::size_t size, const std::size_t alphabet) noexcept
+        {
+            Bytes bytes(size);
+
+            for ( std::byte& value : bytes )
+            {
+                value = static_cast<std::byte>(GetRandomNumber(0, alphabet - 1));
+            }
+
+            return bytes;
+        }
+
+        /**
+         * @brief Copy a pattern at a random offset of a source, so that matches are not only left to chance
+         * @param source The source data
+         * @param pattern The pattern, ignored if longer than the source
+         */
+        void Plant(Bytes& source, const Bytes& pattern) noexcept
+        {
+            if ( pattern.size() <= source.size() )
+            {
+                std::copy(pattern.cbegin(), pattern.cend(), source.begin() + static_cast<std::ptrdiff_t>(GetRandomNumber(0, source.size() - pattern.size())));
+            }
+        }
+
+        /**
+         * @brief Check a condition
+         * @param condition The condition
+         * @param what The check, printed if it fails
+         * @param iteration The case, printed if it fails
+         */
+        void Expect(const bool condition, const char* what, const std::size_t iteration) noexcept
+        {
+            ++m_Checks;
+
+            if ( not condition && m_Failures++ < MaxPrintedFailures )
+            {
+                printf("%s: %s failed at case %zu\n", m_Name.data(), what, iteration);
+            }
+        }
+
+        /**
+         * @brief Report the result
+         * @return EXIT_SUCCESS if every check passed, to return from main
+         */
+        int32_t Finish() const noexcept
+        {
+            printf("%s: %zu checks, %zu failed\n", m_Name.data(), m_Checks, m_Failures);
+            return m_Failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+
+    private:
+        static constexpr std::size_t MaxPrintedFailures = 10; //!< Failures printed before only counting them
+
+        std::string_view m_Name;     //!< The test name
+        std::mt19937_64  m_Engine;   //!< Engine of the cases
+        std::size_t      m_Checks;   //!< Number of checks
+        std::size_t      m_Failures; //!< Number of failed checks
+    };
+
+    /**
+     * @brief Chi-square test of uniformity
+     * @param counts The number of draws of every value
+     * @return True if the counts look uniform: the statistic is below its mean plus six standard deviations
+     */
+    inline bool IsUniform(const std::span<const std::size_t> counts) noexcept
+    {
+        std::size_t total = 0;
+
+        for ( const std::size_t count : counts )
+        {
+            total += count;
+        }
+
+        const double expected  = static_cast<double>(total) / static_cast<double>(counts.size());
+        const double freedom   = static_cast<double>(counts.size() - 1);
+        double       statistic = 0.0;
+
+        for ( const std::size_t count : counts )
+        {
+            statistic += (static_cast<double>(count) - expected) * (static_cast<double>(count) - expected) / expected;
+        }
+
+        return statistic < freedom + 6.0 * std::sqrt(2.0 * freedom);
+    }
+
+    /**
+     * @brief Naive search for every occurrence of a pattern
+     * @param source The source data to search in
+     * @param pattern_size The pattern length
+     * @param matches Whether the pattern matches at an offset, called for every offset it fits at
+     * @return The offsets of the occurrences in increasing order, overlapping ones included. An empty pattern never matches.
+     */
+    template<typename TMatches>
+    std::vector<std::uint64_t> FindAllNaive(const std::span<const std::byte> source, const std::size_t pattern_size, TMatches&& matches) noexcept
+    {
+        std::vector<std::uint64_t> offsets;
+
+        for ( std::size_t offset = 0; pattern_size > 0 && offset + pattern_size <= source.size(); ++offset )
+        {
+            if ( matches(offset) )
+            {
+                offsets.push_back(offset);
+            }
+        }
+
+        return offsets;
+    }
+
+    /**
+     * @brief Naive search for every occurrence of a pattern
+     * @param source The source data to search in
+     * @param pattern The data to search for
+     * @return The offsets of the occurrences in increasing order, overlapping ones included. An empty pattern never matches.
+     */
+    inline std::vector<std::uint64_t> FindAllNaive(const std::span<const std::byte> source, const std::span<const std::byte> pattern) noexcept
+    {
+        return FindAllNaive(source, pattern.size(),
+                            [source, pattern](const std::size_t offset) noexcept
+                            {
+                                for ( std::size_t index = 0; index < pattern.size(); ++index )
+                                {
+                                    if ( source[offset + index] != pattern[index] )
+                                    {
+                                        return false;
+                                    }
+                                }
+
+                                return true;
+                            });
+    }
+
+    /**
+     * @brief Check a compiled pattern set against a naive search of every pattern
+     * @param context The test
+     * @param set The compiled set
+     * @param patterns The patterns the set was compiled from
+     * @param source The source data to search in
+     * @param iteration The case, printed if a check fails
+     * @note Search must return the leftmost match, the lowest pattern index among matches at the same offset; Contains whether
+     * there is one; Match the bit of every pattern that occurs.
+     */
+    inline void ExpectPatternSet(TestContext& context, const Module::IPatternSet& set, const std::vector<Bytes>& patterns, const std::span<const std::byte> source, const std::size_t iteration) noexcept
+    {
+        std::optional<Module::PatternMatch> expected;
+        std::vector<std::uint64_t>          expected_matches((patterns.size() + 63) / 64, 0);
+        std::vector<std::uint64_t>          matches(expected_matches.size(), 0);
+
+        for ( std::size_t index = 0; index < patterns.size(); ++index )
+        {
+            const auto offsets = FindAllNaive(source, patterns[index]);
+
+            if ( not offsets.empty() )
+            {
+                expected_matches[index / 64] |= std::uint64_t{ 1 } << (index % 64);
+
+                if ( not expected || offsets.front() < expected->offset )
+                {
+                    expected = Module::PatternMatch{ index, offsets.front() };
+                }
+            }
+        }
+
+        const auto found = set.Search(source);
+        set.Match(source, matches);
+
+        context.Expect(found.has_value() == expected.has_value() && (not found || (found->offset == expected->offset && found->pattern == expected->pattern)), "Search", iteration);
+        context.Expect(set.Contains(source) == expected.has_value(), "Contains", iteration);
+        context.Expect(matches == expected_matches, "Match", iteration);
+        context.Expect(set.GetPatternCount() == patterns.size(), "pattern count", iteration);
+    }
+} // namespace Program::Tests
+
+#endif // __TESTS_TEST_SUPPORT_HPP__
@@ -0,0 +1,116 @@
+#include "TestSupport.hpp"
+#include "Module/DataGeneratorFactory.hpp"
+#include <array>
+#include <cstring>
+#include <set>
+#include <thread>
+
+namespace
+{
+    constexpr std::size_t ThreadCount = 4; //!< Threads drawing from one generator at the same time
+
+    /**
+     * @brief Draws of one thread
+     */
+    struct ThreadDraws
+    {
+        std::uint64_t                first_word{};   //!< The first eight bytes the thread drew
+        std::array<std::size_t, 256> byte_counts{};  //!< Number of draws of every byte value
+        std::size_t                  out_of_range{}; //!< Number of ranged draws outside of their range
+    };
+
+    /**
+     * @brief Draw eight bytes
+     * @param generator The generator
+     * @return The bytes, as a word
+     */
+    std::uint64_t GetRandomWord(const Program::Module::IDataGenerator& generator) noexcept
+    {
+        std::uint64_t word  = 0;
+        const auto    bytes = generator.GetRandomBytes(sizeof(word));
+        std::memcpy(&word, bytes.data(), sizeof(word));
+        return word;
+    }
+
+    /**
+     * @brief Draw from a generator as one of several threads
+     * @param generator The generator shared by the threads
+     * @param ranges The ranges of the ranged draws, pairs of minimum and maximum
+     * @return The draws
+     */
+    ThreadDraws Draw(const Program::Module::IDataGenerator& generator, const std::vector<std::pair<int32_t, int32_t>>& ranges) noexcept
+    {
+        ThreadDraws draws;
+        draws.first_word = GetRandomWord(generator);
+
+        for ( std::size_t round = 0; round < 64; ++round )
+        {
+            for ( const std::byte value : generator.GetRandomBytes(1024) )
+            {
+                ++draws.byte_counts[std::to_integer<std::size_t>(value)];
+            }
+        }
+
+        for ( const auto& [min, max] : ranges )
+        {
+            const std::int32_t number = generator.GetRandomNumber(min, max);
+            draws.out_of_range       += number < min || number > max ? 1 : 0;
+
+            if ( min >= 0 && max <= 255 )
+            {
+                const std::byte value = generator.GetRandomByte(static_cast<std::byte>(min), static_cast<std::byte>(max));
+                draws.out_of_range   += std::to_integer<int32_t>(value) < min || std::to_integer<int32_t>(value) > max ? 1 : 0;
+            }
+        }
+
+        return draws;
+    }
+} // namespace
+
+/**
+ * @brief Check the reference and thread local generators from several threads at once
+ * @note Every ranged draw must stay in its range, the bytes of every thread must look uniform, and no two threads (nor two
+ * calls of one thread) may start from the same bytes: a generator reseeded with the same value would repeat them.
+ */
+int32_t main()
+{
+    Program::Tests::TestContext              context{ "ThreadLocalGenerator", 1 };
+    std::vector<std::pair<int32_t, int32_t>> ranges{ { 0, 0 }, { 7, 7 }, { 0, 255 }, { 1, 100 }, { INT32_MIN, INT32_MAX }, { -5, 5 } };
+
+    for ( std::size_t index = 0; index < 2000; ++index )
+    {
+        const auto min = static_cast<int32_t>(context.GetRandomNumber(0, 2000)) - 1000;
+        ranges.emplace_back(min, min + static_cast<int32_t>(context.GetRandomNumber(0, index % 2 == 0 ? 300 : 100000)));
+    }
+
+    for ( const auto type : { Program::Module::DataGeneratorType::Reference, Program::Module::DataGeneratorType::ThreadLocal } )
+    {
+        const auto                           generator = Program::Module::DataGeneratorFactory::Create(type);
+        std::array<ThreadDraws, ThreadCount> draws;
+        std::vector<std::thread>             threads;
+
+        for ( std::size_t thread = 0; thread < ThreadCount; ++thread )
+        {
+            threads.emplace_back([&generator, &ranges, &draws, thread]() noexcept { draws[thread] = Draw(*generator, ranges); });
+        }
+
+        for ( std::thread& thread : threads )
+        {
+            thread.join();
+        }
+
+        std::set<std::uint64_t> first_words;
+
+        for ( std::size_t thread = 0; thread < ThreadCount; ++thread )
+        {
+            context.Expect(draws[thread].out_of_range == 0, "ranged draws", thread);
+            context.Expect(Program::Tests::IsUniform(draws[thread].byte_counts), "byte uniformity", thread);
+            context.Expect(first_words.insert(draws[thread].first_word).second, "distinct thread streams", thread);
+        }
+
+        context.Expect(first_words.insert(GetRandomWord(*generator)).second, "distinct calls", 0);
+        context.Expect(generator->GetRandomBytes(0).empty() && generator->GetRandomBytes(77).size() == 77, "byte counts", 0);
+    }
+
+    return context.Finish();
+}
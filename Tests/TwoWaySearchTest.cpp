@@ -0,0 +1,31 @@
+#include "TestSupport.hpp"
+#include "Module/Internal/TwoWaySearcher.hpp"
+
+/**
+ * @brief Check the two-way searcher against a naive search
+ * @note Small alphabets make periodic patterns, where the two-way shifts are the easiest to get wrong.
+ */
+int32_t main()
+{
+    Program::Tests::TestContext context{ "TwoWaySearch", 11 };
+
+    for ( std::size_t iteration = 0; iteration < 100000; ++iteration )
+    {
+        const std::size_t           alphabet = context.GetRandomNumber(1, iteration % 4 == 0 ? 256 : 3);
+        const Program::Tests::Bytes pattern  = context.GetRandomBytes(context.GetRandomNumber(1, iteration % 8 == 0 ? 300 : 40), alphabet);
+        Program::Tests::Bytes       source   = context.GetRandomBytes(context.GetRandomNumber(0, 400), alphabet);
+
+        if ( iteration % 3 == 0 )
+        {
+            context.Plant(source, pattern);
+        }
+
+        const Program::Module::Internal::TwoWaySearcher searcher{ pattern };
+        const auto                                      offsets = Program::Tests::FindAllNaive(source, pattern);
+        const auto                                      found   = searcher.Search(source);
+
+        context.Expect(found.has_value() != offsets.empty() && (not found || *found == offsets.front()), "first occurrence", iteration);
+    }
+
+    return context.Finish();
+}
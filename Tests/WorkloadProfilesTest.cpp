@@ -0,0 +1,153 @@
+#include "TestSupport.hpp"
+#include "Module/DataGeneratorFactory.hpp"
+#include <array>
+#include <cmath>
+#include <string_view>
+
+namespace
+{
+    using Program::Module::DataGeneratorProfile;
+
+    /**
+     * @brief Zipf byte of a 16-bit value, by the definition of the symbol tables
+     * @details The value v maps to the byte whose cumulative weight interval contains (v + 0.5) / 2^16, byte k weighing 1 / (k + 1)^1.1.
+     */
+    std::byte GetZipfByte(const std::uint16_t value) noexcept
+    {
+        static const std::array<double, 257> cumulative = []() noexcept
+        {
+            std::array<double, 257> sums{};
+
+            for ( std::size_t rank = 0; rank < 256; ++rank )
+            {
+                sums[rank + 1] = sums[rank] + 1.0 / std::pow(static_cast<double>(rank + 1), 1.1);
+            }
+
+            return sums;
+        }();
+
+        const double position = (static_cast<double>(value) + 0.5) / 65536.0 * cumulative.back();
+        std::size_t  rank     = 0;
+
+        while ( rank < 255 && cumulative[rank + 1] <= position )
+        {
+            ++rank;
+        }
+
+        return static_cast<std::byte>(rank);
+    }
+
+    /**
+     * @brief Bytes of a profile, built on a twin of the random source of the profile generator
+     * @param profile The profile, but Text
+     * @param random The twin random source
+     * @param size The number of bytes
+     * @return The bytes the profile generator must yield
+     */
+    Program::Tests::Bytes GetProfileBytes(const DataGeneratorProfile profile, const Program::Module::IDataGenerator& random, const std::size_t size) noexcept
+    {
+        Program::Tests::Bytes bytes(size);
+
+        if ( size == 0 )
+        {
+            return bytes;
+        }
+
+        switch ( profile )
+        {
+            case DataGeneratorProfile::Zipf:
+                for ( std::size_t offset = 0; offset < size; offset += 256 ) //!< The 16-bit values are drawn in blocks of 256
+                {
+                    std::array<std::uint16_t, 256> values{};
+                    const std::size_t              count = std::min<std::size_t>(256, size - offset);
+
+                    random.FillRandomBytes(std::as_writable_bytes(std::span{ values }.first(count)));
+                    std::transform(values.cbegin(), values.cbegin() + count, bytes.begin() + static_cast<std::ptrdiff_t>(offset), GetZipfByte);
+                }
+                break;
+
+            case DataGeneratorProfile::Dna:
+                random.FillRandomBytes(bytes);
+                std::transform(bytes.cbegin(), bytes.cend(), bytes.begin(), [](const std::byte value) { return static_cast<std::byte>("ACGT"[std::to_integer<std::size_t>(value) % 4]); });
+                break;
+
+            case DataGeneratorProfile::Periodic:
+            {
+                const auto period = std::min<std::size_t>(size, random.GetRandomNumber(1, 16));
+                random.FillRandomBytes(std::span{ bytes }.first(period));
+
+                for ( std::size_t index = period; index < size; ++index )
+                {
+                    bytes[index] = bytes[index % period];
+                }
+                break;
+            }
+
+            case DataGeneratorProfile::Runs:
+                for ( std::size_t offset = 0; offset < size; )
+                {
+                    const auto length = std::min<std::size_t>(size - offset, random.GetRandomNumber(1, 32));
+                    std::fill_n(bytes.begin() + static_cast<std::ptrdiff_t>(offset), length, random.GetRandomByte(std::byte{ 255 }));
+                    offset += length;
+                }
+                break;
+
+            default:
+                random.FillRandomBytes(bytes);
+                break;
+        }
+
+        return bytes;
+    }
+} // namespace
+
+/**
+ * @brief Check the workload profiles against their construction on a twin of their seeded random source
+ * @note The text profile is only checked for its alphabet and its most frequent letters. Sequence arenas are laid out by the
+ * random source, then every sequence is reshaped on its own.
+ */
+int32_t main()
+{
+    constexpr std::string_view  Text = " etaoinshrdlcumwfgypbvkjxqz.,\n";
+    Program::Tests::TestContext context{ "WorkloadProfiles", 8 };
+
+    for ( const auto profile : { DataGeneratorProfile::Uniform, DataGeneratorProfile::Zipf, DataGeneratorProfile::Dna, DataGeneratorProfile::Periodic, DataGeneratorProfile::Runs } )
+    {
+        const auto generator = Program::Module::DataGeneratorFactory::CreateProfile(profile, Program::Module::DataGeneratorFactory::CreateSeeded(8));
+        const auto twin      = Program::Module::DataGeneratorFactory::CreateSeeded(8);
+
+        for ( std::size_t iteration = 0; iteration < 500; ++iteration )
+        {
+            const std::size_t size = context.GetRandomNumber(0, iteration % 10 == 0 ? 5000 : 300);
+            context.Expect(generator->GetRandomBytes(size) == GetProfileBytes(profile, *twin, size), "profile bytes", iteration);
+        }
+
+        Program::Helpers::ragged_array<std::byte> sequences;
+        Program::Helpers::ragged_array<std::byte> twin_sequences;
+        bool                                      same = true;
+
+        generator->FillRandomSequences(sequences, 20, 0, 100);
+        twin->FillRandomSequences(twin_sequences, 20, 0, 100);
+
+        for ( std::size_t index = 0; index < twin_sequences.size(); ++index )
+        {
+            const auto expected = profile == DataGeneratorProfile::Uniform ? Program::Tests::Bytes{ twin_sequences[index].begin(), twin_sequences[index].end() } : GetProfileBytes(profile, *twin, twin_sequences[index].size());
+            same                = same && std::ranges::equal(sequences[index], expected);
+        }
+
+        context.Expect(same && sequences.size() == twin_sequences.size(), "profile sequences", static_cast<std::size_t>(profile));
+    }
+
+    const auto                   text = Program::Module::DataGeneratorFactory::CreateProfile(DataGeneratorProfile::Text)->GetRandomBytes(1 << 20);
+    std::array<std::size_t, 256> counts{};
+
+    for ( const std::byte value : text )
+    {
+        ++counts[std::to_integer<std::size_t>(value)];
+    }
+
+    context.Expect(std::ranges::all_of(text, [Text](const std::byte value) { return Text.find(std::to_integer<char>(value)) != Text.npos; }), "text alphabet", 0);
+    context.Expect(std::ranges::max_element(counts) - counts.begin() == ' ' && counts['e'] > counts['t'] && counts['t'] > counts['z'], "text frequencies", 0);
+
+    return context.Finish();
+}